@@ -783,6 +783,8 @@
 
 #define LV_USE_MSGBOX     1
 
+#define LV_USE_RECYCLERVIEW 1   /**< Requires: lv_label */
+
 #define LV_USE_ROLLER     1   /**< Requires: lv_label */
 
 #define LV_USE_SCALE      1
@@ -0,0 +1,50 @@
+#include "../../lv_examples.h"
+#if LV_USE_RECYCLERVIEW && LV_BUILD_EXAMPLES
+
+static uint32_t get_count_cb(lv_obj_t * rv)
+{
+    LV_UNUSED(rv);
+    return 100000;
+}
+
+static void click_event_cb(lv_event_t * e)
+{
+    lv_obj_t * row = lv_event_get_target_obj(e);
+    lv_obj_t * rv = lv_obj_get_parent(row);
+    LV_LOG_USER("Clicked: row %" LV_PRIu32, lv_recyclerview_get_row_index(rv, row));
+}
+
+static lv_obj_t * create_row_cb(lv_obj_t * rv)
+{
+    lv_obj_t * btn = lv_button_create(rv);
+    lv_obj_set_width(btn, lv_pct(100));
+    lv_obj_add_event_cb(btn, click_event_cb, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_t * label = lv_label_create(btn);
+    lv_obj_align(label, LV_ALIGN_LEFT_MID, 0, 0);
+    return btn;
+}
+
+static void bind_row_cb(lv_obj_t * rv, lv_obj_t * row, uint32_t index)
+{
+    LV_UNUSED(rv);
+    lv_label_set_text_fmt(lv_obj_get_child(row, 0), "Event %" LV_PRIu32, index);
+}
+
+/**
+ * A list of 100000 rows which creates buttons only for the visible ones
+ */
+void lv_example_recyclerview_1(void)
+{
+    lv_obj_t * rv = lv_recyclerview_create(lv_screen_active());
+    lv_obj_set_size(rv, 200, 220);
+    lv_obj_center(rv);
+    lv_obj_set_style_pad_row(rv, 4, 0);
+
+    lv_recyclerview_set_row_height(rv, 36);
+    lv_recyclerview_set_create_row_cb(rv, create_row_cb);
+    lv_recyclerview_set_bind_row_cb(rv, bind_row_cb);
+    lv_recyclerview_set_get_count_cb(rv, get_count_cb);
+}
+
+#endif
@@ -83,6 +83,17 @@
     #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+/** Allocate the widgets, their attributes and small style arrays from chunks of this size
+ *  instead of allocating each of them from the heap. The chunks are grouped by 16 byte size classes
+ *  up to 512 bytes and freed when they become empty. It makes creating and deleting many widgets
+ *  faster and reduces fragmentation. 0: disable */
+#define LV_OBJ_POOL_CHUNK_SIZE  0       /**< [bytes] */
+
+/** Allocate the timers, the animations and the style transitions from chunks of this size
+ *  instead of allocating each of them from the heap. It keeps the items iterated in every refresh
+ *  close to each other in the memory. 0: disable */
+#define LV_TIMER_ANIM_POOL_CHUNK_SIZE  0    /**< [bytes] */
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -94,6 +105,12 @@
  * (Not so important, you can adjust it to modify default sizes and spaces.) */
 #define LV_DPI_DEF 130              /**< [px/inch] */
 
+/** The cost of refreshing an invalidated area besides its pixels (e.g. traversing the widgets and
+ *  starting a flush), expressed in pixels. Invalidated areas are joined if redrawing their bounding
+ *  box costs less than redrawing them separately. Use a larger value if rendering and flushing
+ *  pixels is fast, and a smaller one if e.g. flushing over SPI is the bottleneck. */
+#define LV_INV_AREA_OVERHEAD 1024   /**< [px] */
+
 /*=================
  * OPERATING SYSTEM
  *=================*/
@@ -151,6 +168,18 @@
  * Set it to 0 to have no limit. */
 #define LV_DRAW_LAYER_MAX_MEMORY 0  /**< No limit by default [bytes]*/
 
+/** If a layer has more draw tasks than this, the draw tasks are also sorted into a grid of bins.
+ *  This way only the draw tasks in the same bins need to be checked to find the independent ones,
+ *  which is much faster with thousands of draw tasks and multiple draw units or threads.
+ *  Set it to 0 to always check all the draw tasks of the layer. */
+#define LV_DRAW_TASK_GRID_THRESHOLD 128
+
+/** 1: Don't draw the waiting draw tasks which are fully covered by a newer opaque draw task
+ *  (e.g. a fill without radius, or an image without alpha channel and transformation).
+ *  The draw units don't receive the culled draw tasks at all.
+ *  `lv_draw_get_culled_pixel_count()` tells how many pixels were saved this way. */
+#define LV_DRAW_OCCLUSION_CULLING 0
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -194,6 +223,17 @@
      *  - > 1 means multiple threads will render the screen in parallel. */
     #define LV_DRAW_SW_DRAW_UNIT_CNT    1
 
+    /** If > 0, wait until all draw tasks of the display are added, sort them into
+     *  full width tiles of this height (in pixels) and let the threads render whole tiles.
+     *  This way all threads can work even if the draw tasks overlap.
+     *  Requires `LV_DRAW_SW_DRAW_UNIT_CNT > 1`. */
+    #define LV_DRAW_SW_BIN_TILE_HEIGHT  0
+
+    /** If > 0, split fill, image, layer and box shadow draw tasks larger than this many
+     *  pixels into `LV_DRAW_SW_DRAW_UNIT_CNT` horizontal bands which are rendered by all the threads.
+     *  Requires `LV_DRAW_SW_DRAW_UNIT_CNT > 1`. */
+    #define LV_DRAW_SW_SPLIT_THRESHOLD  0
+
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #define LV_USE_DRAW_ARM2D_SYNC      0
 
@@ -532,6 +572,12 @@
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/** Memory budget in bytes for the bitmaps of the widgets with `LV_OBJ_FLAG_CACHE_BITMAP`.
+ *  These widgets are rendered once into an ARGB8888 bitmap which is drawn until they are invalidated.
+ *  If the budget is exceeded the least recently used bitmaps are freed.
+ *  If size is 0, the flag has no effect. */
+#define LV_OBJ_BITMAP_CACHE_DEF_SIZE 0
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #define LV_GRADIENT_MAX_STOPS   2
@@ -547,6 +593,27 @@
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/** Memory budget in bytes of caching the resolved values of the style properties per widget
+ *  (e.g. the values used for drawing). Only non-inheritable properties are cached. 0: disable */
+#define LV_OBJ_STYLE_VALUE_CACHE_SIZE   0
+
+/** Non-constant styles with more properties than this keep their properties sorted by ID
+ *  so that they can be found by binary search instead of a linear scan. */
+#define LV_STYLE_SORTED_PROP_CNT_MIN    8
+
+/** Search the property IDs of the styles with SSE2, AVX2 or NEON instructions if the compiler enables them.
+ *  The property IDs of each style are padded to the vector width (16 or 32 bytes). */
+#define LV_USE_STYLE_SIMD       0
+
+/** Find the clicked widget among the children of widgets with at least this many children
+ *  by a grid of their click areas instead of hit testing all children.
+ *  The grid is built when the pointer is used and rebuilt when the children change. 0: disable */
+#define LV_OBJ_HIT_INDEX_MIN_CHILDREN   0
+
+/** Compute the values of the animations with the same built-in path in one pass and
+ *  coalesce the invalidations of the widgets while the animations are applied */
+#define LV_USE_ANIM_BATCH       0
+
 /** Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -810,6 +877,8 @@
 
 #define LV_USE_MSGBOX     1
 
+#define LV_USE_RECYCLERVIEW 1   /**< Requires: lv_label */
+
 #define LV_USE_ROLLER     1   /**< Requires: lv_label */
 
 #define LV_USE_SCALE      1
@@ -867,6 +936,10 @@
 /** A theme designed for monochrome displays */
 #define LV_USE_THEME_MONO 1
 
+/** Find the properties in the styles of the built-in themes by precomputed property tables
+ *  instead of searching them. Needs about 200 bytes of ROM per style (~13 kB for the default theme). */
+#define LV_USE_THEME_STYLE_TABLES 0
+
 /*==================
  * LAYOUTS
  *==================*/
@@ -44,6 +44,7 @@ extern "C" {
 #include "src/core/lv_obj.h"
 #include "src/core/lv_group.h"
 #include "src/core/lv_refr.h"
+#include "src/core/lv_obj_bitmap_cache.h"
 #include "src/core/lv_observer.h"
 #include "src/indev/lv_indev.h"
 #include "src/indev/lv_indev_gesture.h"
@@ -77,6 +78,7 @@ extern "C" {
 #include "src/widgets/lottie/lv_lottie.h"
 #include "src/widgets/menu/lv_menu.h"
 #include "src/widgets/msgbox/lv_msgbox.h"
+#include "src/widgets/recyclerview/lv_recyclerview.h"
 #include "src/widgets/roller/lv_roller.h"
 #include "src/widgets/scale/lv_scale.h"
 #include "src/widgets/slider/lv_slider.h"
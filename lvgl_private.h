@@ -29,6 +29,7 @@ extern "C" {
 #include "src/libs/barcode/lv_barcode_private.h"
 #include "src/draw/lv_draw_triangle_private.h"
 #include "src/draw/lv_draw_private.h"
+#include "src/draw/lv_draw_display_list_private.h"
 #include "src/draw/lv_draw_rect_private.h"
 #include "src/draw/lv_draw_image_private.h"
 #include "src/draw/lv_image_decoder_private.h"
@@ -44,6 +45,9 @@ extern "C" {
 #include "src/drivers/evdev/lv_evdev_private.h"
 #include "src/themes/lv_theme_private.h"
 #include "src/core/lv_refr_private.h"
+#include "src/core/lv_obj_bitmap_cache_private.h"
+#include "src/core/lv_obj_pool_private.h"
+#include "src/core/lv_obj_hit_index_private.h"
 #include "src/core/lv_obj_style_private.h"
 #include "src/core/lv_obj_private.h"
 #include "src/core/lv_obj_scroll_private.h"
@@ -101,6 +105,7 @@ extern "C" {
 #include "src/widgets/tabview/lv_tabview_private.h"
 #include "src/widgets/3dtexture/lv_3dtexture_private.h"
 #include "src/widgets/ime/lv_ime_pinyin_private.h"
+#include "src/widgets/recyclerview/lv_recyclerview_private.h"
 
 #include "src/tick/lv_tick_private.h"
 #include "src/stdlib/builtin/lv_tlsf_private.h"
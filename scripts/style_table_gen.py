@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+
+"""
+Generate the property tables of styles (`lv_style_prop_table_t`).
+
+The properties are collected from
+ - `lv_style_set_<prop>(&theme->styles.<name>, ...)` and `style_init_reset(&theme->styles.<name>, ...)` calls.
+   The generated `<name>_prop_table` can be passed to `lv_style_init_table()`.
+ - `lv_style_const_prop_t <name>[] = { LV_STYLE_CONST_<PROP>(...), ... }` arrays.
+   The generated `<name>_table` can be passed to `LV_STYLE_CONST_TABLE_INIT()`.
+
+The tables are written to `<source>_style_tables.h` next to each source file.
+
+Usage:
+    style_table_gen.py [source.c ...]
+Without arguments the built-in themes are processed.
+"""
+
+import os
+import re
+import sys
+
+base_dir = os.path.abspath(os.path.dirname(__file__))
+style_h_path = os.path.join(base_dir, '..', 'src', 'misc', 'lv_style.h')
+
+default_sources = [
+    os.path.join(base_dir, '..', 'src', 'themes', 'default', 'lv_theme_default.c'),
+    os.path.join(base_dir, '..', 'src', 'themes', 'mono', 'lv_theme_mono.c'),
+    os.path.join(base_dir, '..', 'src', 'themes', 'simple', 'lv_theme_simple.c'),
+]
+
+set_re = re.compile(r'lv_style_set_(\w+)\(\s*&theme->styles\.(\w+)\s*,')
+reset_re = re.compile(r'style_init_reset\(\s*&theme->styles\.(\w+)\s*,')
+const_array_re = re.compile(r'lv_style_const_prop_t\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\};', re.S)
+const_prop_re = re.compile(r'LV_STYLE_CONST_(\w+)\s*\(')
+
+
+def load_style_h():
+    with open(style_h_path) as f:
+        src = f.read()
+
+    prop_ids = set(re.findall(r'^\s*(LV_STYLE_\w+)\s*(?:=\s*\d+\s*)?,', src, re.M))
+
+    # Setters setting more properties, e.g. `lv_style_set_pad_all()`
+    compound = {}
+    for name, body in re.findall(r'static inline void lv_style_set_(\w+)\(lv_style_t \* style[^)]*\)\s*\{(.*?)\n\}',
+                                 src, re.S):
+        compound[name] = re.findall(r'lv_style_set_(\w+)\(style', body)
+
+    return prop_ids, compound
+
+
+def expand(name, compound):
+    if name in compound:
+        props = []
+        for n in compound[name]:
+            props += expand(n, compound)
+        return props
+    return ['LV_STYLE_' + name.upper()]
+
+
+def add_prop(tables, name, prop, prop_ids, path):
+    if prop not in prop_ids:
+        sys.exit(f'{path}: unknown style property {prop} in {name}')
+    if prop not in tables[name]:
+        tables[name].append(prop)
+
+
+def collect(path, prop_ids, compound):
+    with open(path) as f:
+        src = f.read()
+
+    # Keep the order of the first appearance
+    tables = {}
+    for m in re.finditer(f'{set_re.pattern}|{reset_re.pattern}', src):
+        if m.group(1):
+            tables.setdefault(m.group(2), [])
+            for prop in expand(m.group(1), compound):
+                add_prop(tables, m.group(2), prop, prop_ids, path)
+        else:
+            tables.setdefault(m.group(3), [])
+
+    const_tables = {}
+    for name, body in const_array_re.findall(src):
+        const_tables[name] = []
+        for prop in const_prop_re.findall(body):
+            prop = 'LV_STYLE_' + prop
+            if prop in const_tables[name]:
+                sys.exit(f'{path}: {prop} is set twice in {name}')
+            add_prop(const_tables, name, prop, prop_ids, path)
+
+    return tables, const_tables
+
+
+def table_c(name, props, const_props):
+    out = []
+    if props:
+        out.append(f'static const lv_style_prop_t {name}_props[] = {{')
+        for i in range(0, len(props), 4):
+            out.append('    ' + ' '.join(p + ',' for p in props[i:i + 4]))
+        out.append('};')
+        out.append('')
+
+    table_name = f'{name}_table' if const_props else f'{name}_prop_table'
+    out.append(f'static const lv_style_prop_table_t {table_name} = {{')
+    out.append(f'    .props = {name + "_props" if props else "NULL"},')
+    out.append(f'    .const_props = {name if const_props else "NULL"},')
+    out.append(f'    .prop_cnt = {len(props)},')
+    if props:
+        out.append('    .prop_index = {')
+        for i, p in enumerate(props):
+            out.append(f'        [{p}] = {i + 1},')
+        out.append('    },')
+    else:
+        out.append('    .prop_index = {0},')
+    out.append('};')
+    out.append('')
+    return out
+
+
+def write(path, tables, const_tables):
+    base = os.path.splitext(os.path.basename(path))[0]
+    out_path = os.path.join(os.path.dirname(path), base + '_style_tables.h')
+    guard = base.upper() + '_STYLE_TABLES_H'
+
+    out = [
+        '/*',
+        ' **********************************************************************',
+        ' *                            DO NOT EDIT',
+        f' * This file is automatically generated by "{os.path.split(__file__)[-1]}"',
+        f' * from "{os.path.basename(path)}"',
+        ' **********************************************************************',
+        ' */',
+        '',
+        f'#ifndef {guard}',
+        f'#define {guard}',
+        '',
+    ]
+
+    for name, props in tables.items():
+        out += table_c(name, props, False)
+
+    for name, props in const_tables.items():
+        out += table_c(name, props, True)
+
+    out.append(f'#endif /*{guard}*/')
+
+    with open(out_path, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+def main():
+    prop_ids, compound = load_style_h()
+    sources = sys.argv[1:] if len(sys.argv) > 1 else default_sources
+    for path in sources:
+        tables, const_tables = collect(path, prop_ids, compound)
+        write(path, tables, const_tables)
+
+
+if __name__ == '__main__':
+    main()
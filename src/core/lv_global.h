@@ -22,6 +22,7 @@ extern "C" {
 #endif
 #include "../misc/lv_anim.h"
 #include "../misc/lv_area.h"
+#include "../misc/lv_array.h"
 #include "../misc/lv_color_op.h"
 #include "../misc/lv_ll.h"
 #include "../misc/lv_log.h"
@@ -45,6 +46,7 @@ extern "C" {
 #include "../tick/lv_tick_private.h"
 #include "../draw/lv_draw_buf_private.h"
 #include "../draw/lv_draw_private.h"
+#include "lv_obj_pool_private.h"
 #include "../draw/sw/lv_draw_sw_private.h"
 #include "../draw/sw/lv_draw_sw_mask_private.h"
 #include "../stdlib/builtin/lv_tlsf_private.h"
@@ -93,11 +95,28 @@ typedef struct _lv_global_t {
     lv_display_t * disp_refresh;
     lv_display_t * disp_default;
 
-    lv_ll_t style_trans_ll;
+#if LV_OBJ_POOL_CHUNK_SIZE
+    lv_slab_t obj_pools[LV_OBJ_POOL_CLASS_CNT]; /**< Widgets and their data by size classes*/
+#endif
+
+    lv_obj_bulk_delete_t * obj_bulk_delete; /**< The innermost bulk delete in progress*/
+#if LV_USE_ANIM_BATCH
+    lv_obj_inv_batch_t * obj_inv_batch;     /**< The innermost invalidation batch in progress*/
+#endif
+
+    lv_ilist_t style_trans_list;
+#if LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    lv_slab_t style_trans_pool;
+#endif
     bool style_refresh;
     uint32_t style_custom_table_size;
     uint32_t style_last_custom_prop_id;
     uint8_t * style_custom_prop_flag_lookup_table;
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    uint32_t style_value_cache_size;
+    uint32_t style_value_cache_hit_cnt;
+    uint32_t style_value_cache_miss_cnt;
+#endif
 
     lv_ll_t group_ll;
     lv_group_t * group_default;
@@ -134,6 +153,9 @@ typedef struct _lv_global_t {
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
 
+    lv_cache_t * obj_bitmap_cache;
+    lv_array_t obj_bitmap_cache_used;   /**< Entries of the bitmaps used by the draw tasks being rendered */
+
     lv_draw_global_info_t draw_info;
     lv_ll_t draw_sw_blend_handler_ll;
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
@@ -7,11 +7,13 @@
  *      INCLUDES
  *********************/
 #include "lv_obj_private.h"
+#include "lv_obj_hit_index_private.h"
 #include "../misc/lv_event_private.h"
 #include "../misc/lv_area_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_event_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_pool_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
 #include "lv_refr.h"
@@ -27,6 +29,8 @@
 #include "../tick/lv_tick.h"
 #include "../stdlib/lv_string.h"
 #include "lv_obj_draw_private.h"
+#include "../draw/lv_draw_display_list_private.h"
+#include "lv_obj_bitmap_cache_private.h"
 
 /*********************
  *      DEFINES
@@ -263,6 +267,10 @@ void lv_obj_add_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     obj->flags |= f;
 
+    if(f & (LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING | LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        lv_obj_hit_index_children_changed(obj->parent);
+    }
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         if(lv_obj_has_state(obj, LV_STATE_FOCUSED)) {
             lv_group_t * group = lv_obj_get_group(obj);
@@ -305,6 +313,10 @@ void lv_obj_remove_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     obj->flags &= (~f);
 
+    if(f & (LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING | LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        lv_obj_hit_index_children_changed(obj->parent);
+    }
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         lv_obj_invalidate(obj);
         lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
@@ -315,6 +327,12 @@ void lv_obj_remove_flag(lv_obj_t * obj, lv_obj_flag_t f)
         lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
     }
 
+    if((f & LV_OBJ_FLAG_DISPLAY_LIST) && obj->spec_attr) {
+        lv_draw_display_list_delete(obj->spec_attr->display_list);
+        obj->spec_attr->display_list = NULL;
+    }
+
+    if(f & LV_OBJ_FLAG_CACHE_BITMAP) lv_obj_bitmap_cache_drop(obj);
 }
 
 void lv_obj_set_flag(lv_obj_t * obj, lv_obj_flag_t f, bool v)
@@ -404,7 +422,7 @@ void lv_obj_allocate_spec_attr(lv_obj_t * obj)
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     if(obj->spec_attr == NULL) {
-        obj->spec_attr = lv_malloc_zeroed(sizeof(lv_obj_spec_attr_t));
+        obj->spec_attr = lv_obj_pool_alloc(sizeof(lv_obj_spec_attr_t));
         LV_ASSERT_MALLOC(obj->spec_attr);
         if(obj->spec_attr == NULL) return;
 
@@ -598,13 +616,15 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_obj_remove_style_all(obj);
     lv_obj_enable_style_refresh(true);
 
-    /*Remove the animations from this object*/
-    lv_anim_delete(obj, NULL);
+    /*Remove the animations from this object. Bulk deletes remove them for all objects at once.*/
+    if(!lv_obj_is_bulk_deleted(obj)) lv_anim_delete(obj, NULL);
 
     /*Delete from the group*/
     lv_group_t * group = lv_obj_get_group(obj);
     if(group) lv_group_remove_obj(obj);
 
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_CACHE_BITMAP)) lv_obj_bitmap_cache_drop(obj);
+
     if(obj->spec_attr) {
         if(obj->spec_attr->children) {
             lv_free(obj->spec_attr->children);
@@ -625,13 +645,20 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
         }
 #endif
 
-        lv_free(obj->spec_attr);
+        lv_draw_display_list_delete(obj->spec_attr->display_list);
+#if LV_OBJ_HIT_INDEX_MIN_CHILDREN
+        lv_obj_hit_index_delete(obj->spec_attr->hit_index);
+#endif
+
+        lv_obj_pool_free(obj->spec_attr, sizeof(lv_obj_spec_attr_t));
         obj->spec_attr = NULL;
     }
 
 #if LV_OBJ_ID_AUTO_ASSIGN
     lv_obj_free_id(obj);
 #endif
+
+    lv_obj_style_value_cache_free(obj);
 }
 
 static void lv_obj_draw(lv_event_t * e)
@@ -1264,7 +1291,7 @@ static lv_result_t lv_obj_set_any(lv_obj_t * obj, lv_prop_id_t id, const lv_prop
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     if(id >= LV_PROPERTY_OBJ_FLAG_START && id <= LV_PROPERTY_OBJ_FLAG_END) {
-        lv_obj_flag_t flag = 1L << (id - LV_PROPERTY_OBJ_FLAG_START);
+        lv_obj_flag_t flag = (lv_obj_flag_t)(1UL << (id - LV_PROPERTY_OBJ_FLAG_START));
         if(prop->num) lv_obj_add_flag(obj, flag);
         else lv_obj_remove_flag(obj, flag);
         return LV_RESULT_OK;
@@ -1288,7 +1315,7 @@ static lv_result_t lv_obj_get_any(const lv_obj_t * obj, lv_prop_id_t id, lv_prop
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
     if(id >= LV_PROPERTY_OBJ_FLAG_START && id <= LV_PROPERTY_OBJ_FLAG_END) {
-        lv_obj_flag_t flag = 1L << (id - LV_PROPERTY_OBJ_FLAG_START);
+        lv_obj_flag_t flag = (lv_obj_flag_t)(1UL << (id - LV_PROPERTY_OBJ_FLAG_START));
         prop->id = id;
         prop->num = obj->flags & flag;
         return LV_RESULT_OK;
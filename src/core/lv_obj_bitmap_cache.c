@@ -0,0 +1,248 @@
+/**
+ * @file lv_obj_bitmap_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj_bitmap_cache_private.h"
+#include "lv_obj_private.h"
+#include "lv_obj_draw_private.h"
+#include "lv_refr_private.h"
+#include "lv_global.h"
+#include "../draw/lv_draw_private.h"
+#include "../draw/lv_draw_image.h"
+#include "../misc/cache/lv_cache.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define CACHE_NAME  "OBJ_BITMAP"
+
+#define bitmap_cache_p (LV_GLOBAL_DEFAULT()->obj_bitmap_cache)
+#define used_entries_p (&LV_GLOBAL_DEFAULT()->obj_bitmap_cache_used)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_cache_compare_res_t bitmap_cache_compare_cb(const lv_obj_bitmap_cache_data_t * lhs,
+                                                      const lv_obj_bitmap_cache_data_t * rhs);
+static void bitmap_cache_free_cb(lv_obj_bitmap_cache_data_t * data, void * user_data);
+static lv_cache_entry_t * bitmap_create(lv_layer_t * layer, lv_obj_t * obj, const lv_area_t * area);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_obj_bitmap_cache_init(uint32_t size)
+{
+    if(bitmap_cache_p != NULL) return;
+
+    bitmap_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(lv_obj_bitmap_cache_data_t), size, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) bitmap_cache_compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t) bitmap_cache_free_cb,
+    });
+
+    lv_cache_set_name(bitmap_cache_p, CACHE_NAME);
+    lv_array_init(used_entries_p, 4, sizeof(lv_cache_entry_t *));
+}
+
+void lv_obj_bitmap_cache_deinit(void)
+{
+    if(bitmap_cache_p == NULL) return;
+
+    lv_obj_bitmap_cache_release_used();
+    lv_array_deinit(used_entries_p);
+
+    lv_cache_destroy(bitmap_cache_p, NULL);
+    bitmap_cache_p = NULL;
+}
+
+void lv_obj_bitmap_cache_resize(uint32_t new_size, bool evict_now)
+{
+    lv_cache_set_max_size(bitmap_cache_p, new_size, NULL);
+    if(evict_now) {
+        lv_cache_reserve(bitmap_cache_p, new_size, NULL);
+    }
+}
+
+void lv_obj_bitmap_cache_drop(const lv_obj_t * obj)
+{
+    if(bitmap_cache_p == NULL) return;
+
+    if(obj == NULL) {
+        lv_cache_drop_all(bitmap_cache_p, NULL);
+        return;
+    }
+
+    lv_obj_bitmap_cache_data_t search_key;
+    search_key.obj = obj;
+    lv_cache_drop(bitmap_cache_p, &search_key, NULL);
+}
+
+bool lv_obj_bitmap_cache_is_enabled(void)
+{
+    return lv_cache_is_enabled(bitmap_cache_p);
+}
+
+uint32_t lv_obj_bitmap_cache_get_size(void)
+{
+    return lv_cache_get_size(bitmap_cache_p, NULL);
+}
+
+lv_result_t lv_obj_bitmap_cache_draw(lv_layer_t * layer, lv_obj_t * obj)
+{
+    if(!lv_cache_is_enabled(bitmap_cache_p)) return LV_RESULT_INVALID;
+
+    LV_PROFILER_REFR_BEGIN;
+
+    lv_area_t obj_draw_area;
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+    lv_obj_get_coords(obj, &obj_draw_area);
+    lv_area_increase(&obj_draw_area, ext_draw_size, ext_draw_size);
+
+    lv_obj_bitmap_cache_data_t search_key;
+    search_key.obj = obj;
+    lv_cache_entry_t * entry = lv_cache_acquire(bitmap_cache_p, &search_key, NULL);
+    if(entry) {
+        /*The bitmap can't be used if it was rendered with different layer settings*/
+        lv_obj_bitmap_cache_data_t * data = lv_cache_entry_get_data(entry);
+        if(data->opa != layer->opa || lv_color32_eq(data->recolor, layer->recolor) == false ||
+           data->draw_buf->header.w != lv_area_get_width(&obj_draw_area) ||
+           data->draw_buf->header.h != lv_area_get_height(&obj_draw_area)) {
+            /*If it's used in other draw tasks it will be freed when released*/
+            lv_cache_drop(bitmap_cache_p, &search_key, NULL);
+            lv_cache_release(bitmap_cache_p, entry, NULL);
+            entry = NULL;
+        }
+        else {
+            lv_draw_image_dsc_t draw_dsc;
+            lv_draw_image_dsc_init(&draw_dsc);
+            draw_dsc.base.obj = obj;
+            draw_dsc.src = data->draw_buf;
+            lv_draw_image(layer, &draw_dsc, &obj_draw_area);
+        }
+    }
+
+    if(entry == NULL) {
+        entry = bitmap_create(layer, obj, &obj_draw_area);
+        if(entry == NULL) {
+            LV_PROFILER_REFR_END;
+            return LV_RESULT_INVALID;
+        }
+    }
+
+    /*Keep the entry until the draw tasks using the bitmap are finished*/
+    lv_array_push_back(used_entries_p, &entry);
+
+    LV_PROFILER_REFR_END;
+    return LV_RESULT_OK;
+}
+
+void lv_obj_bitmap_cache_release_used(void)
+{
+    if(bitmap_cache_p == NULL) return;
+
+    uint32_t i;
+    uint32_t used_cnt = lv_array_size(used_entries_p);
+    for(i = 0; i < used_cnt; i++) {
+        lv_cache_entry_t ** entry = lv_array_at(used_entries_p, i);
+        lv_cache_release(bitmap_cache_p, *entry, NULL);
+    }
+
+    lv_array_clear(used_entries_p);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_cache_compare_res_t bitmap_cache_compare_cb(const lv_obj_bitmap_cache_data_t * lhs,
+                                                      const lv_obj_bitmap_cache_data_t * rhs)
+{
+    if(lhs->obj == rhs->obj) return 0;
+    return lhs->obj > rhs->obj ? 1 : -1;
+}
+
+static void bitmap_cache_free_cb(lv_obj_bitmap_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    if(data->draw_buf == NULL) return;
+
+    /*The draw units might have cached resources for this buffer*/
+    lv_image_cache_drop(data->draw_buf);
+    lv_draw_buf_destroy(data->draw_buf);
+    data->draw_buf = NULL;
+}
+
+/**
+ * Render a widget into a new bitmap, add it to the cache, and draw it on the layer
+ * @param layer     the layer to draw to
+ * @param obj       pointer to a widget
+ * @param area      the area of the widget including the extra draw size
+ * @return          the acquired cache entry or NULL if the bitmap couldn't be created
+ */
+static lv_cache_entry_t * bitmap_create(lv_layer_t * layer, lv_obj_t * obj, const lv_area_t * area)
+{
+    int32_t w = lv_area_get_width(area);
+    int32_t h = lv_area_get_height(area);
+
+    lv_obj_bitmap_cache_data_t search_key;
+    search_key.slot.size = h * lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_ARGB8888);
+    search_key.obj = obj;
+    search_key.draw_buf = NULL;
+    search_key.opa = layer->opa;
+    search_key.recolor = layer->recolor;
+
+    /*Widgets larger than the whole budget are drawn as usual*/
+    if(search_key.slot.size > lv_cache_get_max_size(bitmap_cache_p, NULL)) return NULL;
+
+    /*Add the entry first, so that the least recently used bitmaps are freed before allocating the new one*/
+    lv_cache_entry_t * entry = lv_cache_add(bitmap_cache_p, &search_key, NULL);
+    if(entry == NULL) return NULL;
+
+    lv_obj_bitmap_cache_data_t * data = lv_cache_entry_get_data(entry);
+    data->draw_buf = lv_draw_buf_create(w, h, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    lv_layer_t * new_layer = NULL;
+    if(data->draw_buf) new_layer = lv_draw_layer_create(layer, LV_COLOR_FORMAT_ARGB8888, area);
+
+    if(new_layer == NULL) {
+        LV_LOG_WARN("Couldn't allocate the bitmap of the widget");
+        lv_cache_drop(bitmap_cache_p, &search_key, NULL);
+        lv_cache_release(bitmap_cache_p, entry, NULL);
+        return NULL;
+    }
+
+    /*Render the whole widget into the bitmap regardless of the current clip area,
+     *so that it can be used for any area later*/
+    lv_draw_buf_clear(data->draw_buf, NULL);
+    new_layer->draw_buf = data->draw_buf;
+    new_layer->keep_draw_buf = true;
+    lv_obj_redraw(new_layer, obj);
+
+    lv_draw_image_dsc_t layer_draw_dsc;
+    lv_draw_image_dsc_init(&layer_draw_dsc);
+    layer_draw_dsc.base.obj = obj;
+    layer_draw_dsc.src = new_layer;
+    lv_draw_layer(layer, &layer_draw_dsc, area);
+
+    return entry;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file lv_obj_bitmap_cache.h
+ *
+ */
+
+#ifndef LV_OBJ_BITMAP_CACHE_H
+#define LV_OBJ_BITMAP_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../misc/lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Set the memory budget of the bitmaps of the widgets with `LV_OBJ_FLAG_CACHE_BITMAP`.
+ * If the budget is exceeded the least recently used bitmaps are freed.
+ * @param new_size      the new budget in bytes. 0 disables caching the widgets as bitmaps.
+ * @param evict_now     true: free bitmaps right now to fit into the new budget
+ */
+void lv_obj_bitmap_cache_resize(uint32_t new_size, bool evict_now);
+
+/**
+ * Free the cached bitmap of a widget. It will be rendered again when it's drawn the next time.
+ * Normally it's not required to call it as the bitmap is dropped when the widget is invalidated.
+ * @param obj       pointer to a widget, or NULL to free all the cached bitmaps
+ */
+void lv_obj_bitmap_cache_drop(const lv_obj_t * obj);
+
+/**
+ * Check if widgets can be cached as bitmaps, i.e. the budget is not 0
+ * @return          true: caching widgets as bitmaps is enabled
+ */
+bool lv_obj_bitmap_cache_is_enabled(void);
+
+/**
+ * Get the memory used by the cached bitmaps
+ * @return          the size of the cached bitmaps in bytes
+ */
+uint32_t lv_obj_bitmap_cache_get_size(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_BITMAP_CACHE_H*/
@@ -0,0 +1,82 @@
+/**
+ * @file lv_obj_bitmap_cache_private.h
+ *
+ */
+
+#ifndef LV_OBJ_BITMAP_CACHE_PRIVATE_H
+#define LV_OBJ_BITMAP_CACHE_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_obj_bitmap_cache.h"
+#include "../misc/cache/lv_cache_private.h"
+#include "../misc/lv_color.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_cache_slot_size_t slot;
+
+    /** The widget rendered into the bitmap. Also the key of the cache entry. */
+    const lv_obj_t * obj;
+
+    /** ARGB8888 bitmap of the widget including its extra draw size */
+    lv_draw_buf_t * draw_buf;
+
+    /** Opacity and recolor of the layer when the bitmap was rendered, as they are applied in the bitmap too */
+    lv_opa_t opa;
+    lv_color32_t recolor;
+} lv_obj_bitmap_cache_data_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create the cache for the bitmaps of the widgets
+ * @param size      the memory budget in bytes
+ */
+void lv_obj_bitmap_cache_init(uint32_t size);
+
+/**
+ * Free all the cached bitmaps and delete the cache
+ */
+void lv_obj_bitmap_cache_deinit(void);
+
+/**
+ * Draw a widget with `LV_OBJ_FLAG_CACHE_BITMAP` from its cached bitmap.
+ * If there is no bitmap yet, render the widget into a new one and draw that.
+ * @param layer     the layer to draw to
+ * @param obj       pointer to a widget
+ * @return          LV_RESULT_OK: the widget is drawn,
+ *                  LV_RESULT_INVALID: the widget can't be cached, draw it as usual
+ */
+lv_result_t lv_obj_bitmap_cache_draw(lv_layer_t * layer, lv_obj_t * obj);
+
+/**
+ * Let the bitmaps used during rendering to be freed again.
+ * Call it when all the draw tasks are finished.
+ */
+void lv_obj_bitmap_cache_release_used(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_BITMAP_CACHE_PRIVATE_H*/
@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj_class_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_pool_private.h"
 #include "../themes/lv_theme.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
@@ -30,7 +31,6 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_obj_construct(const lv_obj_class_t * class_p, lv_obj_t * obj);
-static uint32_t get_instance_size(const lv_obj_class_t * class_p);
 
 /**********************
  *  STATIC VARIABLES
@@ -47,8 +47,8 @@ static uint32_t get_instance_size(const lv_obj_class_t * class_p);
 lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * parent)
 {
     LV_TRACE_OBJ_CREATE("Creating object with %p class on %p parent", (void *)class_p, (void *)parent);
-    uint32_t s = get_instance_size(class_p);
-    lv_obj_t * obj = lv_malloc_zeroed(s);
+    uint32_t s = lv_obj_class_get_instance_size(class_p);
+    lv_obj_t * obj = lv_obj_pool_alloc(s);
     if(obj == NULL) return NULL;
     obj->class_p = class_p;
     obj->parent = parent;
@@ -59,7 +59,7 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
         lv_display_t * disp = lv_display_get_default();
         if(!disp) {
             LV_LOG_WARN("No display created yet. No place to assign the new screen");
-            lv_free(obj);
+            lv_obj_pool_free(obj, s);
             return NULL;
         }
 
@@ -70,7 +70,7 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
         lv_obj_t ** screens = lv_realloc(disp->screens, sizeof(lv_obj_t *) * (disp->screen_cnt + 1));
         LV_ASSERT_MALLOC(screens);
         if(screens == NULL) {
-            lv_free(obj);
+            lv_obj_pool_free(obj, s);
             return NULL;
         }
 
@@ -92,10 +92,10 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
             lv_obj_allocate_spec_attr(parent);
         }
 
-        parent->spec_attr->child_cnt++;
-        parent->spec_attr->children = lv_realloc(parent->spec_attr->children,
-                                                 sizeof(lv_obj_t *) * parent->spec_attr->child_cnt);
-        parent->spec_attr->children[parent->spec_attr->child_cnt - 1] = obj;
+        if(lv_obj_children_append(parent, obj) != LV_RESULT_OK) {
+            lv_obj_pool_free(obj, s);
+            return NULL;
+        }
     }
 
     return obj;
@@ -177,6 +177,17 @@ bool lv_obj_is_group_def(lv_obj_t * obj)
     return class_p->group_def == LV_OBJ_CLASS_GROUP_DEF_TRUE;
 }
 
+uint32_t lv_obj_class_get_instance_size(const lv_obj_class_t * class_p)
+{
+    /*Find a base in which instance size is set*/
+    const lv_obj_class_t * base = class_p;
+    while(base && base->instance_size == 0) base = base->base_class;
+
+    if(base == NULL) return 0;  /*Never happens: set at least in `lv_obj` class*/
+
+    return base->instance_size;
+}
+
 #if LV_USE_EXT_DATA
 void lv_obj_set_external_data(lv_obj_t * obj, void * data, void (* free_cb)(void * data))
 {
@@ -218,14 +229,3 @@ static void lv_obj_construct(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     if(obj->class_p->constructor_cb) obj->class_p->constructor_cb(class_p, obj);
 }
-
-static uint32_t get_instance_size(const lv_obj_class_t * class_p)
-{
-    /*Find a base in which instance size is set*/
-    const lv_obj_class_t * base = class_p;
-    while(base && base->instance_size == 0) base = base->base_class;
-
-    if(base == NULL) return 0;  /*Never happens: set at least in `lv_obj` class*/
-
-    return base->instance_size;
-}
@@ -67,6 +67,14 @@ struct _lv_obj_class_t {
 
 void lv_obj_destruct(lv_obj_t * obj);
 
+/**
+ * Get the size of the instances of a class, i.e. the size of the nearest `instance_size`
+ * set in the class or in its base classes
+ * @param class_p   pointer to a class
+ * @return          size of the instances in bytes
+ */
+uint32_t lv_obj_class_get_instance_size(const lv_obj_class_t * class_p);
+
 /**********************
  *      MACROS
  **********************/
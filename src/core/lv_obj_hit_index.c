@@ -0,0 +1,353 @@
+/**
+ * @file lv_obj_hit_index.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj_hit_index_private.h"
+
+#if LV_OBJ_HIT_INDEX_MIN_CHILDREN
+
+#include "lv_obj_draw_private.h"
+#include "../indev/lv_indev.h"
+#include "../misc/lv_area_private.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_math.h"
+#include "../stdlib/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static bool build(lv_obj_t * obj, lv_obj_hit_index_t * index);
+static void free_arrays(lv_obj_hit_index_t * index);
+static bool get_cells(const lv_obj_hit_index_t * index, const lv_area_t * area, lv_area_t * cells);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_obj_hit_index_search(lv_obj_t * obj, lv_point_t * point, lv_obj_t ** found)
+{
+    *found = NULL;
+
+    lv_obj_spec_attr_t * attr = obj->spec_attr;
+    lv_obj_hit_index_t * index = attr->hit_index;
+    if(index == NULL) {
+        index = lv_malloc_zeroed(sizeof(lv_obj_hit_index_t));
+        LV_ASSERT_MALLOC(index);
+        if(index == NULL) return LV_RESULT_INVALID;
+        index->stable = 1;
+        attr->hit_index = index;
+    }
+
+    if(!index->valid) {
+        /*Don't build the index while the children keep changing (e.g. they are animated)
+         *as it would be used only once. Build it if they haven't changed since the last search.*/
+        if(!index->stable) {
+            index->stable = 1;
+            return LV_RESULT_INVALID;
+        }
+
+        if(!build(obj, index)) return LV_RESULT_INVALID;
+    }
+
+    lv_point_t p;
+    p.x = point->x - obj->coords.x1 - attr->scroll.x;
+    p.y = point->y - obj->coords.y1 - attr->scroll.y;
+
+    const uint32_t * cell_items = NULL;
+    uint32_t cell_item_cnt = 0;
+    if(lv_area_is_point_on(&index->grid_area, &p, 0)) {
+        uint32_t col = (uint32_t)((p.x - index->grid_area.x1) / index->cell_w);
+        uint32_t row = (uint32_t)((p.y - index->grid_area.y1) / index->cell_h);
+        uint32_t cell = row * index->col_cnt + col;
+        cell_items = &index->items[index->cell_start[cell]];
+        cell_item_cnt = index->cell_start[cell + 1] - index->cell_start[cell];
+    }
+
+    /*Check the children of the cell and the ones to check always from the top,
+     *like when all the children are checked*/
+    index->searching = 1;
+    uint32_t a = index->always_cnt;
+    uint32_t c = cell_item_cnt;
+    while(a > 0 || c > 0) {
+        uint32_t i;
+        if(c > 0 && (a == 0 || cell_items[c - 1] > index->always[a - 1])) {
+            c--;
+            i = cell_items[c];
+        }
+        else {
+            a--;
+            i = index->always[a];
+        }
+
+        if(!lv_area_is_point_on(&index->bounds[i], &p, 0)) continue;
+
+        /*The event handlers of the hit test might have deleted children*/
+        if(i >= attr->child_cnt) continue;
+
+        *found = lv_indev_search_obj(attr->children[i], point);
+        if(*found) break;
+    }
+    index->searching = 0;
+
+    /*Free the arrays if the children have changed in the meantime*/
+    if(!index->valid) lv_obj_hit_index_invalidate(obj);
+
+    return LV_RESULT_OK;
+}
+
+void lv_obj_hit_index_invalidate(lv_obj_t * obj)
+{
+    lv_obj_spec_attr_t * attr = obj->spec_attr;
+    lv_obj_hit_index_t * index = attr->hit_index;
+
+    index->valid = 0;
+    index->stable = 0;
+    if(index->searching) return;
+
+    if(attr->child_cnt < LV_OBJ_HIT_INDEX_MIN_CHILDREN) {
+        lv_obj_hit_index_delete(index);
+        attr->hit_index = NULL;
+    }
+    else {
+        free_arrays(index);
+    }
+}
+
+void lv_obj_hit_index_delete(lv_obj_hit_index_t * index)
+{
+    if(index == NULL) return;
+
+    free_arrays(index);
+    lv_free(index);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Collect the areas of the children and sort them into the cells of a grid
+ * @param obj       pointer to a widget
+ * @param index     its hit index
+ * @return          true: success; false: out of memory
+ */
+static bool build(lv_obj_t * obj, lv_obj_hit_index_t * index)
+{
+    free_arrays(index);
+
+    lv_obj_spec_attr_t * attr = obj->spec_attr;
+    uint32_t child_cnt = attr->child_cnt;
+    int32_t ofs_x = obj->coords.x1 + attr->scroll.x;
+    int32_t ofs_y = obj->coords.y1 + attr->scroll.y;
+
+    index->bounds = lv_malloc(child_cnt * (sizeof(lv_area_t) + sizeof(uint32_t)));
+    LV_ASSERT_MALLOC(index->bounds);
+    if(index->bounds == NULL) return false;
+    index->always = (uint32_t *)&index->bounds[child_cnt];
+
+    /*Get the area of each child where it or its children can be clicked*/
+    lv_area_t grid_area = {LV_COORD_MAX, LV_COORD_MAX, LV_COORD_MIN, LV_COORD_MIN};
+    int64_t sum_w = 0;
+    int64_t sum_h = 0;
+    uint32_t grid_item_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = attr->children[i];
+        lv_area_t * bounds = &index->bounds[i];
+
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) {
+            lv_area_set(bounds, 0, 0, -1, -1);
+            continue;
+        }
+
+        /*Floating children don't move with the scrolled content and the
+         *transformed ones can be clicked outside of their coordinates*/
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_FLOATING) ||
+           lv_obj_get_layer_type(child) == LV_LAYER_TYPE_TRANSFORM) {
+            lv_area_set(bounds, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MAX, LV_COORD_MAX);
+            continue;
+        }
+
+        lv_area_t child_area = child->coords;
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+            int32_t ext_size = lv_obj_get_ext_draw_size(child);
+            lv_area_increase(&child_area, ext_size, ext_size);
+        }
+        lv_obj_get_click_area(child, bounds);
+        lv_area_join(bounds, bounds, &child_area);
+        if(bounds->x2 < bounds->x1 || bounds->y2 < bounds->y1) {
+            lv_area_set(bounds, 0, 0, -1, -1);
+            continue;
+        }
+        lv_area_move(bounds, -ofs_x, -ofs_y);
+
+        grid_area.x1 = LV_MIN(grid_area.x1, bounds->x1);
+        grid_area.y1 = LV_MIN(grid_area.y1, bounds->y1);
+        grid_area.x2 = LV_MAX(grid_area.x2, bounds->x2);
+        grid_area.y2 = LV_MAX(grid_area.y2, bounds->y2);
+        sum_w += lv_area_get_width(bounds);
+        sum_h += lv_area_get_height(bounds);
+        grid_item_cnt++;
+    }
+
+    /*Have about 2 children per cell but make the cells at least as large as an average child
+     *to add most children only to a few cells*/
+    uint32_t col_cnt = 1;
+    uint32_t row_cnt = 1;
+    int32_t cell_w = 1;
+    int32_t cell_h = 1;
+    if(grid_item_cnt > 0) {
+        int32_t w = lv_area_get_width(&grid_area);
+        int32_t h = lv_area_get_height(&grid_area);
+        uint32_t cell_cnt = LV_MAX(grid_item_cnt / 2, 1);
+        col_cnt = (uint32_t)lv_sqrt32((uint32_t)LV_MIN(((int64_t)cell_cnt * w) / h, UINT32_MAX));
+        col_cnt = LV_CLAMP(1, col_cnt, LV_OBJ_HIT_INDEX_MAX_SIDE);
+        row_cnt = LV_CLAMP(1, cell_cnt / col_cnt, LV_OBJ_HIT_INDEX_MAX_SIDE);
+
+        cell_w = LV_MAX((w + (int32_t)col_cnt - 1) / (int32_t)col_cnt, (int32_t)(sum_w / grid_item_cnt));
+        cell_h = LV_MAX((h + (int32_t)row_cnt - 1) / (int32_t)row_cnt, (int32_t)(sum_h / grid_item_cnt));
+        cell_w = LV_MAX(cell_w, 1);
+        cell_h = LV_MAX(cell_h, 1);
+        col_cnt = (uint32_t)((w + cell_w - 1) / cell_w);
+        row_cnt = (uint32_t)((h + cell_h - 1) / cell_h);
+    }
+    else {
+        lv_area_set(&grid_area, 0, 0, -1, -1);
+    }
+
+    index->grid_area = grid_area;
+    index->cell_w = cell_w;
+    index->cell_h = cell_h;
+    index->col_cnt = col_cnt;
+    index->row_cnt = row_cnt;
+
+    uint32_t cell_cnt = col_cnt * row_cnt;
+    index->cell_start = lv_malloc_zeroed((cell_cnt + 1) * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(index->cell_start);
+    if(index->cell_start == NULL) {
+        free_arrays(index);
+        return false;
+    }
+
+    /*Count the items of the cells and collect the children to check always*/
+    uint32_t item_cnt = 0;
+    index->always_cnt = 0;
+    for(i = 0; i < child_cnt; i++) {
+        const lv_area_t * bounds = &index->bounds[i];
+        if(bounds->x2 < bounds->x1) continue;
+
+        lv_area_t cells;
+        if(!get_cells(index, bounds, &cells)) {
+            index->always[index->always_cnt] = i;
+            index->always_cnt++;
+            continue;
+        }
+
+        int32_t col;
+        int32_t row;
+        for(row = cells.y1; row <= cells.y2; row++) {
+            for(col = cells.x1; col <= cells.x2; col++) {
+                index->cell_start[row * col_cnt + col + 1]++;
+            }
+        }
+        item_cnt += lv_area_get_size(&cells);
+    }
+
+    for(i = 0; i < cell_cnt; i++) {
+        index->cell_start[i + 1] += index->cell_start[i];
+    }
+
+    index->items = lv_malloc(LV_MAX(item_cnt, 1) * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(index->items);
+    if(index->items == NULL) {
+        free_arrays(index);
+        return false;
+    }
+
+    /*Fill the cells in the order of the children. `cell_start[cell]` is used as the
+     *write position of the cell so it ends up at the start of the next cell.*/
+    for(i = 0; i < child_cnt; i++) {
+        const lv_area_t * bounds = &index->bounds[i];
+        if(bounds->x2 < bounds->x1) continue;
+
+        lv_area_t cells;
+        if(!get_cells(index, bounds, &cells)) continue;
+
+        int32_t col;
+        int32_t row;
+        for(row = cells.y1; row <= cells.y2; row++) {
+            for(col = cells.x1; col <= cells.x2; col++) {
+                uint32_t cell = row * col_cnt + col;
+                index->items[index->cell_start[cell]] = i;
+                index->cell_start[cell]++;
+            }
+        }
+    }
+
+    for(i = cell_cnt; i > 0; i--) {
+        index->cell_start[i] = index->cell_start[i - 1];
+    }
+    index->cell_start[0] = 0;
+
+    index->valid = 1;
+    return true;
+}
+
+/**
+ * Free the arrays of a hit index but keep its state
+ * @param index     pointer to a hit index
+ */
+static void free_arrays(lv_obj_hit_index_t * index)
+{
+    /*`always` is allocated together with `bounds`*/
+    lv_free(index->bounds);
+    lv_free(index->cell_start);
+    lv_free(index->items);
+    index->bounds = NULL;
+    index->always = NULL;
+    index->cell_start = NULL;
+    index->items = NULL;
+    index->always_cnt = 0;
+}
+
+/**
+ * Get the columns and rows of the cells an area overlaps
+ * @param index     pointer to a hit index
+ * @param area      an area relative to the scrolled content
+ * @param cells     store the first and last column and row here
+ * @return          true: the area can be added to the cells; false: it should be checked always
+ */
+static bool get_cells(const lv_obj_hit_index_t * index, const lv_area_t * area, lv_area_t * cells)
+{
+    if(!lv_area_is_in(area, &index->grid_area, 0)) return false;
+
+    cells->x1 = (area->x1 - index->grid_area.x1) / index->cell_w;
+    cells->y1 = (area->y1 - index->grid_area.y1) / index->cell_h;
+    cells->x2 = (area->x2 - index->grid_area.x1) / index->cell_w;
+    cells->y2 = (area->y2 - index->grid_area.y1) / index->cell_h;
+
+    return lv_area_get_size(cells) <= LV_OBJ_HIT_INDEX_MAX_ITEM_CELLS;
+}
+
+#endif /*LV_OBJ_HIT_INDEX_MIN_CHILDREN*/
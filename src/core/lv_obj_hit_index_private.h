@@ -0,0 +1,103 @@
+/**
+ * @file lv_obj_hit_index_private.h
+ *
+ */
+
+#ifndef LV_OBJ_HIT_INDEX_PRIVATE_H
+#define LV_OBJ_HIT_INDEX_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_obj_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** Children covering more cells than this are hit tested for any point*/
+#define LV_OBJ_HIT_INDEX_MAX_ITEM_CELLS     64
+
+/** Maximal number of columns and rows of the grid*/
+#define LV_OBJ_HIT_INDEX_MAX_SIDE           128
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * A grid over the children of a widget to find the children under a point quickly.
+ * The areas are stored relative to the scrolled content of the widget,
+ * so scrolling and moving the widget doesn't change them.
+ */
+struct _lv_obj_hit_index_t {
+    lv_area_t * bounds;         /**< The area where each child or its children can be clicked*/
+    uint32_t * always;          /**< Indices of the children to check for any point in increasing order*/
+    uint32_t * cell_start;      /**< Index of the first item of each cell in `items`, plus the total item count*/
+    uint32_t * items;           /**< Indices of the children overlapping each cell in increasing order*/
+    lv_area_t grid_area;        /**< The area covered by the cells*/
+    int32_t cell_w;
+    int32_t cell_h;
+    uint32_t col_cnt;
+    uint32_t row_cnt;
+    uint32_t always_cnt;        /**< Number of elements in `always`*/
+    uint8_t valid : 1;          /**< The arrays reflect the current children*/
+    uint8_t stable : 1;         /**< The children haven't changed since the last search*/
+    uint8_t searching : 1;      /**< A search is in progress, so don't free the arrays*/
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Find the clicked widget among the children of a widget using its hit index.
+ * The index is created or updated if needed.
+ * @param obj       pointer to a widget with at least `LV_OBJ_HIT_INDEX_MIN_CHILDREN` children
+ * @param point     the point in the coordinate system of the children (already transformed by `obj`)
+ * @param found     store the found widget here, or NULL if none of the children was clicked
+ * @return          LV_RESULT_OK: `found` is set;
+ *                  LV_RESULT_INVALID: the index can't be used now, check the children one by one
+ */
+lv_result_t lv_obj_hit_index_search(lv_obj_t * obj, lv_point_t * point, lv_obj_t ** found);
+
+/**
+ * Mark the hit index of a widget as outdated, e.g. because a child was added, moved or hidden.
+ * @param obj       pointer to a widget with a hit index
+ */
+void lv_obj_hit_index_invalidate(lv_obj_t * obj);
+
+/**
+ * Free a hit index
+ * @param index     pointer to a hit index. Can be NULL.
+ */
+void lv_obj_hit_index_delete(lv_obj_hit_index_t * index);
+
+/**
+ * Mark the hit index of a widget as outdated if it has one.
+ * Call it when children are added, removed or reordered, or the click area of a child might have changed.
+ * @param obj       pointer to a widget. Can be NULL.
+ */
+static inline void lv_obj_hit_index_children_changed(lv_obj_t * obj)
+{
+#if LV_OBJ_HIT_INDEX_MIN_CHILDREN
+    if(obj && obj->spec_attr && obj->spec_attr->hit_index) lv_obj_hit_index_invalidate(obj);
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_HIT_INDEX_PRIVATE_H*/
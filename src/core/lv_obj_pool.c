@@ -0,0 +1,151 @@
+/**
+ * @file lv_obj_pool.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj_pool_private.h"
+#include "lv_global.h"
+#include "../misc/lv_math.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define pools (LV_GLOBAL_DEFAULT()->obj_pools)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+#if LV_OBJ_POOL_CHUNK_SIZE
+    static inline uint32_t get_class_index(size_t size);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_obj_pool_init(void)
+{
+#if LV_OBJ_POOL_CHUNK_SIZE
+    uint32_t i;
+    for(i = 0; i < LV_OBJ_POOL_CLASS_CNT; i++) {
+        lv_slab_init(&pools[i], (i + 1) * LV_OBJ_POOL_CLASS_SIZE, LV_OBJ_POOL_CHUNK_SIZE);
+    }
+#endif
+}
+
+void lv_obj_pool_deinit(void)
+{
+#if LV_OBJ_POOL_CHUNK_SIZE
+    uint32_t i;
+    for(i = 0; i < LV_OBJ_POOL_CLASS_CNT; i++) {
+        lv_slab_deinit(&pools[i]);
+    }
+#endif
+}
+
+void * lv_obj_pool_alloc(size_t size)
+{
+#if LV_OBJ_POOL_CHUNK_SIZE
+    uint32_t class_idx = get_class_index(size);
+    if(class_idx < LV_OBJ_POOL_CLASS_CNT) {
+        void * p = lv_slab_alloc(&pools[class_idx]);
+        if(p) lv_memzero(p, size);
+        return p;
+    }
+#endif
+
+    return lv_malloc_zeroed(size);
+}
+
+void lv_obj_pool_free(void * p, size_t size)
+{
+#if LV_OBJ_POOL_CHUNK_SIZE
+    if(get_class_index(size) < LV_OBJ_POOL_CLASS_CNT) {
+        lv_slab_free(p);
+        return;
+    }
+#else
+    LV_UNUSED(size);
+#endif
+
+    lv_free(p);
+}
+
+void * lv_obj_pool_realloc(void * p, size_t old_size, size_t new_size)
+{
+#if LV_OBJ_POOL_CHUNK_SIZE
+    if(old_size == 0) return new_size ? lv_obj_pool_alloc(new_size) : NULL;
+    if(new_size == 0) {
+        lv_obj_pool_free(p, old_size);
+        return NULL;
+    }
+
+    uint32_t old_class_idx = get_class_index(old_size);
+    uint32_t new_class_idx = get_class_index(new_size);
+
+    /*The block has room for the new size too*/
+    if(old_class_idx == new_class_idx && new_class_idx < LV_OBJ_POOL_CLASS_CNT) return p;
+
+    /*Both are allocated from the heap*/
+    if(old_class_idx >= LV_OBJ_POOL_CLASS_CNT && new_class_idx >= LV_OBJ_POOL_CLASS_CNT) {
+        return lv_realloc(p, new_size);
+    }
+
+    void * new_p = lv_obj_pool_alloc(new_size);
+    if(new_p == NULL) return NULL;
+
+    lv_memcpy(new_p, p, LV_MIN(old_size, new_size));
+    lv_obj_pool_free(p, old_size);
+    return new_p;
+#else
+    LV_UNUSED(old_size);
+    return lv_realloc(p, new_size);
+#endif
+}
+
+void lv_obj_pool_monitor(lv_mem_monitor_t * mon_p)
+{
+#if LV_OBJ_POOL_CHUNK_SIZE
+    uint32_t i;
+    for(i = 0; i < LV_OBJ_POOL_CLASS_CNT; i++) {
+        mon_p->obj_pool_size += lv_slab_get_size(&pools[i]);
+        mon_p->obj_pool_used_size += (size_t)pools[i].used_cnt * pools[i].item_size;
+    }
+#else
+    LV_UNUSED(mon_p);
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_OBJ_POOL_CHUNK_SIZE
+/**
+ * Get the index of the pool to allocate a memory block from
+ * @param size      size of the memory block in bytes, greater than 0
+ * @return          index of the size class, `LV_OBJ_POOL_CLASS_CNT` or more if it's too large to be pooled
+ */
+static inline uint32_t get_class_index(size_t size)
+{
+    return (uint32_t)((size - 1) / LV_OBJ_POOL_CLASS_SIZE);
+}
+#endif
@@ -0,0 +1,89 @@
+/**
+ * @file lv_obj_pool_private.h
+ *
+ */
+
+#ifndef LV_OBJ_POOL_PRIVATE_H
+#define LV_OBJ_POOL_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lv_conf_internal.h"
+#include "../misc/lv_slab.h"
+#include "../stdlib/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** Size step of the pools' size classes [bytes]*/
+#define LV_OBJ_POOL_CLASS_SIZE  16
+
+/** Number of size classes. Larger memory blocks are allocated from the heap.*/
+#define LV_OBJ_POOL_CLASS_CNT   32
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the pools of the widget instances, `lv_obj_spec_attr_t`s and style arrays.
+ * The pools are used only if `LV_OBJ_POOL_CHUNK_SIZE > 0`.
+ */
+void lv_obj_pool_init(void);
+
+/**
+ * Free the memory of the pools
+ */
+void lv_obj_pool_deinit(void);
+
+/**
+ * Allocate zeroed memory for a widget or for its data. It's taken from the pool
+ * of the matching size class, or from the heap if it's too large for the pools.
+ * @param size      size in bytes
+ * @return          pointer to the zeroed memory or NULL on failure
+ */
+void * lv_obj_pool_alloc(size_t size);
+
+/**
+ * Free a memory block allocated by `lv_obj_pool_alloc()` or `lv_obj_pool_realloc()`
+ * @param p         pointer to the memory block
+ * @param size      the size it was allocated with
+ */
+void lv_obj_pool_free(void * p, size_t size);
+
+/**
+ * Resize a memory block allocated by `lv_obj_pool_alloc()` or `lv_obj_pool_realloc()`.
+ * If both sizes are in the same size class the block is not moved.
+ * @param p         pointer to the memory block. Ignored if `old_size` is 0.
+ * @param old_size  the size it was allocated with
+ * @param new_size  the new size. 0 frees the memory block.
+ * @return          pointer to the resized memory block or NULL on failure or if `new_size` is 0
+ */
+void * lv_obj_pool_realloc(void * p, size_t old_size, size_t new_size);
+
+/**
+ * Add the statistics of the pools to a memory monitor
+ * @param mon_p     pointer to an `lv_mem_monitor_t` to update
+ */
+void lv_obj_pool_monitor(lv_mem_monitor_t * mon_p);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_POOL_PRIVATE_H*/
@@ -12,16 +12,20 @@
 #include "lv_obj_draw_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_hit_index_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "lv_refr_private.h"
 #include "../core/lv_global.h"
+#include "../draw/lv_draw_display_list_private.h"
+#include "lv_obj_bitmap_cache_private.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define MY_CLASS (&lv_obj_class)
 #define update_layout_mutex LV_GLOBAL_DEFAULT()->layout_update_mutex
+#define inv_batch_p (LV_GLOBAL_DEFAULT()->obj_inv_batch)
 
 /**********************
  *      TYPEDEFS
@@ -35,7 +39,15 @@ static int32_t calc_content_height(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv);
 static bool is_transformed(const lv_obj_t * obj);
+static bool get_inv_area(const lv_obj_t * obj, lv_area_t * area_tmp);
 static lv_result_t invalidate_area_core(const lv_obj_t * obj, lv_area_t * area_tmp);
+static void invalidate_blurred(lv_display_t * disp, const lv_obj_t * requester_obj, const lv_area_t * area,
+                               uint32_t disp_inv_cnt);
+#if LV_USE_ANIM_BATCH
+    static lv_result_t invalidate_area_batched(lv_obj_inv_batch_t * batch, lv_display_t * disp, const lv_obj_t * obj,
+                                               lv_area_t * area_tmp);
+#endif
+static void clear_retained_drawings(lv_obj_t * obj);
 
 /**********************
  *  STATIC VARIABLES
@@ -238,6 +250,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     else {
         obj->coords.x2 = obj->coords.x1 + w - 1;
     }
+    lv_obj_hit_index_children_changed(parent);
 
     /*Call the ancestor's event handler to the object with its new coordinates*/
     lv_obj_send_event(obj, LV_EVENT_SIZE_CHANGED, &ori);
@@ -800,6 +813,7 @@ void lv_obj_move_to(lv_obj_t * obj, int32_t x, int32_t y)
     obj->coords.y2 += diff.y;
 
     lv_obj_move_children_by(obj, diff.x, diff.y, false);
+    lv_obj_hit_index_children_changed(parent);
 
     /*Call the ancestor's event handler to the parent too*/
     if(parent) lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, obj);
@@ -875,6 +889,9 @@ void lv_obj_get_transformed_area(const lv_obj_t * obj, lv_area_t * area, lv_obj_
 typedef struct {
     const lv_obj_t * requester_obj;
     const lv_area_t * inv_area;
+    lv_display_t * disp;
+    uint32_t disp_inv_cnt;  /**< If not 0 `inv_area` is only a bounding box and the blurred widgets
+                             *   need to be on one of the first this many invalidated areas of `disp`*/
 } blur_walk_data_t;
 
 static lv_obj_tree_walk_res_t blur_walk_cb(lv_obj_t * obj, void * user_data)
@@ -919,6 +936,14 @@ static lv_obj_tree_walk_res_t blur_walk_cb(lv_obj_t * obj, void * user_data)
 
             if(invalidation_needed == false) continue;
 
+            if(blur_data->disp_inv_cnt) {
+                uint32_t j;
+                for(j = 0; j < blur_data->disp_inv_cnt; j++) {
+                    if(lv_area_is_on(&blur_data->disp->inv_areas[j], &obj_coords)) break;
+                }
+                if(j == blur_data->disp_inv_cnt) return LV_OBJ_TREE_WALK_NEXT;
+            }
+
             /*Truncate the area to the object*/
             ext_size = lv_obj_get_ext_draw_size(obj);
             lv_area_copy(&obj_coords, &obj->coords);
@@ -949,27 +974,54 @@ lv_result_t lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     lv_display_t * disp   = lv_obj_get_display(obj);
+
+    /*Something has changed on the widget, so the recorded draw tasks and cached bitmaps are outdated.
+     *Do it even if the area is not visible as they might be drawn later.*/
+    if(disp == NULL || !disp->rendering_in_progress) clear_retained_drawings((lv_obj_t *)obj);
+
     if(!lv_display_is_invalidation_enabled(disp)) return LV_RESULT_INVALID;
 
     lv_area_t area_tmp;
     lv_area_copy(&area_tmp, area);
 
+#if LV_USE_ANIM_BATCH
+    if(inv_batch_p && disp) return invalidate_area_batched(inv_batch_p, disp, obj, &area_tmp);
+#endif
+
     lv_result_t res = invalidate_area_core(obj, &area_tmp);
     if(res == LV_RESULT_INVALID) return res;
 
     /*If this area is on a blurred widget, invalidate that widget too*/
-    blur_walk_data_t blur_walk_data;
-    blur_walk_data.requester_obj = obj;
-    blur_walk_data.inv_area = &area_tmp;
-    lv_obj_tree_walk(disp->act_scr, blur_walk_cb, &blur_walk_data);
-    if(disp->prev_scr) lv_obj_tree_walk(disp->prev_scr, blur_walk_cb, &blur_walk_data);
-    lv_obj_tree_walk(disp->sys_layer, blur_walk_cb, &blur_walk_data);
-    lv_obj_tree_walk(disp->top_layer, blur_walk_cb, &blur_walk_data);
-    lv_obj_tree_walk(disp->bottom_layer, blur_walk_cb, &blur_walk_data);
+    invalidate_blurred(disp, obj, &area_tmp, 0);
 
     return res;
 }
 
+#if LV_USE_ANIM_BATCH
+
+void lv_obj_invalidate_batch_begin(lv_obj_inv_batch_t * batch)
+{
+    lv_memzero(batch, sizeof(lv_obj_inv_batch_t));
+    batch->prev = inv_batch_p;
+    inv_batch_p = batch;
+}
+
+void lv_obj_invalidate_batch_end(lv_obj_inv_batch_t * batch)
+{
+    LV_ASSERT(inv_batch_p == batch);
+    inv_batch_p = batch->prev;
+
+    if(batch->blur_disp == NULL) return;
+
+    /*The display might have been deleted meanwhile*/
+    lv_display_t * disp = lv_display_get_next(NULL);
+    while(disp && disp != batch->blur_disp) disp = lv_display_get_next(disp);
+
+    if(disp) invalidate_blurred(disp, NULL, &batch->blur_area, disp->inv_p);
+}
+
+#endif /*LV_USE_ANIM_BATCH*/
+
 
 lv_result_t lv_obj_invalidate(const lv_obj_t * obj)
 {
@@ -1062,6 +1114,7 @@ void lv_obj_set_ext_click_area(lv_obj_t * obj, int32_t size)
 
     lv_obj_allocate_spec_attr(obj);
     obj->spec_attr->ext_click_pad = size;
+    lv_obj_hit_index_children_changed(obj->parent);
 }
 
 void lv_obj_get_click_area(const lv_obj_t * obj, lv_area_t * area)
@@ -1440,9 +1493,16 @@ static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p
     lv_point_array_transform(p, p_count, angle, scale_x, scale_y, &pivot, !inv);
 }
 
-static lv_result_t invalidate_area_core(const lv_obj_t * obj, lv_area_t * area_tmp)
+/**
+ * Get the area to invalidate to redraw an area of a widget
+ * @param obj       pointer to a widget
+ * @param area_tmp  the area of the widget to redraw. It's clipped to the visible area and
+ *                  enlarged with the margin of the transformations.
+ * @return          true: the area is visible; false: nothing to invalidate
+ */
+static bool get_inv_area(const lv_obj_t * obj, lv_area_t * area_tmp)
 {
-    if(!lv_obj_area_is_visible(obj, area_tmp)) return LV_RESULT_INVALID;
+    if(!lv_obj_area_is_visible(obj, area_tmp)) return false;
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     /**
      * When using the global matrix, the vertex coordinates of clip_area lose precision after transformation,
@@ -1457,6 +1517,103 @@ static lv_result_t invalidate_area_core(const lv_obj_t * obj, lv_area_t * area_t
     }
 #endif
 
+    return true;
+}
+
+static lv_result_t invalidate_area_core(const lv_obj_t * obj, lv_area_t * area_tmp)
+{
+    if(!get_inv_area(obj, area_tmp)) return LV_RESULT_INVALID;
+
     lv_result_t res = lv_inv_area(lv_obj_get_display(obj), area_tmp);
     return res;
 }
+
+/**
+ * Invalidate the blurred widgets on an invalidated area as they
+ * need to be redrawn entirely if anything behind them changes
+ * @param disp              the display of the area
+ * @param requester_obj     the widget which invalidated the area. Its children are not checked. Can be NULL.
+ * @param area              the invalidated area
+ * @param disp_inv_cnt      0: `area` is the invalidated area; else `area` is the bounding box of the
+ *                          invalidated areas and the first `disp_inv_cnt` invalidated areas of `disp`
+ *                          are checked too
+ */
+static void invalidate_blurred(lv_display_t * disp, const lv_obj_t * requester_obj, const lv_area_t * area,
+                               uint32_t disp_inv_cnt)
+{
+    blur_walk_data_t blur_walk_data;
+    blur_walk_data.requester_obj = requester_obj;
+    blur_walk_data.inv_area = area;
+    blur_walk_data.disp = disp;
+    blur_walk_data.disp_inv_cnt = disp_inv_cnt;
+    lv_obj_tree_walk(disp->act_scr, blur_walk_cb, &blur_walk_data);
+    if(disp->prev_scr) lv_obj_tree_walk(disp->prev_scr, blur_walk_cb, &blur_walk_data);
+    lv_obj_tree_walk(disp->sys_layer, blur_walk_cb, &blur_walk_data);
+    lv_obj_tree_walk(disp->top_layer, blur_walk_cb, &blur_walk_data);
+    lv_obj_tree_walk(disp->bottom_layer, blur_walk_cb, &blur_walk_data);
+}
+
+#if LV_USE_ANIM_BATCH
+
+/**
+ * Invalidate an area of a widget in an invalidation batch.
+ * If the widget's last invalidated area still contains it, it's not added to the display again.
+ * The blurred widgets are looked for only once in `lv_obj_invalidate_batch_end`.
+ * @param batch     the innermost batch in progress
+ * @param disp      the display of the widget
+ * @param obj       pointer to a widget
+ * @param area_tmp  the area to invalidate. It's changed as in `invalidate_area_core`.
+ * @return          LV_RESULT_OK: the area is invalidated
+ */
+static lv_result_t invalidate_area_batched(lv_obj_inv_batch_t * batch, lv_display_t * disp, const lv_obj_t * obj,
+                                           lv_area_t * area_tmp)
+{
+    if(!get_inv_area(obj, area_tmp)) return LV_RESULT_INVALID;
+
+    lv_obj_inv_batch_slot_t * slot = &batch->slots[((lv_uintptr_t)obj >> 4) % LV_OBJ_INV_BATCH_SLOT_CNT];
+    if(slot->disp != disp || slot->inv_index >= disp->inv_p ||
+       !lv_area_is_in(area_tmp, &disp->inv_areas[slot->inv_index], 0)) {
+        lv_result_t res = lv_inv_area(disp, area_tmp);
+        if(res == LV_RESULT_INVALID) return res;
+
+        /*Remember the invalidated area which contains this area. It's usually the last one.*/
+        slot->disp = NULL;
+        uint32_t i = disp->inv_p;
+        while(i > 0) {
+            i--;
+            if(lv_area_is_in(area_tmp, &disp->inv_areas[i], 0)) {
+                slot->disp = disp;
+                slot->inv_index = i;
+                break;
+            }
+        }
+    }
+
+    if(batch->blur_disp == NULL) {
+        batch->blur_disp = disp;
+        batch->blur_area = *area_tmp;
+    }
+    else if(batch->blur_disp == disp) {
+        lv_area_join(&batch->blur_area, &batch->blur_area, area_tmp);
+    }
+    else {
+        invalidate_blurred(disp, obj, area_tmp, 0);
+    }
+
+    return LV_RESULT_OK;
+}
+
+#endif /*LV_USE_ANIM_BATCH*/
+
+/**
+ * Clear the display lists and cached bitmaps of a widget and its parents, as they include this widget too
+ * @param obj   pointer to a widget
+ */
+static void clear_retained_drawings(lv_obj_t * obj)
+{
+    while(obj) {
+        if(obj->spec_attr && obj->spec_attr->display_list) lv_draw_display_list_clear(obj->spec_attr->display_list);
+        if(lv_obj_has_flag(obj, LV_OBJ_FLAG_CACHE_BITMAP)) lv_obj_bitmap_cache_drop(obj);
+        obj = obj->parent;
+    }
+}
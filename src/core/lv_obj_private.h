@@ -24,6 +24,11 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#if LV_USE_ANIM_BATCH
+/** Number of widgets whose last invalidated area is remembered in an invalidation batch*/
+#define LV_OBJ_INV_BATCH_SLOT_CNT   16
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -46,8 +51,13 @@ struct _lv_obj_spec_attr_t {
 
     int32_t ext_click_pad;          /**< Extra click padding in all direction*/
     int32_t ext_draw_size;          /**< EXTend the size in every direction for drawing.*/
+    lv_draw_display_list_t * display_list; /**< The recorded draw tasks if `LV_OBJ_FLAG_DISPLAY_LIST` is set*/
+#if LV_OBJ_HIT_INDEX_MIN_CHILDREN
+    lv_obj_hit_index_t * hit_index; /**< Grid of the children's click areas to find the clicked child*/
+#endif
 
-    uint16_t child_cnt;             /**< Number of children*/
+    uint32_t child_cnt;             /**< Number of children*/
+    uint32_t child_cap;             /**< Number of children `children` has room for*/
     uint16_t scrollbar_mode : 2;    /**< How to display scrollbars, see `lv_scrollbar_mode_t`*/
     uint16_t scroll_snap_x : 2;     /**< Where to align the snappable children horizontally, see `lv_scroll_snap_t`*/
     uint16_t scroll_snap_y : 2;     /**< Where to align the snappable children vertically*/
@@ -56,6 +66,45 @@ struct _lv_obj_spec_attr_t {
     uint16_t name_static : 1;        /**< 1: `name` was not dynamically allocated */
 };
 
+/** An object deleted by a bulk delete and the size to free it with*/
+typedef struct {
+    lv_obj_t * obj;
+    uint32_t instance_size;
+} lv_obj_bulk_delete_item_t;
+
+/**
+ * Objects deleted together when the children of an object are deleted.
+ * Their animations and async deletes are removed and their memory is freed in one pass at the end.
+ */
+struct _lv_obj_bulk_delete_t {
+    lv_obj_bulk_delete_t * prev;        /**< The bulk delete in progress when this one was started*/
+    lv_obj_bulk_delete_item_t * items;  /**< The deleted objects*/
+    uint32_t * slots;                   /**< Hash table of `items` indices + 1, 0 for free slots*/
+    uint32_t item_cnt;                  /**< Number of objects in `items`*/
+    uint32_t item_cap;                  /**< Capacity of `items`*/
+    uint32_t slot_cnt;                  /**< Size of `slots`. Always 0 or a power of 2.*/
+};
+
+#if LV_USE_ANIM_BATCH
+/** The last area invalidated by a widget in an invalidation batch*/
+typedef struct {
+    lv_display_t * disp;        /**< The display of the widget. NULL if the slot is free.*/
+    uint32_t inv_index;         /**< Index of the display's invalidated area containing the widget's area*/
+} lv_obj_inv_batch_slot_t;
+
+/**
+ * Invalidations coalesced while many widgets are changed together, e.g. by the animations.
+ * The areas which are already invalidated are not added again and the blurred widgets
+ * are looked for only once, when the batch ends.
+ */
+struct _lv_obj_inv_batch_t {
+    lv_obj_inv_batch_t * prev;      /**< The batch in progress when this one was started*/
+    lv_display_t * blur_disp;       /**< The display of `blur_area`. NULL if nothing was invalidated yet.*/
+    lv_area_t blur_area;            /**< Bounding box of the areas invalidated on `blur_disp`*/
+    lv_obj_inv_batch_slot_t slots[LV_OBJ_INV_BATCH_SLOT_CNT]; /**< Indexed by the widgets' address*/
+};
+#endif
+
 struct _lv_obj_t {
 #if LV_USE_EXT_DATA
     lv_ext_data_t ext_data;
@@ -67,6 +116,9 @@ struct _lv_obj_t {
 #if LV_OBJ_STYLE_CACHE
     uint32_t style_main_prop_is_set;
     uint32_t style_other_prop_is_set;
+#endif
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    lv_obj_style_value_cache_t * style_value_cache;
 #endif
     void * user_data;
 #if LV_USE_OBJ_ID
@@ -95,6 +147,46 @@ struct _lv_obj_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Add a child to the end of the children array of an object.
+ * The array grows geometrically, so adding many children needs only a few reallocations.
+ * @param parent    pointer to an object with allocated `spec_attr`
+ * @param child     the child to add
+ * @return          LV_RESULT_OK: the child is added; LV_RESULT_INVALID: the array couldn't be grown
+ */
+lv_result_t lv_obj_children_append(lv_obj_t * parent, lv_obj_t * child);
+
+/**
+ * Remove a child from the children array of an object.
+ * The array shrinks only if at most a quarter of it is used.
+ * @param parent    pointer to an object
+ * @param index     index of the child to remove
+ */
+void lv_obj_children_remove(lv_obj_t * parent, uint32_t index);
+
+/**
+ * Check if an object is being deleted by the innermost bulk delete in progress.
+ * Such objects don't need to remove their animations one by one.
+ * @param obj       pointer to an object
+ * @return          true: the object's animations will be removed by the bulk delete
+ */
+bool lv_obj_is_bulk_deleted(const lv_obj_t * obj);
+
+#if LV_USE_ANIM_BATCH
+/**
+ * Start coalescing the invalidations of the widgets until `lv_obj_invalidate_batch_end` is called.
+ * Batches can be nested.
+ * @param batch     an uninitialized batch which stays valid until the batch ends, e.g. a local variable
+ */
+void lv_obj_invalidate_batch_begin(lv_obj_inv_batch_t * batch);
+
+/**
+ * End an invalidation batch and invalidate the blurred widgets on the areas invalidated in the batch
+ * @param batch     the batch passed to `lv_obj_invalidate_batch_begin`
+ */
+void lv_obj_invalidate_batch_end(lv_obj_inv_batch_t * batch);
+#endif
+
 /**********************
  *      MACROS
  **********************/
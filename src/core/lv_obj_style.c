@@ -7,9 +7,12 @@
  *      INCLUDES
  *********************/
 #include "lv_obj_private.h"
+#include "lv_obj_hit_index_private.h"
+#include "lv_obj_draw_private.h"
 #include "../misc/lv_anim_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_pool_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../misc/lv_color.h"
@@ -22,15 +25,19 @@
  *********************/
 #define MY_CLASS (&lv_obj_class)
 #define style_refr LV_GLOBAL_DEFAULT()->style_refresh
-#define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
+#define style_trans_list_p &(LV_GLOBAL_DEFAULT()->style_trans_list)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
+#define style_value_cache_size LV_GLOBAL_DEFAULT()->style_value_cache_size
+#define STYLE_VALUE_CACHE_MIN_SLOT_CNT  16
+#define STYLE_VALUE_CACHE_MAX_SLOT_CNT  256
 
 /**********************
  *      TYPEDEFS
  **********************/
 
 typedef struct {
+    lv_ilist_link_t link;
     lv_obj_t * obj;
     lv_style_prop_t prop;
     lv_style_selector_t selector;
@@ -61,8 +68,13 @@ static lv_obj_style_t * get_trans_style(lv_obj_t * obj, lv_style_selector_t sele
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                     lv_style_value_t * v);
 static void report_style_change_core(void * style, lv_obj_t * obj);
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    static void style_value_cache_invalidate_style_users(void * style, lv_obj_t * obj);
+#endif
 static void refresh_children_style(lv_obj_t * obj);
 static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
+static trans_t * trans_mem_alloc(void);
+static void trans_mem_free(trans_t * tr);
 static void trans_anim_cb(void * _tr, int32_t v);
 static void trans_anim_start_cb(lv_anim_t * a);
 static void trans_anim_completed_cb(lv_anim_t * a);
@@ -73,6 +85,13 @@ static void fade_in_anim_completed(lv_anim_t * a);
 static bool style_has_flag(const lv_style_t * style, uint32_t flag);
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act);
+static inline bool style_prop_is_inheritable(lv_style_prop_t prop);
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    static inline uint32_t style_value_cache_hash(uint32_t key);
+    static inline size_t style_value_cache_get_alloc_size(uint32_t slot_cnt);
+    static lv_obj_style_value_cache_t * style_value_cache_grow(lv_obj_t * obj);
+    static void style_value_cache_add(lv_obj_t * obj, uint32_t key, lv_style_value_t value);
+#endif
 #if LV_USE_OBSERVER
     static void bind_style_observer_cb(lv_observer_t * observer, lv_subject_t * subject);
     static void bind_style_prop_observer_cb(lv_observer_t * observer, lv_subject_t * subject);
@@ -92,12 +111,23 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 
 void lv_obj_style_init(void)
 {
-    lv_ll_init(style_trans_ll_p, sizeof(trans_t));
+    lv_ilist_init(style_trans_list_p, offsetof(trans_t, link));
+#if LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    lv_slab_init(&LV_GLOBAL_DEFAULT()->style_trans_pool, sizeof(trans_t), LV_TIMER_ANIM_POOL_CHUNK_SIZE);
+#endif
 }
 
 void lv_obj_style_deinit(void)
 {
-    lv_ll_clear(style_trans_ll_p);
+    trans_t * tr = lv_ilist_get_head(style_trans_list_p);
+    while(tr) {
+        lv_ilist_remove(style_trans_list_p, tr);
+        trans_mem_free(tr);
+        tr = lv_ilist_get_head(style_trans_list_p);
+    }
+#if LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    lv_slab_deinit(&LV_GLOBAL_DEFAULT()->style_trans_pool);
+#endif
     if(_style_custom_prop_flag_lookup_table != NULL) {
         lv_free(_style_custom_prop_flag_lookup_table);
         _style_custom_prop_flag_lookup_table = NULL;
@@ -132,7 +162,8 @@ void lv_obj_add_style(lv_obj_t * obj, const lv_style_t * style, lv_style_selecto
     /*Allocate space for the new style and shift the rest of the style to the end*/
     obj->style_cnt++;
     LV_ASSERT(obj->style_cnt != 0);
-    obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
+    obj->styles = lv_obj_pool_realloc(obj->styles, (obj->style_cnt - 1) * sizeof(lv_obj_style_t),
+                                      obj->style_cnt * sizeof(lv_obj_style_t));
     LV_ASSERT_MALLOC(obj->styles);
 
     uint32_t j;
@@ -147,11 +178,18 @@ void lv_obj_add_style(lv_obj_t * obj, const lv_style_t * style, lv_style_selecto
 #if LV_OBJ_STYLE_CACHE
     uint32_t * prop_is_set = part == LV_PART_MAIN ? &obj->style_main_prop_is_set : &obj->style_other_prop_is_set;
     if(lv_style_is_const(style)) {
-        lv_style_const_prop_t * props = style->values_and_props;
+        const lv_style_const_prop_t * props = lv_style_get_const_props(style);
         for(i = 0; props[i].prop != LV_STYLE_PROP_INV; i++) {
             (*prop_is_set) |= STYLE_PROP_SHIFTED(props[i].prop);
         }
     }
+    else if(style->prop_cnt == LV_STYLE_PROP_TABLE) {
+        const lv_style_table_t * table = style->values_and_props;
+        for(i = 0; i < table->prop_table->prop_cnt; i++) {
+            lv_style_prop_t prop = table->prop_table->props[i];
+            if(lv_style_table_has_prop(table, prop)) (*prop_is_set) |= STYLE_PROP_SHIFTED(prop);
+        }
+    }
     else {
         lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         for(i = 0; i < style->prop_cnt; i++) {
@@ -249,7 +287,8 @@ void lv_obj_remove_style(lv_obj_t * obj, const lv_style_t * style, lv_style_sele
         }
 
         obj->style_cnt--;
-        obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
+        obj->styles = lv_obj_pool_realloc(obj->styles, (obj->style_cnt + 1) * sizeof(lv_obj_style_t),
+                                          obj->style_cnt * sizeof(lv_obj_style_t));
 
         deleted = true;
         /*The style from the current `i` index is removed, so `i` points to the next style.
@@ -269,9 +308,22 @@ void lv_obj_remove_style_all(lv_obj_t * obj)
 
 void lv_obj_report_style_change(lv_style_t * style)
 {
-    if(!style_refr) return;
     lv_display_t * d = lv_display_get_next(NULL);
 
+    if(!style_refr) {
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+        /*The values of the style might have changed even if refreshing is disabled*/
+        while(d) {
+            uint32_t i;
+            for(i = 0; i < d->screen_cnt; i++) {
+                style_value_cache_invalidate_style_users(style, d->screens[i]);
+            }
+            d = lv_display_get_next(d);
+        }
+#endif
+        return;
+    }
+
     while(d) {
         uint32_t i;
         for(i = 0; i < d->screen_cnt; i++) {
@@ -285,6 +337,9 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The styles might have changed even if refreshing is disabled*/
+    lv_obj_style_value_cache_invalidate(obj);
+
     if(!style_refr) return;
 
     LV_PROFILER_STYLE_BEGIN;
@@ -365,18 +420,87 @@ void lv_obj_enable_style_refresh(bool en)
     style_refr = en;
 }
 
+void lv_obj_style_value_cache_invalidate(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    /*Keep the table as it will be filled again soon*/
+    lv_obj_style_value_cache_t * cache = obj->style_value_cache;
+    if(cache == NULL || cache->used_cnt == 0) return;
+
+    lv_memzero(cache->keys, cache->slot_cnt * sizeof(uint32_t));
+    cache->used_cnt = 0;
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+void lv_obj_style_value_cache_free(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    lv_obj_style_value_cache_t * cache = obj->style_value_cache;
+    if(cache == NULL) return;
+
+    style_value_cache_size -= style_value_cache_get_alloc_size(cache->slot_cnt);
+    lv_free(cache);
+    obj->style_value_cache = NULL;
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+void lv_obj_style_value_cache_get_stats(uint32_t * hit_cnt, uint32_t * miss_cnt)
+{
+    if(hit_cnt) *hit_cnt = LV_GLOBAL_DEFAULT()->style_value_cache_hit_cnt;
+    if(miss_cnt) *miss_cnt = LV_GLOBAL_DEFAULT()->style_value_cache_miss_cnt;
+}
+
+void lv_obj_style_value_cache_reset_stats(void)
+{
+    LV_GLOBAL_DEFAULT()->style_value_cache_hit_cnt = 0;
+    LV_GLOBAL_DEFAULT()->style_value_cache_miss_cnt = 0;
+}
+#endif
+
 lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     LV_ASSERT_NULL(obj)
 
     lv_style_selector_t selector = part | obj->state;
+
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    /*Inherited values depend on the parents too, and during transitions
+     *the values are temporarily resolved without the transition styles, so don't cache them*/
+    uint32_t cache_key = 0;
+    if(!obj->skip_trans && !style_prop_is_inheritable(prop)) {
+        cache_key = (selector << 8) | prop;
+        lv_obj_style_value_cache_t * cache = obj->style_value_cache;
+        if(cache) {
+            uint32_t mask = cache->slot_cnt - 1;
+            uint32_t i = style_value_cache_hash(cache_key) & mask;
+            while(cache->keys[i]) {
+                if(cache->keys[i] == cache_key) {
+                    LV_GLOBAL_DEFAULT()->style_value_cache_hit_cnt++;
+                    return cache->values[i];
+                }
+                i = (i + 1) & mask;
+            }
+        }
+        LV_GLOBAL_DEFAULT()->style_value_cache_miss_cnt++;
+    }
+#endif
+
     lv_style_value_t value_act = { .ptr = NULL };
     lv_style_res_t found;
 
     found = get_selector_style_prop(obj, selector, prop, &value_act);
-    if(found == LV_STYLE_RES_FOUND) return value_act;
+    if(found != LV_STYLE_RES_FOUND) value_act = lv_style_prop_get_default(prop);
 
-    return lv_style_prop_get_default(prop);
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    if(cache_key) style_value_cache_add((lv_obj_t *)obj, cache_key, value_act);
+#endif
+
+    return value_act;
 }
 
 bool lv_obj_has_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop)
@@ -491,9 +615,10 @@ void lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t p
         }
     }
 
-    tr = lv_ll_ins_head(style_trans_ll_p);
+    tr = trans_mem_alloc();
     LV_ASSERT_MALLOC(tr);
     if(tr == NULL) return;
+    lv_ilist_ins_head(style_trans_list_p, tr);
     tr->start_value = v1;
     tr->end_value = v2;
     tr->obj = obj;
@@ -677,11 +802,13 @@ lv_opa_t lv_obj_get_style_opa_recursive(const lv_obj_t * obj, lv_part_t part)
 void lv_obj_update_layer_type(lv_obj_t * obj)
 {
     lv_layer_type_t layer_type = calculate_layer_type(obj);
-    if(obj->spec_attr) obj->spec_attr->layer_type = layer_type;
-    else if(layer_type != LV_LAYER_TYPE_NONE) {
-        lv_obj_allocate_spec_attr(obj);
-        obj->spec_attr->layer_type = layer_type;
-    }
+    if(layer_type == lv_obj_get_layer_type(obj)) return;
+
+    if(obj->spec_attr == NULL) lv_obj_allocate_spec_attr(obj);
+    obj->spec_attr->layer_type = layer_type;
+
+    /*Transformed widgets can be clicked outside of their coordinates*/
+    lv_obj_hit_index_children_changed(obj->parent);
 }
 
 lv_color32_t lv_obj_style_apply_recolor(const lv_obj_t * obj, lv_part_t part, lv_color32_t color)
@@ -804,7 +931,8 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
 
     obj->style_cnt++;
     LV_ASSERT(obj->style_cnt != 0);
-    obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
+    obj->styles = lv_obj_pool_realloc(obj->styles, (obj->style_cnt - 1) * sizeof(lv_obj_style_t),
+                                      obj->style_cnt * sizeof(lv_obj_style_t));
     LV_ASSERT_MALLOC(obj->styles);
 
     for(i = obj->style_cnt - 1; i > 0 ; i--) {
@@ -842,7 +970,8 @@ static lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t sel
 
     obj->style_cnt++;
     LV_ASSERT(obj->style_cnt != 0);
-    obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
+    obj->styles = lv_obj_pool_realloc(obj->styles, (obj->style_cnt - 1) * sizeof(lv_obj_style_t),
+                                      obj->style_cnt * sizeof(lv_obj_style_t));
 
     for(i = obj->style_cnt - 1; i > 0 ; i--) {
         obj->styles[i] = obj->styles[i - 1];
@@ -935,6 +1064,29 @@ static void report_style_change_core(void * style, lv_obj_t * obj)
     }
 }
 
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+/**
+ * Recursively clear the resolved style value cache of the widgets using a style
+ * @param style     pointer to a style, `NULL` to clear the cache of all widgets
+ * @param obj       pointer to the widget to start from
+ */
+static void style_value_cache_invalidate_style_users(void * style, lv_obj_t * obj)
+{
+    uint32_t i;
+    for(i = 0; i < obj->style_cnt; i++) {
+        if(style == NULL || obj->styles[i].style == style) {
+            lv_obj_style_value_cache_invalidate(obj);
+            break;
+        }
+    }
+
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        style_value_cache_invalidate_style_users(style, obj->spec_attr->children[i]);
+    }
+}
+#endif
+
 /**
  * Recursively refresh the style of the children. Go deeper until a not NULL style is found
  * because the NULL styles are inherited from the parent
@@ -956,7 +1108,7 @@ static void refresh_children_style(lv_obj_t * obj)
 
 /**
  * Remove the transition from object's part's property.
- * - Remove the transition from `lv_obj_style_trans_ll` and free it
+ * - Remove the transition from `style_trans_list` and free it
  * - Delete pending transitions
  * @param obj pointer to an object which transition(s) should be removed
  * @param part a part of object or 0xFF to remove from all parts
@@ -968,12 +1120,12 @@ static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, t
     trans_t * tr;
     trans_t * tr_prev;
     bool removed = false;
-    tr = lv_ll_get_tail(style_trans_ll_p);
+    tr = lv_ilist_get_tail(style_trans_list_p);
     while(tr != NULL) {
         if(tr == tr_limit) break;
 
         /*'tr' might be deleted, so get the next object while 'tr' is valid*/
-        tr_prev = lv_ll_get_prev(style_trans_ll_p, tr);
+        tr_prev = lv_ilist_get_prev(style_trans_list_p, tr);
 
         if(tr->obj == obj && (part == tr->selector || part == LV_PART_ANY) && (prop == tr->prop || prop == LV_STYLE_PROP_ANY)) {
             /*Remove any transitioned properties from the trans. style
@@ -984,11 +1136,12 @@ static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, t
                     lv_style_remove_prop((lv_style_t *)obj->styles[i].style, tr->prop);
                 }
             }
+            lv_obj_style_value_cache_invalidate(obj);
 
             /*Free the transition descriptor too*/
             lv_anim_delete(tr, NULL);
-            lv_ll_remove(style_trans_ll_p, tr);
-            lv_free(tr);
+            lv_ilist_remove(style_trans_list_p, tr);
+            trans_mem_free(tr);
             removed = true;
 
         }
@@ -1096,7 +1249,7 @@ static void trans_anim_completed_cb(lv_anim_t * a)
      *It allows changing it by normal styles*/
     bool running = false;
     trans_t * tr_i;
-    LV_LL_READ(style_trans_ll_p, tr_i) {
+    LV_ILIST_READ(style_trans_list_p, tr_i) {
         if(tr_i != tr && tr_i->obj == tr->obj && tr_i->selector == tr->selector && tr_i->prop == tr->prop) {
             running = true;
             break;
@@ -1107,11 +1260,12 @@ static void trans_anim_completed_cb(lv_anim_t * a)
         uint32_t i;
         for(i = 0; i < obj->style_cnt; i++) {
             if(obj->styles[i].is_trans && obj->styles[i].selector == tr->selector) {
-                lv_ll_remove(style_trans_ll_p, tr);
-                lv_free(tr);
+                lv_ilist_remove(style_trans_list_p, tr);
+                trans_mem_free(tr);
 
                 lv_obj_style_t * obj_style = &obj->styles[i];
                 lv_style_remove_prop((lv_style_t *)obj_style->style, prop);
+                lv_obj_style_value_cache_invalidate(obj);
 
                 if(lv_style_is_empty(obj->styles[i].style)) {
                     lv_obj_remove_style(obj, (lv_style_t *)obj_style->style, obj_style->selector);
@@ -1123,6 +1277,24 @@ static void trans_anim_completed_cb(lv_anim_t * a)
     }
 }
 
+static trans_t * trans_mem_alloc(void)
+{
+#if LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    return lv_slab_alloc(&LV_GLOBAL_DEFAULT()->style_trans_pool);
+#else
+    return lv_malloc(sizeof(trans_t));
+#endif
+}
+
+static void trans_mem_free(trans_t * tr)
+{
+#if LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    lv_slab_free(tr);
+#else
+    lv_free(tr);
+#endif
+}
+
 static lv_layer_type_t calculate_layer_type(lv_obj_t * obj)
 {
 #if LV_DRAW_TRANSFORM_USE_MATRIX
@@ -1141,6 +1313,8 @@ static lv_layer_type_t calculate_layer_type(lv_obj_t * obj)
 
 static void full_cache_refresh(lv_obj_t * obj, lv_part_t part)
 {
+    lv_obj_style_value_cache_invalidate(obj);
+
 #if LV_OBJ_STYLE_CACHE
     uint32_t i;
     if(part == LV_PART_MAIN || part == LV_PART_ANY) {
@@ -1151,11 +1325,18 @@ static void full_cache_refresh(lv_obj_t * obj, lv_part_t part)
             lv_style_t * style = (lv_style_t *)obj->styles[i].style;
             uint32_t j;
             if(lv_style_is_const(style)) {
-                lv_style_const_prop_t * props = style->values_and_props;
+                const lv_style_const_prop_t * props = lv_style_get_const_props(style);
                 for(j = 0; props[j].prop != LV_STYLE_PROP_INV; j++) {
                     obj->style_main_prop_is_set |= STYLE_PROP_SHIFTED(props[j].prop);
                 }
             }
+            else if(style->prop_cnt == LV_STYLE_PROP_TABLE) {
+                const lv_style_table_t * table = style->values_and_props;
+                for(j = 0; j < table->prop_table->prop_cnt; j++) {
+                    lv_style_prop_t prop = table->prop_table->props[j];
+                    if(lv_style_table_has_prop(table, prop)) obj->style_main_prop_is_set |= STYLE_PROP_SHIFTED(prop);
+                }
+            }
             else {
                 lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
                 for(j = 0; j < style->prop_cnt; j++) {
@@ -1173,11 +1354,18 @@ static void full_cache_refresh(lv_obj_t * obj, lv_part_t part)
             lv_style_t * style = (lv_style_t *)obj->styles[i].style;
             uint32_t j;
             if(lv_style_is_const(style)) {
-                lv_style_const_prop_t * props = style->values_and_props;
+                const lv_style_const_prop_t * props = lv_style_get_const_props(style);
                 for(j = 0; props[j].prop != LV_STYLE_PROP_INV; j++) {
                     obj->style_other_prop_is_set |= STYLE_PROP_SHIFTED(props[j].prop);
                 }
             }
+            else if(style->prop_cnt == LV_STYLE_PROP_TABLE) {
+                const lv_style_table_t * table = style->values_and_props;
+                for(j = 0; j < table->prop_table->prop_cnt; j++) {
+                    lv_style_prop_t prop = table->prop_table->props[j];
+                    if(lv_style_table_has_prop(table, prop)) obj->style_other_prop_is_set |= STYLE_PROP_SHIFTED(prop);
+                }
+            }
             else {
                 lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
                 for(j = 0; j < style->prop_cnt; j++) {
@@ -1205,7 +1393,7 @@ static void fade_in_anim_completed(lv_anim_t * a)
 static bool style_has_flag(const lv_style_t * style, uint32_t flag)
 {
     if(lv_style_is_const(style)) {
-        lv_style_const_prop_t * props = style->values_and_props;
+        const lv_style_const_prop_t * props = lv_style_get_const_props(style);
         uint32_t i;
         for(i = 0; props[i].prop != LV_STYLE_PROP_INV; i++) {
             if(lv_style_prop_has_flag(props[i].prop, flag)) {
@@ -1213,6 +1401,16 @@ static bool style_has_flag(const lv_style_t * style, uint32_t flag)
             }
         }
     }
+    else if(style->prop_cnt == LV_STYLE_PROP_TABLE) {
+        const lv_style_table_t * table = style->values_and_props;
+        uint32_t i;
+        for(i = 0; i < table->prop_table->prop_cnt; i++) {
+            lv_style_prop_t prop = table->prop_table->props[i];
+            if(lv_style_table_has_prop(table, prop) && lv_style_prop_has_flag(prop, flag)) {
+                return true;
+            }
+        }
+    }
     else {
         lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         uint32_t i;
@@ -1241,19 +1439,7 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
         if(found == LV_STYLE_RES_FOUND) return LV_STYLE_RES_FOUND;
     }
 
-    extern const uint8_t lv_style_builtin_prop_flag_lookup_table[];
-    bool inheritable = false;
-    if(prop < LV_STYLE_NUM_BUILT_IN_PROPS) {
-        inheritable = lv_style_builtin_prop_flag_lookup_table[prop] & LV_STYLE_PROP_FLAG_INHERITABLE;
-    }
-    else {
-        if(_style_custom_prop_flag_lookup_table != NULL) {
-            inheritable = _style_custom_prop_flag_lookup_table[prop - LV_STYLE_NUM_BUILT_IN_PROPS] &
-                          LV_STYLE_PROP_FLAG_INHERITABLE;
-        }
-    }
-
-    if(inheritable) {
+    if(style_prop_is_inheritable(prop)) {
         /*If not found, check the `MAIN` style first, if already on the MAIN part go to the parent*/
         if(part != LV_PART_MAIN) part = LV_PART_MAIN;
         else obj = obj->parent;
@@ -1297,6 +1483,103 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
     return LV_STYLE_RES_NOT_FOUND;
 }
 
+static inline bool style_prop_is_inheritable(lv_style_prop_t prop)
+{
+    extern const uint8_t lv_style_builtin_prop_flag_lookup_table[];
+    if(prop < LV_STYLE_NUM_BUILT_IN_PROPS) {
+        return lv_style_builtin_prop_flag_lookup_table[prop] & LV_STYLE_PROP_FLAG_INHERITABLE;
+    }
+
+    if(_style_custom_prop_flag_lookup_table != NULL) {
+        return _style_custom_prop_flag_lookup_table[prop - LV_STYLE_NUM_BUILT_IN_PROPS] & LV_STYLE_PROP_FLAG_INHERITABLE;
+    }
+
+    return false;
+}
+
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+static inline uint32_t style_value_cache_hash(uint32_t key)
+{
+    /*The properties are in the lowest bits, the parts and states above them,
+     *so mix the bits to use all of them in the masked index*/
+    key *= 0x9E3779B1u;
+    return key ^ (key >> 16);
+}
+
+static inline size_t style_value_cache_get_alloc_size(uint32_t slot_cnt)
+{
+    return sizeof(lv_obj_style_value_cache_t) + slot_cnt * (sizeof(lv_style_value_t) + sizeof(uint32_t));
+}
+
+/**
+ * Allocate a cache for a widget or double its size.
+ * @param obj       pointer to a widget
+ * @return          the new cache or NULL if the maximal size or the memory budget is reached
+ */
+static lv_obj_style_value_cache_t * style_value_cache_grow(lv_obj_t * obj)
+{
+    lv_obj_style_value_cache_t * cache_old = obj->style_value_cache;
+    uint32_t slot_cnt = cache_old ? cache_old->slot_cnt * 2 : STYLE_VALUE_CACHE_MIN_SLOT_CNT;
+    if(slot_cnt > STYLE_VALUE_CACHE_MAX_SLOT_CNT) return NULL;
+
+    size_t size_old = cache_old ? style_value_cache_get_alloc_size(cache_old->slot_cnt) : 0;
+    size_t size = style_value_cache_get_alloc_size(slot_cnt);
+    if(style_value_cache_size - size_old + size > LV_OBJ_STYLE_VALUE_CACHE_SIZE) return NULL;
+
+    lv_obj_style_value_cache_t * cache = lv_malloc(size);
+    if(cache == NULL) return NULL;
+
+    /*The values are aligned as the size of the header is a multiple of the pointer size*/
+    cache->values = (lv_style_value_t *)(cache + 1);
+    cache->keys = (uint32_t *)(cache->values + slot_cnt);
+    cache->slot_cnt = (uint16_t)slot_cnt;
+    cache->used_cnt = 0;
+    lv_memzero(cache->keys, slot_cnt * sizeof(uint32_t));
+
+    obj->style_value_cache = cache;
+    style_value_cache_size += size - size_old;
+
+    if(cache_old) {
+        uint32_t i;
+        for(i = 0; i < cache_old->slot_cnt; i++) {
+            if(cache_old->keys[i]) style_value_cache_add(obj, cache_old->keys[i], cache_old->values[i]);
+        }
+        lv_free(cache_old);
+    }
+
+    return cache;
+}
+
+/**
+ * Add a value to the cache of a widget. The key shouldn't be in the cache yet.
+ * @param obj       pointer to a widget
+ * @param key       `(selector << 8) | prop`
+ * @param value     the resolved value
+ */
+static void style_value_cache_add(lv_obj_t * obj, uint32_t key, lv_style_value_t value)
+{
+    lv_obj_style_value_cache_t * cache = obj->style_value_cache;
+
+    /*Keep at least 1/4 of the slots free to keep the probe sequences short*/
+    if(cache == NULL || ((uint32_t)cache->used_cnt + 1) * 4 > (uint32_t)cache->slot_cnt * 3) {
+        lv_obj_style_value_cache_t * cache_grown = style_value_cache_grow(obj);
+        if(cache_grown) cache = cache_grown;
+        else if(cache) lv_obj_style_value_cache_invalidate(obj);  /*Start over with the values used recently*/
+        else return;
+    }
+
+    uint32_t mask = cache->slot_cnt - 1;
+    uint32_t i = style_value_cache_hash(key) & mask;
+    while(cache->keys[i]) {
+        i = (i + 1) & mask;
+    }
+
+    cache->keys[i] = key;
+    cache->values[i] = value;
+    cache->used_cnt++;
+}
+#endif
+
 #if LV_USE_OBSERVER
 
 static void bind_style_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
@@ -185,6 +185,20 @@ bool lv_obj_style_get_disabled(lv_obj_t * obj, const lv_style_t * style, lv_styl
  */
 void lv_obj_enable_style_refresh(bool en);
 
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+/**
+ * Get the statistics of the resolved style value cache (see `LV_OBJ_STYLE_VALUE_CACHE_SIZE`).
+ * @param hit_cnt   store the number of lookups served from the cache here (can be `NULL`)
+ * @param miss_cnt  store the number of lookups which resolved the value from the styles here (can be `NULL`)
+ */
+void lv_obj_style_value_cache_get_stats(uint32_t * hit_cnt, uint32_t * miss_cnt);
+
+/**
+ * Reset the hit and miss counters of the resolved style value cache.
+ */
+void lv_obj_style_value_cache_reset_stats(void);
+#endif
+
 /**
  * Get the value of a style property. The current state of the object will be considered.
  * Inherited properties will be inherited.
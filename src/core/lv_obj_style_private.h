@@ -41,6 +41,15 @@ struct _lv_obj_style_transition_dsc_t {
     void * user_data;
 };
 
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+/** Open addressing hash table of the resolved style values of a widget*/
+struct _lv_obj_style_value_cache_t {
+    lv_style_value_t * values;
+    uint32_t * keys;        /**< `(selector << 8) | prop` or 0 for empty slots*/
+    uint16_t slot_cnt;      /**< Always a power of 2*/
+    uint16_t used_cnt;
+};
+#endif
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -58,6 +67,20 @@ void lv_obj_style_init(void);
  */
 void lv_obj_style_deinit(void);
 
+/**
+ * Drop the cached style values of a widget.
+ * Called when its styles are changed.
+ * @param obj       pointer to a widget
+ */
+void lv_obj_style_value_cache_invalidate(lv_obj_t * obj);
+
+/**
+ * Free the style value cache of a widget.
+ * Called when the widget is deleted.
+ * @param obj       pointer to a widget
+ */
+void lv_obj_style_value_cache_free(lv_obj_t * obj);
+
 /**
  * Used internally to create a style transition
  * @param obj
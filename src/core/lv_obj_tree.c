@@ -7,13 +7,16 @@
  *      INCLUDES
  *********************/
 #include "lv_obj_private.h"
+#include "lv_obj_hit_index_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_pool_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../misc/lv_anim_private.h"
 #include "../misc/lv_async.h"
+#include "../misc/lv_event_private.h"
 #include "../core/lv_global.h"
 
 /*********************
@@ -21,6 +24,7 @@
  *********************/
 #define MY_CLASS (&lv_obj_class)
 #define disp_ll_p &(LV_GLOBAL_DEFAULT()->disp_ll)
+#define bulk_delete_p (LV_GLOBAL_DEFAULT()->obj_bulk_delete)
 
 #define OBJ_DUMP_STRING_LEN 128
 #define LV_OBJ_NAME_MAX_LEN 128
@@ -34,9 +38,21 @@
  **********************/
 static void lv_obj_delete_async_cb(void * obj);
 static void obj_delete_core(lv_obj_t * obj);
+static void obj_indev_release(lv_obj_t * obj);
+static void delete_children(lv_obj_t * parent);
+static uint32_t get_bulk_delete_count(lv_obj_t * obj);
+static void bulk_delete_tree(lv_obj_t * obj, lv_obj_bulk_delete_t * bulk);
+static void bulk_delete_start(lv_obj_bulk_delete_t * bulk);
+static void bulk_delete_finish(lv_obj_bulk_delete_t * bulk, lv_obj_t * parent, uint32_t gap_start,
+                               uint32_t gap_end);
+static void bulk_delete_destruct_tree(lv_obj_t * obj);
+static bool bulk_delete_reserve(lv_obj_bulk_delete_t * bulk, uint32_t cnt);
+static uint32_t bulk_delete_get_slot(const lv_obj_bulk_delete_t * bulk, const void * p);
+static bool bulk_delete_filter_cb(void * p, void * bulk);
+static void children_remove_range(lv_obj_t * parent, uint32_t index, uint32_t cnt);
 static lv_obj_tree_walk_res_t walk_core(lv_obj_t * obj, lv_obj_tree_walk_cb_t cb, void * user_data);
 static void dump_tree_core(lv_obj_t * obj, int32_t depth);
-static lv_obj_t * lv_obj_get_first_not_deleting_child(lv_obj_t * obj);
+static bool children_set_capacity(lv_obj_t * obj, uint32_t cap);
 #if LV_USE_OBJ_NAME
     static lv_obj_t * find_by_name_direct(const lv_obj_t * parent, const char * name, size_t len);
 #endif /*LV_USE_OBJ_NAME*/
@@ -99,11 +115,8 @@ void lv_obj_clean(lv_obj_t * obj)
     lv_obj_invalidate(obj);
 
     uint32_t cnt = lv_obj_get_child_count(obj);
-    lv_obj_t * child = lv_obj_get_first_not_deleting_child(obj);
-    while(child) {
-        obj_delete_core(child);
-        child = lv_obj_get_first_not_deleting_child(obj);
-    }
+    delete_children(obj);
+
     /*Just to remove scroll animations if any*/
     lv_obj_scroll_to(obj, 0, 0, LV_ANIM_OFF);
     if(obj->spec_attr) {
@@ -167,27 +180,13 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 
     lv_obj_allocate_spec_attr(parent);
 
+    /*Add the child to the new parent as the last (newest child).
+     *Do it first to keep the object on the old parent if there is no memory for it.*/
+    if(lv_obj_children_append(parent, obj) != LV_RESULT_OK) return;
+
     lv_obj_t * old_parent = obj->parent;
     /*Remove the object from the old parent's child list*/
-    int32_t i;
-    for(i = lv_obj_get_index(obj); i <= (int32_t)lv_obj_get_child_count(old_parent) - 2; i++) {
-        old_parent->spec_attr->children[i] = old_parent->spec_attr->children[i + 1];
-    }
-    old_parent->spec_attr->child_cnt--;
-    if(old_parent->spec_attr->child_cnt) {
-        old_parent->spec_attr->children = lv_realloc(old_parent->spec_attr->children,
-                                                     old_parent->spec_attr->child_cnt * (sizeof(lv_obj_t *)));
-    }
-    else {
-        lv_free(old_parent->spec_attr->children);
-        old_parent->spec_attr->children = NULL;
-    }
-
-    /*Add the child to the new parent as the last (newest child)*/
-    parent->spec_attr->child_cnt++;
-    parent->spec_attr->children = lv_realloc(parent->spec_attr->children,
-                                             parent->spec_attr->child_cnt * (sizeof(lv_obj_t *)));
-    parent->spec_attr->children[lv_obj_get_child_count(parent) - 1] = obj;
+    lv_obj_children_remove(old_parent, lv_obj_get_index(obj));
 
     obj->parent = parent;
 
@@ -205,6 +204,71 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
     lv_obj_invalidate(obj);
 }
 
+void lv_obj_move_children(lv_obj_t * obj, lv_obj_t * parent)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_OBJ(parent, MY_CLASS);
+
+    uint32_t cnt = lv_obj_get_child_count(obj);
+    if(cnt == 0) return;
+
+    const lv_obj_t * p;
+    for(p = parent; p; p = p->parent) {
+        if(p == obj) {
+            LV_LOG_WARN("Can't move the children to the object itself or to one of its descendants");
+            return;
+        }
+    }
+
+    lv_obj_allocate_spec_attr(parent);
+
+    uint32_t parent_cnt = parent->spec_attr->child_cnt;
+    if(parent_cnt + cnt > parent->spec_attr->child_cap) {
+        if(!children_set_capacity(parent, LV_MAX(parent_cnt + cnt, parent->spec_attr->child_cap * 2))) return;
+    }
+
+    lv_obj_t ** children = obj->spec_attr->children;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_invalidate(children[i]);
+        children[i]->parent = parent;
+    }
+
+    lv_memcpy(&parent->spec_attr->children[parent_cnt], children, cnt * sizeof(lv_obj_t *));
+    parent->spec_attr->child_cnt += cnt;
+    lv_obj_hit_index_children_changed(parent);
+
+    lv_free(children);
+    obj->spec_attr->children = NULL;
+    obj->spec_attr->child_cnt = 0;
+    obj->spec_attr->child_cap = 0;
+    lv_obj_hit_index_children_changed(obj);
+
+    /*Notify both parents only once about all the children*/
+    lv_obj_scrollbar_invalidate(obj);
+    lv_obj_send_event(obj, LV_EVENT_CHILD_CHANGED, NULL);
+    lv_obj_send_event(obj, LV_EVENT_CHILD_DELETED, NULL);
+
+    lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, NULL);
+    lv_obj_send_event(parent, LV_EVENT_CHILD_CREATED, NULL);
+
+    for(i = parent_cnt; i < parent_cnt + cnt; i++) {
+        lv_obj_t * child = parent->spec_attr->children[i];
+        lv_obj_mark_layout_as_dirty(child);
+        lv_obj_invalidate(child);
+    }
+}
+
+void lv_obj_reserve_children(lv_obj_t * obj, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_obj_allocate_spec_attr(obj);
+    if(cnt <= obj->spec_attr->child_cap) return;
+
+    children_set_capacity(obj, cnt);
+}
+
 void lv_obj_move_to_index(lv_obj_t * obj, int32_t index)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -250,6 +314,7 @@ void lv_obj_move_to_index(lv_obj_t * obj, int32_t index)
     }
 
     parent->spec_attr->children[index] = obj;
+    lv_obj_hit_index_children_changed(parent);
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, NULL);
     lv_obj_invalidate(parent);
 }
@@ -274,6 +339,9 @@ void lv_obj_swap(lv_obj_t * obj1, lv_obj_t * obj2)
     parent2->spec_attr->children[index2] = obj1;
     obj1->parent = parent2;
 
+    lv_obj_hit_index_children_changed(parent);
+    lv_obj_hit_index_children_changed(parent2);
+
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, obj2);
     lv_obj_send_event(parent, LV_EVENT_CHILD_CREATED, obj2);
     lv_obj_send_event(parent2, LV_EVENT_CHILD_CHANGED, obj1);
@@ -340,7 +408,7 @@ lv_obj_t * lv_obj_get_child(const lv_obj_t * obj, int32_t idx)
 
     uint32_t idu;
     if(idx < 0) {
-        idx = obj->spec_attr->child_cnt + idx;
+        idx = (int32_t)obj->spec_attr->child_cnt + idx;
         if(idx < 0) return NULL;
         idu = (uint32_t) idx;
     }
@@ -588,7 +656,7 @@ int32_t lv_obj_get_index(const lv_obj_t * obj)
     if(parent == NULL) return -1;
 
     int32_t i = 0;
-    for(i = 0; i < parent->spec_attr->child_cnt; i++) {
+    for(i = 0; i < (int32_t)parent->spec_attr->child_cnt; i++) {
         if(parent->spec_attr->children[i] == obj) return i;
     }
 
@@ -640,6 +708,36 @@ void lv_obj_dump_tree(lv_obj_t * start_obj)
     }
 }
 
+lv_result_t lv_obj_children_append(lv_obj_t * parent, lv_obj_t * child)
+{
+    lv_obj_spec_attr_t * spec_attr = parent->spec_attr;
+    if(spec_attr->child_cnt == spec_attr->child_cap) {
+        /*Grow geometrically to avoid reallocating and copying the array for each new child*/
+        uint32_t cap = spec_attr->child_cap < 4 ? spec_attr->child_cap + 1 : spec_attr->child_cap * 2;
+        if(!children_set_capacity(parent, cap)) return LV_RESULT_INVALID;
+    }
+
+    spec_attr->children[spec_attr->child_cnt] = child;
+    spec_attr->child_cnt++;
+    lv_obj_hit_index_children_changed(parent);
+    return LV_RESULT_OK;
+}
+
+void lv_obj_children_remove(lv_obj_t * parent, uint32_t index)
+{
+    LV_ASSERT(index < parent->spec_attr->child_cnt);
+
+    children_remove_range(parent, index, 1);
+}
+
+bool lv_obj_is_bulk_deleted(const lv_obj_t * obj)
+{
+    lv_obj_bulk_delete_t * bulk = bulk_delete_p;
+    if(bulk == NULL || bulk->item_cnt == 0) return false;
+
+    return bulk->slots[bulk_delete_get_slot(bulk, obj)] != 0;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -665,33 +763,14 @@ static void obj_indev_reset(lv_indev_t * indev, lv_obj_t * obj)
     lv_indev_reset(indev, obj);
 }
 
-static void obj_delete_core(lv_obj_t * obj)
+/**
+ * Reset the input devices which use an object to delete
+ * @param obj       pointer to an object which is being deleted
+ */
+static void obj_indev_release(lv_obj_t * obj)
 {
-    if(obj->is_deleting)
-        return;
-
-    obj->is_deleting = true;
-
-    /*Let the user free the resources used in `LV_EVENT_DELETE`*/
-    lv_result_t res = lv_obj_send_event(obj, LV_EVENT_DELETE, NULL);
-    if(res == LV_RESULT_INVALID) {
-        obj->is_deleting = false;
-        return;
-    }
-
-    /*Clean registered event_cb*/
-    if(obj->spec_attr) lv_event_remove_all(&(obj->spec_attr->event_list));
-
-    /*Recursively delete the children*/
-    lv_obj_t * child = lv_obj_get_child(obj, 0);
-    while(child) {
-        obj_delete_core(child);
-        child = lv_obj_get_child(obj, 0);
-    }
-
     lv_group_t * group = lv_obj_get_group(obj);
 
-    /*Reset all input devices if the object to delete is used*/
     lv_indev_t * indev = lv_indev_get_next(NULL);
     while(indev) {
         lv_indev_type_t indev_type = lv_indev_get_type(indev);
@@ -712,6 +791,29 @@ static void obj_delete_core(lv_obj_t * obj)
         }
         indev = lv_indev_get_next(indev);
     }
+}
+
+static void obj_delete_core(lv_obj_t * obj)
+{
+    if(obj->is_deleting)
+        return;
+
+    obj->is_deleting = true;
+
+    /*Let the user free the resources used in `LV_EVENT_DELETE`*/
+    lv_result_t res = lv_obj_send_event(obj, LV_EVENT_DELETE, NULL);
+    if(res == LV_RESULT_INVALID) {
+        obj->is_deleting = false;
+        return;
+    }
+
+    /*Clean registered event_cb*/
+    if(obj->spec_attr) lv_event_remove_all(&(obj->spec_attr->event_list));
+
+    /*Recursively delete the children*/
+    delete_children(obj);
+
+    obj_indev_release(obj);
 
     /*Delete all pending async del-s*/
     lv_result_t async_cancel_res = LV_RESULT_OK;
@@ -719,6 +821,9 @@ static void obj_delete_core(lv_obj_t * obj)
         async_cancel_res = lv_async_call_cancel(lv_obj_delete_async_cb, obj);
     }
 
+    /*The destructors reset `class_p` to the base classes so get the size first*/
+    uint32_t instance_size = lv_obj_class_get_instance_size(obj->class_p);
+
     /*All children deleted. Now clean up the object specific data*/
     lv_obj_destruct(obj);
 
@@ -740,18 +845,308 @@ static void obj_delete_core(lv_obj_t * obj)
     }
     /*Remove the object from the child list of its parent*/
     else {
-        int32_t id = lv_obj_get_index(obj);
-        uint16_t i;
-        for(i = id; i < obj->parent->spec_attr->child_cnt - 1; i++) {
-            obj->parent->spec_attr->children[i] = obj->parent->spec_attr->children[i + 1];
-        }
-        obj->parent->spec_attr->child_cnt--;
-        obj->parent->spec_attr->children = lv_realloc(obj->parent->spec_attr->children,
-                                                      obj->parent->spec_attr->child_cnt * sizeof(lv_obj_t *));
+        lv_obj_children_remove(obj->parent, lv_obj_get_index(obj));
     }
 
     /*Free the object itself*/
-    lv_free(obj);
+    lv_obj_pool_free(obj, instance_size);
+}
+
+/**
+ * Delete the children of an object which are not being deleted already.
+ * The subtrees without user delete callbacks are deleted in bulk: they stay in the children
+ * array until they are destructed from the last one, and their animations and async deletes
+ * are removed and their memory is freed together at the end. The other children are deleted
+ * one by one as usual so that their delete callbacks see the same widget tree as before.
+ * @param parent    pointer to an object
+ */
+static void delete_children(lv_obj_t * parent)
+{
+    if(parent->spec_attr == NULL || parent->spec_attr->child_cnt == 0) return;
+
+    lv_obj_bulk_delete_t bulk;
+    bulk_delete_start(&bulk);
+
+    /*The children to keep are moved to the beginning of the array and the
+     *bulk deleted ones leave a gap after them which is removed only when needed*/
+    uint32_t kept_cnt = 0;
+    uint32_t i = 0;
+    while(parent->spec_attr && i < parent->spec_attr->child_cnt) {
+        lv_obj_t * child = parent->spec_attr->children[i];
+        if(child->is_deleting) {
+            /*Swap it with the first bulk deleted child to keep the gap after the kept children*/
+            parent->spec_attr->children[i] = parent->spec_attr->children[kept_cnt];
+            parent->spec_attr->children[kept_cnt] = child;
+            kept_cnt++;
+            i++;
+            continue;
+        }
+
+        uint32_t tree_cnt = get_bulk_delete_count(child);
+        if(tree_cnt && bulk_delete_reserve(&bulk, tree_cnt)) {
+            bulk_delete_tree(child, &bulk);
+            i++;
+        }
+        else {
+            /*Let the user callbacks see only valid children and objects*/
+            bulk_delete_finish(&bulk, parent, kept_cnt, i);
+            bulk_delete_start(&bulk);
+
+            obj_delete_core(child);
+
+            /*The callbacks might have changed the children, so check them again*/
+            kept_cnt = 0;
+            i = 0;
+        }
+    }
+
+    bulk_delete_finish(&bulk, parent, kept_cnt, i);
+}
+
+/**
+ * Get the number of objects to delete if an object can be deleted in bulk
+ * @param obj       pointer to an object
+ * @return          number of objects in the subtree of `obj`, or 0 if there are user
+ *                  callbacks to call while deleting them
+ */
+static uint32_t get_bulk_delete_count(lv_obj_t * obj)
+{
+    if(obj->is_deleting) return 0;
+
+#if LV_USE_EXT_DATA
+    if(obj->ext_data.free_cb) return 0;
+#endif
+
+    if(obj->spec_attr == NULL) return 1;
+
+    /*Removing the object from its group sends focus events*/
+    if(obj->spec_attr->group_p) return 0;
+
+    lv_event_list_t * list = &obj->spec_attr->event_list;
+    uint32_t event_cnt = lv_event_get_count(list);
+    uint32_t i;
+    for(i = 0; i < event_cnt; i++) {
+        lv_event_code_t filter = lv_event_get_dsc(list, i)->filter & ~LV_EVENT_PREPROCESS;
+        if(filter == LV_EVENT_ALL || filter == LV_EVENT_DELETE) return 0;
+    }
+
+    uint32_t cnt = 1;
+    for(i = 0; i < obj->spec_attr->child_cnt; i++) {
+        uint32_t child_cnt = get_bulk_delete_count(obj->spec_attr->children[i]);
+        if(child_cnt == 0) return 0;
+        cnt += child_cnt;
+    }
+
+    return cnt;
+}
+
+/**
+ * Prepare an object and its children to be deleted in bulk. Only the class event handlers
+ * receive `LV_EVENT_DELETE` as `get_bulk_delete_count()` has found no user delete callbacks.
+ * They are destructed by `bulk_delete_finish()`.
+ * @param obj       pointer to an object
+ * @param bulk      the bulk delete to add the objects to
+ */
+static void bulk_delete_tree(lv_obj_t * obj, lv_obj_bulk_delete_t * bulk)
+{
+    obj->is_deleting = true;
+
+    lv_obj_send_event(obj, LV_EVENT_DELETE, NULL);
+    if(obj->spec_attr) {
+        lv_event_remove_all(&(obj->spec_attr->event_list));
+
+        /*The children stay in the array until they are destructed*/
+        uint32_t i;
+        for(i = 0; i < obj->spec_attr->child_cnt; i++) {
+            bulk_delete_tree(obj->spec_attr->children[i], bulk);
+        }
+    }
+
+    obj_indev_release(obj);
+
+    /*The class event handlers might have created new children. If there is no memory for
+     *them they are handled as usual by `bulk_delete_destruct_tree()`.*/
+    if(!bulk_delete_reserve(bulk, 1)) return;
+
+    /*The destructors reset `class_p` to the base classes so get the size now*/
+    lv_obj_bulk_delete_item_t * item = &bulk->items[bulk->item_cnt];
+    item->obj = obj;
+    item->instance_size = lv_obj_class_get_instance_size(obj->class_p);
+    bulk->item_cnt++;
+    bulk->slots[bulk_delete_get_slot(bulk, obj)] = bulk->item_cnt;
+}
+
+static void bulk_delete_start(lv_obj_bulk_delete_t * bulk)
+{
+    lv_memzero(bulk, sizeof(lv_obj_bulk_delete_t));
+    bulk->prev = bulk_delete_p;
+    bulk_delete_p = bulk;
+}
+
+/**
+ * Destruct the objects of a bulk delete, remove their animations and async deletes and free them
+ * @param bulk      pointer to a bulk delete started by `bulk_delete_start()`
+ * @param parent    the object whose children were deleted
+ * @param gap_start index of the first bulk deleted child of `parent`
+ * @param gap_end   index after the last bulk deleted child of `parent`
+ */
+static void bulk_delete_finish(lv_obj_bulk_delete_t * bulk, lv_obj_t * parent, uint32_t gap_start,
+                               uint32_t gap_end)
+{
+    /*Start from the last child so that usually it's the last one in the array and
+     *can be removed without moving the others*/
+    while(gap_end > gap_start) {
+        gap_end--;
+        bulk_delete_destruct_tree(parent->spec_attr->children[gap_end]);
+        children_remove_range(parent, gap_end, 1);
+    }
+
+    bulk_delete_p = bulk->prev;
+
+    if(bulk->item_cnt) {
+        lv_anim_delete_filtered(bulk_delete_filter_cb, bulk);
+        lv_async_call_cancel_filtered(lv_obj_delete_async_cb, bulk_delete_filter_cb, bulk);
+
+        uint32_t i;
+        for(i = 0; i < bulk->item_cnt; i++) {
+            lv_obj_pool_free(bulk->items[i].obj, bulk->items[i].instance_size);
+        }
+    }
+
+    lv_free(bulk->items);
+    lv_free(bulk->slots);
+    lv_memzero(bulk, sizeof(lv_obj_bulk_delete_t));
+}
+
+/**
+ * Destruct an object prepared by `bulk_delete_tree()` and its children.
+ * The children are destructed from the last one and are dropped from the array right after it,
+ * so the destructors see the same widget tree as when the children are deleted one by one.
+ * @param obj       pointer to an object
+ */
+static void bulk_delete_destruct_tree(lv_obj_t * obj)
+{
+    if(obj->spec_attr) {
+        while(obj->spec_attr->child_cnt) {
+            bulk_delete_destruct_tree(obj->spec_attr->children[obj->spec_attr->child_cnt - 1]);
+
+            /*The array is freed by the destructor of `obj`*/
+            obj->spec_attr->child_cnt--;
+        }
+    }
+
+    if(lv_obj_is_bulk_deleted(obj)) {
+        lv_obj_destruct(obj);
+        return;
+    }
+
+    /*It couldn't be added to the bulk delete so delete it as usual*/
+    lv_result_t async_cancel_res = LV_RESULT_OK;
+    while(async_cancel_res == LV_RESULT_OK) {
+        async_cancel_res = lv_async_call_cancel(lv_obj_delete_async_cb, obj);
+    }
+
+    uint32_t instance_size = lv_obj_class_get_instance_size(obj->class_p);
+    lv_obj_destruct(obj);
+    lv_obj_pool_free(obj, instance_size);
+}
+
+/**
+ * Make room for more objects in a bulk delete
+ * @param bulk      pointer to a bulk delete
+ * @param cnt       number of objects to add
+ * @return          true: success; false: out of memory
+ */
+static bool bulk_delete_reserve(lv_obj_bulk_delete_t * bulk, uint32_t cnt)
+{
+    uint32_t new_cnt = bulk->item_cnt + cnt;
+    if(new_cnt > bulk->item_cap) {
+        uint32_t new_cap = LV_MAX(new_cnt, bulk->item_cap * 2);
+        lv_obj_bulk_delete_item_t * items = lv_realloc(bulk->items, new_cap * sizeof(lv_obj_bulk_delete_item_t));
+        if(items == NULL) return false;
+
+        bulk->items = items;
+        bulk->item_cap = new_cap;
+    }
+
+    /*Keep the hash table at most half full to find the objects quickly*/
+    if(new_cnt * 2 > bulk->slot_cnt) {
+        uint32_t slot_cnt = bulk->slot_cnt ? bulk->slot_cnt * 2 : 64;
+        while(new_cnt * 2 > slot_cnt) slot_cnt *= 2;
+
+        uint32_t * slots = lv_malloc_zeroed(slot_cnt * sizeof(uint32_t));
+        if(slots == NULL) return false;
+
+        lv_free(bulk->slots);
+        bulk->slots = slots;
+        bulk->slot_cnt = slot_cnt;
+
+        uint32_t i;
+        for(i = 0; i < bulk->item_cnt; i++) {
+            bulk->slots[bulk_delete_get_slot(bulk, bulk->items[i].obj)] = i + 1;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Find the slot of a pointer in the hash table of a bulk delete
+ * @param bulk      pointer to a bulk delete with allocated slots
+ * @param p         the pointer to find
+ * @return          index of the slot storing `p` or of the empty slot where it can be stored
+ */
+static uint32_t bulk_delete_get_slot(const lv_obj_bulk_delete_t * bulk, const void * p)
+{
+    /*Mix the bits of the address as the lowest ones are the same due to the alignment*/
+    uint32_t h = (uint32_t)((lv_uintptr_t)p >> 3);
+    h ^= h >> 16;
+    h *= 0x45d9f3bU;
+    h ^= h >> 16;
+
+    uint32_t mask = bulk->slot_cnt - 1;
+    uint32_t i = h & mask;
+    while(bulk->slots[i] && bulk->items[bulk->slots[i] - 1].obj != p) {
+        i = (i + 1) & mask;
+    }
+
+    return i;
+}
+
+static bool bulk_delete_filter_cb(void * p, void * bulk)
+{
+    lv_obj_bulk_delete_t * b = bulk;
+    return b->slots[bulk_delete_get_slot(b, p)] != 0;
+}
+
+/**
+ * Remove consecutive children from the children array of an object
+ * @param parent    pointer to an object with allocated `spec_attr`
+ * @param index     index of the first child to remove
+ * @param cnt       number of children to remove
+ */
+static void children_remove_range(lv_obj_t * parent, uint32_t index, uint32_t cnt)
+{
+    if(cnt == 0) return;
+
+    lv_obj_spec_attr_t * spec_attr = parent->spec_attr;
+    lv_memmove(&spec_attr->children[index], &spec_attr->children[index + cnt],
+               (spec_attr->child_cnt - index - cnt) * sizeof(lv_obj_t *));
+    spec_attr->child_cnt -= cnt;
+    lv_obj_hit_index_children_changed(parent);
+
+    if(spec_attr->child_cnt == 0) {
+        lv_free(spec_attr->children);
+        spec_attr->children = NULL;
+        spec_attr->child_cap = 0;
+        return;
+    }
+
+    /*Shrink only if the array is mostly unused to avoid reallocating it
+     *back and forth when children are added and removed repeatedly*/
+    uint32_t cap = spec_attr->child_cap;
+    while(cap >= 8 && spec_attr->child_cnt <= cap / 4) cap /= 2;
+    if(cap != spec_attr->child_cap) children_set_capacity(parent, cap);
 }
 
 static lv_obj_tree_walk_res_t walk_core(lv_obj_t * obj, lv_obj_tree_walk_cb_t cb, void * user_data)
@@ -808,23 +1203,6 @@ static void dump_tree_core(lv_obj_t * obj, int32_t depth)
     }
 }
 
-static lv_obj_t * lv_obj_get_first_not_deleting_child(lv_obj_t * obj)
-{
-    LV_ASSERT_OBJ(obj, MY_CLASS);
-
-    if(obj->spec_attr == NULL) return NULL;
-
-    int32_t i;
-    int32_t cnt = (int32_t)obj->spec_attr->child_cnt;
-    for(i = 0; i < cnt; i++) {
-        if(!obj->spec_attr->children[i]->is_deleting) {
-            return obj->spec_attr->children[i];
-        }
-    }
-
-    return NULL;
-}
-
 #if LV_USE_OBJ_NAME
 
 static lv_obj_t * find_by_name_direct(const lv_obj_t * parent, const char * name, size_t len)
@@ -852,3 +1230,20 @@ static lv_obj_t * find_by_name_direct(const lv_obj_t * parent, const char * name
 }
 
 #endif /*LV_USE_OBJ_NAME*/
+
+/**
+ * Reallocate the children array of an object.
+ * @param obj   pointer to an object with allocated `spec_attr`
+ * @param cap   the new capacity. Must be at least the number of children.
+ * @return      true: success; false: out of memory, the array is unchanged
+ */
+static bool children_set_capacity(lv_obj_t * obj, uint32_t cap)
+{
+    lv_obj_t ** children = lv_realloc(obj->spec_attr->children, cap * sizeof(lv_obj_t *));
+    LV_ASSERT_MALLOC(children);
+    if(children == NULL) return false;
+
+    obj->spec_attr->children = children;
+    obj->spec_attr->child_cap = cap;
+    return true;
+}
@@ -82,6 +82,24 @@ void lv_obj_delete_async(lv_obj_t * obj);
  */
 void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent);
 
+/**
+ * Move all children of an object to a new parent in one step. The children keep
+ * their order and are added after the existing children of the new parent.
+ * It's much faster than calling `lv_obj_set_parent()` for each child.
+ * @param obj       pointer to an object whose children should be moved
+ * @param parent    pointer to the new parent. Can't be `obj` or one of its descendants.
+ */
+void lv_obj_move_children(lv_obj_t * obj, lv_obj_t * parent);
+
+/**
+ * Make room for `cnt` children in an object in advance, so creating them
+ * or moving them to the object doesn't need to reallocate the children array.
+ * @param obj       pointer to an object
+ * @param cnt       the number of children to make room for.
+ *                  Has no effect if it's not more than the current capacity.
+ */
+void lv_obj_reserve_children(lv_obj_t * obj, uint32_t cnt);
+
 /**
  * Swap the positions of two objects.
  * When used in listboxes, it can be used to sort the listbox items.
@@ -21,6 +21,8 @@
 #include "../misc/lv_profiler.h"
 #include "../misc/lv_types.h"
 #include "../draw/lv_draw_private.h"
+#include "../draw/lv_draw_display_list_private.h"
+#include "lv_obj_bitmap_cache_private.h"
 #include "../stdlib/lv_string.h"
 #include "lv_global.h"
 
@@ -38,9 +40,12 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static void lv_refr_join_area(void);
+static void lv_refr_join_area(lv_display_t * disp);
+static void inv_areas_sort(lv_area_t * areas, uint32_t cnt);
+static bool inv_areas_reserve(lv_display_t * disp);
 static void refr_invalid_areas(void);
-static void refr_sync_areas(void);
+static void refr_buf_age_areas(void);
+static void inv_areas_add(lv_display_t * disp, const lv_area_t * area_p);
 static void refr_area(const lv_area_t * area_p, int32_t y_offset);
 static void refr_configured_layer(lv_layer_t * layer);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
@@ -48,6 +53,13 @@ static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
 static void draw_buf_flush(lv_display_t * disp);
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 static void wait_for_flushing(lv_display_t * disp);
+static lv_display_ring_buf_t * get_ring_buf(lv_display_t * disp, const lv_draw_buf_t * buf);
+static void wait_for_ring_buf(lv_display_t * disp, const lv_draw_buf_t * buf);
+static lv_draw_buf_t * get_next_draw_buf(lv_display_t * disp);
+static void align_to_flush_tiles(lv_area_t * area, const lv_area_t * scr_area);
+static bool shrink_to_changed_tiles(lv_display_t * disp, lv_draw_buf_t * draw_buf, lv_area_t * area);
+static void move_to_buf_start(lv_draw_buf_t * draw_buf, const lv_area_t * area, const lv_area_t * part);
+static uint32_t tile_hash(const uint8_t * px, uint32_t row_bytes, int32_t h, uint32_t stride);
 static lv_result_t layer_get_area(lv_layer_t * layer, lv_obj_t * obj, lv_layer_type_t layer_type,
                                   lv_area_t * layer_area_out, lv_area_t * obj_draw_size_out);
 static bool alpha_test_area_on_obj(lv_obj_t * obj, const lv_area_t * area);
@@ -78,10 +90,12 @@ static bool alpha_test_area_on_obj(lv_obj_t * obj, const lv_area_t * area);
  */
 void lv_refr_init(void)
 {
+    lv_obj_bitmap_cache_init(LV_OBJ_BITMAP_CACHE_DEF_SIZE);
 }
 
 void lv_refr_deinit(void)
 {
+    lv_obj_bitmap_cache_deinit();
 }
 
 void lv_refr_now(lv_display_t * disp)
@@ -124,6 +138,30 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
     /*If the object is visible on the current clip area*/
     layer->_clip_area = clip_coords_for_obj;
 
+    lv_draw_display_list_t * display_list = NULL;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_DISPLAY_LIST)) {
+        lv_obj_allocate_spec_attr(obj);
+        if(obj->spec_attr->display_list == NULL) obj->spec_attr->display_list = lv_draw_display_list_create();
+        display_list = obj->spec_attr->display_list;
+
+        /*Nothing has changed since recording, just add the same draw tasks again*/
+        if(display_list && display_list->ready) {
+            lv_draw_display_list_replay(display_list, layer, &obj->coords);
+            layer->_clip_area = clip_area_ori;
+            LV_PROFILER_REFR_END;
+            return;
+        }
+
+        /*Record only if the whole widget is drawn now and a parent is not being recorded*/
+        if(display_list && !display_list->unsupported && layer->display_list == NULL &&
+           lv_area_is_in(&obj_coords_ext, &clip_area_ori, 0)) {
+            lv_draw_display_list_record_start(display_list, layer, &obj->coords);
+        }
+        else {
+            display_list = NULL;
+        }
+    }
+
     lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_BEGIN, layer);
     lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN, layer);
     lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_END, layer);
@@ -261,6 +299,8 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
         }
     }
 
+    if(display_list) lv_draw_display_list_record_end(display_list, layer);
+
     layer->_clip_area = clip_area_ori;
 
     LV_PROFILER_REFR_END;
@@ -284,6 +324,8 @@ lv_result_t lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
      * and move widget property/style modifications to other events.
      */
     LV_ASSERT_MSG(!disp->rendering_in_progress, "Invalidate area is not allowed during rendering.");
+    /*The invalidated areas are being drawn and will be cleared after that anyway*/
+    if(disp->rendering_in_progress) return LV_RESULT_INVALID;
 
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
@@ -312,6 +354,8 @@ lv_result_t lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
 
     /*If there were at least 1 invalid area in full refresh mode, redraw the whole screen*/
     if(disp->render_mode == LV_DISPLAY_RENDER_MODE_FULL) {
+        disp->inv_p = 0;
+        if(!inv_areas_reserve(disp)) return LV_RESULT_INVALID;
         disp->inv_areas[0] = scr_area;
         disp->inv_p = 1;
         lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
@@ -321,20 +365,19 @@ lv_result_t lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     lv_result_t res = lv_display_send_event(disp, LV_EVENT_INVALIDATE_AREA, &com_area);
     if(res != LV_RESULT_OK) return LV_RESULT_INVALID;
 
+    if(disp->flush_skip_unchanged && disp->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) {
+        align_to_flush_tiles(&com_area, &scr_area);
+    }
+
     /*Save only if this area is not in one of the saved areas*/
-    uint16_t i;
+    uint32_t i;
     for(i = 0; i < disp->inv_p; i++) {
         if(lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return LV_RESULT_OK;
     }
 
     /*Save the area*/
-    lv_area_t * tmp_area_p = &com_area;
-    if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        tmp_area_p = &scr_area;
-    }
-    lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
-    disp->inv_p++;
+    if(disp->inv_area_cap == 0 && !inv_areas_reserve(disp)) return LV_RESULT_INVALID;
+    inv_areas_add(disp, &com_area);
 
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 
@@ -414,26 +457,10 @@ void lv_display_refr_timer(lv_timer_t * tmr)
         goto refr_finish;
     }
 
-    lv_refr_join_area();
-    refr_sync_areas();
+    lv_refr_join_area(disp_refr);
+    refr_buf_age_areas();
     refr_invalid_areas();
 
-    if(disp_refr->inv_p == 0) goto refr_finish;
-    /*In double buffered direct mode save the updated areas.
-     *They will be used on the next call to synchronize the buffers.*/
-    if(lv_display_is_double_buffered(disp_refr) && disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) {
-        uint32_t i;
-        for(i = 0; i < disp_refr->inv_p; i++) {
-            if(disp_refr->inv_area_joined[i])
-                continue;
-
-            lv_area_t * sync_area = lv_ll_ins_tail(&disp_refr->sync_areas);
-            *sync_area = disp_refr->inv_areas[i];
-        }
-    }
-
-    lv_memzero(disp_refr->inv_areas, sizeof(disp_refr->inv_areas));
-    lv_memzero(disp_refr->inv_area_joined, sizeof(disp_refr->inv_area_joined));
     disp_refr->inv_p = 0;
 
 refr_finish:
@@ -442,6 +469,9 @@ refr_finish:
     lv_draw_sw_mask_cleanup();
 #endif
 
+    lv_draw_task_pool_release();
+    lv_obj_bitmap_cache_release_used();
+
     lv_display_send_event(disp_refr, LV_EVENT_REFR_READY, NULL);
 
     LV_TRACE_REFR("finished");
@@ -514,7 +544,10 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
 
     lv_layer_type_t layer_type = lv_obj_get_layer_type(obj);
     if(layer_type == LV_LAYER_TYPE_NONE) {
-        lv_obj_redraw(layer, obj);
+        /*Draw the cached bitmap of the widget if possible*/
+        if(!lv_obj_has_flag(obj, LV_OBJ_FLAG_CACHE_BITMAP) || lv_obj_bitmap_cache_draw(layer, obj) != LV_RESULT_OK) {
+            lv_obj_redraw(layer, obj);
+        }
     }
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     /*If the layer opa is full then use the matrix transform*/
@@ -613,143 +646,221 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Join the invalidated areas if it makes the refresh cheaper and remove the joined areas from the list.
+ * The cost of an area is its size plus `LV_INV_AREA_OVERHEAD` pixels.
+ * @param disp      pointer to a display
  */
-static void lv_refr_join_area(void)
+static void lv_refr_join_area(lv_display_t * disp)
 {
+    if(disp->inv_p < 2) return;
     LV_PROFILER_REFR_BEGIN;
-    uint32_t join_from;
-    uint32_t join_in;
-    lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
-
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
-            }
 
-            /*Check if the areas are on each other*/
-            if(lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
-            }
+    lv_area_t * areas = disp->inv_areas;
+    uint32_t cnt = disp->inv_p;
 
-            lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+    /*Sort the areas by their top edge, so only the areas close to each other vertically need to be compared*/
+    inv_areas_sort(areas, cnt);
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+    /*The joined areas are marked by making them invalid (x2 < x1).
+     *An area is always joined into the one with the smaller y1, so the list remains sorted.*/
+    uint32_t i;
+    uint32_t j;
+    bool joined;
+    do {
+        joined = false;
+        for(i = 0; i < cnt; i++) {
+            if(areas[i].x2 < areas[i].x1) continue;
+
+            /*Always do the join which saves the most, until no join saves anything*/
+            while(1) {
+                int32_t w_i = lv_area_get_width(&areas[i]);
+                uint32_t size_i = lv_area_get_size(&areas[i]);
+                uint32_t best_saving = 0;
+                uint32_t best_j = 0;
+                for(j = i + 1; j < cnt; j++) {
+                    /*The rows between the areas are redrawn too if they are joined.
+                     *If that's already more than the saved overhead, the next areas are even farther.*/
+                    int32_t gap = areas[j].y1 - areas[i].y2 - 1;
+                    if(gap > 0 && (uint32_t)gap * w_i >= LV_INV_AREA_OVERHEAD) break;
+
+                    if(areas[j].x2 < areas[j].x1) continue;
+
+                    /*Separately the common part is redrawn twice,
+                     *but when joined the corners of the bounding box are redrawn too*/
+                    lv_area_t joined_area;
+                    lv_area_join(&joined_area, &areas[i], &areas[j]);
+                    uint32_t cost_separate = size_i + lv_area_get_size(&areas[j]) + LV_INV_AREA_OVERHEAD;
+                    uint32_t cost_joined = lv_area_get_size(&joined_area);
+                    if(cost_joined < cost_separate && cost_separate - cost_joined > best_saving) {
+                        best_saving = cost_separate - cost_joined;
+                        best_j = j;
+                    }
+                }
+
+                if(best_saving == 0) break;
 
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
+                lv_area_join(&areas[i], &areas[i], &areas[best_j]);
+                areas[best_j].x2 = areas[best_j].x1 - 1;
+                joined = true;
             }
         }
+        /*A grown area might be close to the areas checked before, so check all again*/
+    } while(joined);
+
+    /*Remove the joined areas*/
+    disp->inv_p = 0;
+    for(i = 0; i < cnt; i++) {
+        if(areas[i].x2 < areas[i].x1) continue;
+        areas[disp->inv_p] = areas[i];
+        disp->inv_p++;
     }
+
     LV_PROFILER_REFR_END;
 }
 
 /**
- * Refresh the sync areas
+ * Sort areas by their y1 coordinate using Shell sort
+ * @param areas     array of areas
+ * @param cnt       number of areas
  */
-static void refr_sync_areas(void)
+static void inv_areas_sort(lv_area_t * areas, uint32_t cnt)
 {
-    /*Do not sync if not direct or double buffered*/
-    if(disp_refr->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT) return;
-
-    /*Do not sync if not double buffered*/
-    if(!lv_display_is_double_buffered(disp_refr)) return;
+    uint32_t gap;
+    for(gap = cnt / 2; gap > 0; gap /= 2) {
+        uint32_t i;
+        for(i = gap; i < cnt; i++) {
+            lv_area_t tmp = areas[i];
+            uint32_t j = i;
+            while(j >= gap && areas[j - gap].y1 > tmp.y1) {
+                areas[j] = areas[j - gap];
+                j -= gap;
+            }
+            areas[j] = tmp;
+        }
+    }
+}
 
-    /*Do not sync if no sync areas*/
-    if(lv_ll_is_empty(&disp_refr->sync_areas)) return;
+/**
+ * Add an area to the invalidated areas. If there is no memory for it, invalidate the whole screen.
+ * There should be space for at least one area.
+ * @param disp      pointer to a display
+ * @param area_p    the area to add
+ */
+static void inv_areas_add(lv_display_t * disp, const lv_area_t * area_p)
+{
+    if(inv_areas_reserve(disp)) {
+        disp->inv_areas[disp->inv_p] = *area_p;
+    }
+    else {
+        disp->inv_areas[0].x1 = 0;
+        disp->inv_areas[0].y1 = 0;
+        disp->inv_areas[0].x2 = lv_display_get_horizontal_resolution(disp) - 1;
+        disp->inv_areas[0].y2 = lv_display_get_vertical_resolution(disp) - 1;
+        disp->inv_p = 0;
+    }
+    disp->inv_p++;
+}
 
-    LV_PROFILER_REFR_BEGIN;
-    /*With double buffered direct mode synchronize the rendered areas to the other buffer*/
-    /*We need to wait for ready here to not mess up the active screen*/
-    wait_for_flushing(disp_refr);
+/**
+ * Make room for a new invalidated area. First join the overlapping areas,
+ * and grow the buffer only if it's still mostly full.
+ * @param disp      pointer to a display
+ * @return          true: a new area can be added; false: out of memory
+ */
+static bool inv_areas_reserve(lv_display_t * disp)
+{
+    if(disp->inv_p < disp->inv_area_cap) return true;
 
-    /*The buffers are already swapped.
-     *So the active buffer is the off screen buffer where LVGL will render*/
-    lv_draw_buf_t * off_screen = disp_refr->buf_act;
-    /*Triple buffer sync buffer for off-screen2 updates.*/
-    lv_draw_buf_t * off_screen2;
-    lv_draw_buf_t * on_screen;
+    lv_refr_join_area(disp);
+    if(disp->inv_area_cap != 0 && disp->inv_p <= disp->inv_area_cap * 3 / 4) return true;
 
-    if(disp_refr->buf_act == disp_refr->buf_1) {
-        off_screen2 = disp_refr->buf_2;
-        on_screen = disp_refr->buf_3 ? disp_refr->buf_3 : disp_refr->buf_2;
-    }
-    else if(disp_refr->buf_act == disp_refr->buf_2) {
-        off_screen2 = disp_refr->buf_3 ? disp_refr->buf_3 : disp_refr->buf_1;
-        on_screen = disp_refr->buf_1;
-    }
-    else {
-        off_screen2 = disp_refr->buf_1;
-        on_screen = disp_refr->buf_2;
+    uint32_t new_cap = disp->inv_area_cap == 0 ? LV_INV_BUF_SIZE : disp->inv_area_cap * 2;
+    lv_area_t * new_areas = lv_realloc(disp->inv_areas, new_cap * sizeof(lv_area_t));
+    if(new_areas == NULL) {
+        LV_LOG_WARN("Couldn't grow the invalidated area buffer to %" LV_PRIu32 " areas", new_cap);
+        return disp->inv_p < disp->inv_area_cap;
     }
 
-    uint32_t hor_res = lv_display_get_horizontal_resolution(disp_refr);
-    uint32_t ver_res = lv_display_get_vertical_resolution(disp_refr);
+    disp->inv_areas = new_areas;
+    disp->inv_area_cap = new_cap;
+    return true;
+}
 
-    /*Iterate through invalidated areas to see if sync area should be copied*/
-    uint16_t i;
-    int8_t j;
-    lv_area_t res[4] = {0};
-    int8_t res_c;
-    lv_area_t * sync_area, * new_area, * next_area;
-    for(i = 0; i < disp_refr->inv_p; i++) {
-        /*Skip joined areas*/
-        if(disp_refr->inv_area_joined[i]) continue;
-
-        /*Iterate over sync areas*/
-        sync_area = lv_ll_get_head(&disp_refr->sync_areas);
-        while(sync_area != NULL) {
-            /*Get next sync area*/
-            next_area = lv_ll_get_next(&disp_refr->sync_areas, sync_area);
-
-            /*Remove intersect of redraw area from sync area and get remaining areas*/
-            res_c = lv_area_diff(res, sync_area, &disp_refr->inv_areas[i]);
-
-            /*New sub areas created after removing intersect*/
-            if(res_c != -1) {
-                /*Replace old sync area with new areas*/
-                for(j = 0; j < res_c; j++) {
-                    new_area = lv_ll_ins_prev(&disp_refr->sync_areas, sync_area);
-                    *new_area = res[j];
-                }
-                lv_ll_remove(&disp_refr->sync_areas, sync_area);
-                lv_free(sync_area);
-            }
+/**
+ * In DIRECT mode the active buffer might not contain the last frames yet, e.g. with double buffering
+ * the other buffer was updated in the last frame. Save the damage of the current frame and
+ * add the damage of the frames missing from the buffer to the invalidated areas.
+ */
+static void refr_buf_age_areas(void)
+{
+    if(disp_refr->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT) return;
+    if(disp_refr->inv_p == 0) return;
 
-            /*Move on to next sync area*/
-            sync_area = next_area;
-        }
+    LV_PROFILER_REFR_BEGIN;
+
+    /*With double buffering the buffers are swapped only after the last area is flushed.
+     *Wait for it before rendering to not draw into the buffer which is being sent to the display.
+     *With a buffer ring only the buffer to render into is waited for in `refr_configured_layer()`.*/
+    if(lv_display_is_double_buffered(disp_refr) && disp_refr->buf_ring == NULL) {
+        wait_for_flushing(disp_refr);
     }
 
-    lv_area_t disp_area = {0, 0, (int32_t)hor_res - 1, (int32_t)ver_res - 1};
-    /*Copy sync areas (if any remaining)*/
-    for(sync_area = lv_ll_get_head(&disp_refr->sync_areas); sync_area != NULL;
-        sync_area = lv_ll_get_next(&disp_refr->sync_areas, sync_area)) {
-        /**
-         * @todo Resize SDL window will trigger crash because of sync_area is larger than disp_area
-         */
-        if(!lv_area_intersect(sync_area, sync_area, &disp_area)) {
-            continue;
+    bool age_reported = disp_refr->buf_age >= 0;
+    uint32_t age = lv_display_get_buf_age(disp_refr);
+    disp_refr->buf_age = -1;
+
+    /*Save the damage of this frame in place of the oldest frame. It's not needed anymore
+     *as the history can be used only for ages up to LV_DISPLAY_DAMAGE_HISTORY_CNT.
+     *A single buffer always contains the last frame, so the history is not needed
+     *unless the driver reports the age.*/
+    uint32_t last = disp_refr->damage_history_last;
+    uint32_t next = (last + 1) % LV_DISPLAY_DAMAGE_HISTORY_CNT;
+    bool saved = lv_display_is_double_buffered(disp_refr) || age_reported;
+    uint32_t i;
+    if(saved) {
+        lv_array_t * damage = &disp_refr->damage_history[next];
+        lv_array_clear(damage);
+        for(i = 0; i < disp_refr->inv_p; i++) {
+            if(lv_array_push_back(damage, &disp_refr->inv_areas[i]) != LV_RESULT_OK) {
+                saved = false;
+                break;
+            }
         }
-#if LV_DRAW_TRANSFORM_USE_MATRIX
-        if(lv_display_get_matrix_rotation(disp_refr)) {
-            lv_display_rotate_area(disp_refr, sync_area);
+    }
+
+    /*Redraw the areas of the last age - 1 frames too*/
+    if(age == 0 || age - 1 > disp_refr->damage_history_cnt) {
+        lv_area_t scr_area;
+        scr_area.x1 = 0;
+        scr_area.y1 = 0;
+        scr_area.x2 = lv_display_get_horizontal_resolution(disp_refr) - 1;
+        scr_area.y2 = lv_display_get_vertical_resolution(disp_refr) - 1;
+        disp_refr->inv_p = 0;
+        inv_areas_add(disp_refr, &scr_area);
+    }
+    else if(age > 1) {
+        uint32_t f;
+        for(f = 0; f < age - 1; f++) {
+            lv_array_t * prev_damage = &disp_refr->damage_history[(last + LV_DISPLAY_DAMAGE_HISTORY_CNT - f) %
+                                                                  LV_DISPLAY_DAMAGE_HISTORY_CNT];
+            uint32_t prev_cnt = lv_array_size(prev_damage);
+            for(i = 0; i < prev_cnt; i++) {
+                inv_areas_add(disp_refr, lv_array_at(prev_damage, i));
+            }
         }
-#endif
-        lv_draw_buf_copy(off_screen, sync_area, on_screen, sync_area);
-        if(off_screen2 != on_screen)
-            lv_draw_buf_copy(off_screen2, sync_area, on_screen, sync_area);
+        lv_refr_join_area(disp_refr);
     }
 
-    /*Clear sync areas*/
-    lv_ll_clear(&disp_refr->sync_areas);
+    disp_refr->damage_history_last = next;
+    if(saved == false) disp_refr->damage_history_cnt = 0;
+    else if(disp_refr->damage_history_cnt < LV_DISPLAY_DAMAGE_HISTORY_CNT - 1) disp_refr->damage_history_cnt++;
+
+    /*The buffer will contain this frame*/
+    disp_refr->frame_cnt++;
+    if(disp_refr->buf_act == disp_refr->buf_1) disp_refr->buf_frame[0] = disp_refr->frame_cnt;
+    else if(disp_refr->buf_act == disp_refr->buf_2) disp_refr->buf_frame[1] = disp_refr->frame_cnt;
+    else if(disp_refr->buf_act == disp_refr->buf_3) disp_refr->buf_frame[2] = disp_refr->frame_cnt;
+
     LV_PROFILER_REFR_END;
 }
 
@@ -764,24 +875,15 @@ static void refr_invalid_areas(void)
     /*Notify the display driven rendering has started*/
     lv_display_send_event(disp_refr, LV_EVENT_RENDER_START, NULL);
 
-    /*Find the last area which will be drawn*/
-    int32_t i;
-    int32_t last_i = 0;
-    for(i = disp_refr->inv_p - 1; i >= 0; i--) {
-        if(disp_refr->inv_area_joined[i] == 0) {
-            last_i = i;
-            break;
-        }
-    }
+    uint32_t i;
+    uint32_t last_i = disp_refr->inv_p - 1;
 
     disp_refr->last_area = 0;
     disp_refr->last_part = 0;
+    disp_refr->flushed_in_refr = 0;
     disp_refr->rendering_in_progress = true;
 
-    for(i = 0; i < (int32_t)disp_refr->inv_p; i++) {
-        /*Refresh the unjoined areas*/
-        if(disp_refr->inv_area_joined[i]) continue;
-
+    for(i = 0; i < disp_refr->inv_p; i++) {
         if(i == last_i) disp_refr->last_area = 1;
         disp_refr->last_part = 0;
 
@@ -1026,8 +1128,12 @@ static void refr_configured_layer(lv_layer_t * layer)
 #endif /* LV_DRAW_TRANSFORM_USE_MATRIX */
 
     /* In single buffered mode wait here until the buffer is freed.
-     * Else we would draw into the buffer while it's still being transferred to the display*/
-    if(!lv_display_is_double_buffered(disp_refr)) {
+     * Else we would draw into the buffer while it's still being transferred to the display.
+     * With a buffer ring wait only if the active buffer is still being flushed.*/
+    if(disp_refr->buf_ring) {
+        wait_for_ring_buf(disp_refr, disp_refr->buf_act);
+    }
+    else if(!lv_display_is_double_buffered(disp_refr)) {
         wait_for_flushing(disp_refr);
     }
     /*If the screen is transparent initialize it when the flushing is ready*/
@@ -1037,6 +1143,9 @@ static void refr_configured_layer(lv_layer_t * layer)
         lv_draw_buf_clear(layer->draw_buf, &clear_area);
     }
 
+    /*Let the draw units know that more draw tasks are coming*/
+    layer->adding_tasks = true;
+
     lv_obj_t * top_act_scr = NULL;
     lv_obj_t * top_prev_scr = NULL;
 
@@ -1076,6 +1185,10 @@ static void refr_configured_layer(lv_layer_t * layer)
     refr_obj_and_children(layer, lv_display_get_layer_top(disp_refr));
     refr_obj_and_children(layer, lv_display_get_layer_sys(disp_refr));
 
+    /*The draw units might have waited for all the draw tasks. Let them start now.*/
+    layer->adding_tasks = false;
+    lv_draw_dispatch_request();
+
     LV_PROFILER_REFR_END;
 }
 
@@ -1362,6 +1475,11 @@ static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
         max_row = tmp.y2 + 1;
     }
 
+    /*Keep the bands aligned to the tiles whose hashes are compared*/
+    if(disp->flush_skip_unchanged && max_row < area_h && max_row > LV_DISPLAY_FLUSH_TILE_SIZE) {
+        max_row -= max_row % LV_DISPLAY_FLUSH_TILE_SIZE;
+    }
+
     return max_row;
 }
 
@@ -1378,36 +1496,76 @@ static void draw_buf_flush(lv_display_t * disp)
         lv_draw_dispatch();
     }
 
+    /*Flush only the tiles which changed since they were flushed last time*/
+    lv_area_t flush_area = disp->refreshed_area;
+    bool skip_flush = false;
+    if(disp->flush_skip_unchanged && disp->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) {
+        skip_flush = !shrink_to_changed_tiles(disp, layer->draw_buf, &flush_area);
+
+        /*Many drivers show the new content only on the last flush of a refresh,
+         *so if other areas were flushed, flush a single tile to report the last flush*/
+        if(skip_flush && disp->last_area && disp->last_part && disp->flushed_in_refr) {
+            lv_area_t tile_area = flush_area;
+            tile_area.x2 = LV_MIN(tile_area.x2, tile_area.x1 + LV_DISPLAY_FLUSH_TILE_SIZE - 1);
+            tile_area.y2 = LV_MIN(tile_area.y2, tile_area.y1 + LV_DISPLAY_FLUSH_TILE_SIZE - 1);
+            move_to_buf_start(layer->draw_buf, &flush_area, &tile_area);
+            flush_area = tile_area;
+            skip_flush = false;
+        }
+    }
+
     /* In double buffered mode wait until the other buffer is freed
      * and driver is ready to receive the new buffer.
      * If we need to wait here it means that the content of one buffer is being sent to display
-     * and other buffer already contains the new rendered image. */
-    if(lv_display_is_double_buffered(disp)) {
+     * and other buffer already contains the new rendered image.
+     * With a buffer ring the driver can queue the flushes, so don't wait. */
+    lv_display_ring_buf_t * ring_buf = get_ring_buf(disp, disp->buf_act);
+    if(lv_display_is_double_buffered(disp) && ring_buf == NULL) {
         wait_for_flushing(disp_refr);
     }
 
-    disp->flushing = 1;
+    if(skip_flush) {
+        /*Nothing to flush, the buffer can be used again right away*/
+    }
+    else if(ring_buf) {
+        disp->buf_ring_flush_cnt++;
+        if(disp->buf_ring_flush_cnt == 0) disp->buf_ring_flush_cnt = 1;
+        ring_buf->flush_id = disp->buf_ring_flush_cnt;
+    }
+    else {
+        disp->flushing = 1;
+    }
 
     if(disp->last_area && disp->last_part) disp->flushing_last = 1;
     else disp->flushing_last = 0;
 
     bool flushing_last = disp->flushing_last;
 
-    if(disp->flush_cb) {
-        call_flush_cb(disp, &disp->refreshed_area, layer->draw_buf->data);
+    if(disp->flush_cb && !skip_flush) {
+        disp->flushed_in_refr = 1;
+        call_flush_cb(disp, &flush_area, layer->draw_buf->data);
     }
     /*If there are 2 buffers swap them. With direct mode swap only on the last area*/
     if(lv_display_is_double_buffered(disp) && (disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT || flushing_last)) {
-        if(disp->buf_act == disp->buf_1) {
-            disp->buf_act = disp->buf_2;
-        }
-        else if(disp->buf_act == disp->buf_2) {
-            disp->buf_act = disp->buf_3 ? disp->buf_3 : disp->buf_1;
-        }
-        else {
-            disp->buf_act = disp->buf_1;
+        disp->buf_act = get_next_draw_buf(disp);
+    }
+}
+
+static lv_draw_buf_t * get_next_draw_buf(lv_display_t * disp)
+{
+    if(disp->buf_ring) {
+        uint32_t i;
+        for(i = 0; i < disp->buf_ring_cnt; i++) {
+            if(disp->buf_ring[i].draw_buf == disp->buf_act) {
+                return disp->buf_ring[(i + 1) % disp->buf_ring_cnt].draw_buf;
+            }
         }
+        return disp->buf_1;
     }
+
+    if(disp->buf_act == disp->buf_1) return disp->buf_2;
+    else if(disp->buf_act == disp->buf_2) return disp->buf_3 ? disp->buf_3 : disp->buf_1;
+    else return disp->buf_1;
 }
 
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
@@ -1459,3 +1617,190 @@ static void wait_for_flushing(lv_display_t * disp)
     LV_LOG_TRACE("end");
     LV_PROFILER_REFR_END;
 }
+
+/**
+ * Round an area to the tiles whose hashes are compared before flushing
+ * @param area      pointer to an area to round
+ * @param scr_area  the area of the screen to clip the result to
+ */
+static void align_to_flush_tiles(lv_area_t * area, const lv_area_t * scr_area)
+{
+    area->x1 = LV_MAX(area->x1, 0);
+    area->y1 = LV_MAX(area->y1, 0);
+    area->x1 -= area->x1 % LV_DISPLAY_FLUSH_TILE_SIZE;
+    area->y1 -= area->y1 % LV_DISPLAY_FLUSH_TILE_SIZE;
+    area->x2 = LV_MIN(area->x2 - area->x2 % LV_DISPLAY_FLUSH_TILE_SIZE + LV_DISPLAY_FLUSH_TILE_SIZE - 1, scr_area->x2);
+    area->y2 = LV_MIN(area->y2 - area->y2 % LV_DISPLAY_FLUSH_TILE_SIZE + LV_DISPLAY_FLUSH_TILE_SIZE - 1, scr_area->y2);
+}
+
+/**
+ * Hash the tiles of a rendered area and compare them with the hashes of the last flushed tiles.
+ * Shrink the area to the changed tiles and move its pixels to the beginning of the buffer.
+ * @param disp      pointer to a display
+ * @param draw_buf  the buffer `area` was rendered into. Reshaped if the area is shrunk.
+ * @param area      the rendered area. Set to the area to flush.
+ * @return          true: some tiles changed and `area` needs to be flushed; false: nothing changed
+ */
+static bool shrink_to_changed_tiles(lv_display_t * disp, lv_draw_buf_t * draw_buf, lv_area_t * area)
+{
+    lv_color_format_t cf = draw_buf->header.cf;
+    if(LV_COLOR_FORMAT_IS_INDEXED(cf) || lv_color_format_get_bpp(cf) < 8) return true;
+
+    int32_t hor_res = lv_display_get_horizontal_resolution(disp);
+    int32_t ver_res = lv_display_get_vertical_resolution(disp);
+    if(disp->tile_hashes == NULL) {
+        uint32_t col_cnt = (hor_res + LV_DISPLAY_FLUSH_TILE_SIZE - 1) / LV_DISPLAY_FLUSH_TILE_SIZE;
+        uint32_t row_cnt = (ver_res + LV_DISPLAY_FLUSH_TILE_SIZE - 1) / LV_DISPLAY_FLUSH_TILE_SIZE;
+        disp->tile_hashes = lv_malloc_zeroed(col_cnt * row_cnt * sizeof(uint32_t));
+        LV_ASSERT_MALLOC(disp->tile_hashes);
+        if(disp->tile_hashes == NULL) return true;
+        disp->tile_hash_col_cnt = col_cnt;
+        disp->tile_hash_row_cnt = row_cnt;
+    }
+
+    uint32_t px_size = lv_color_format_get_size(cf);
+    uint32_t stride = draw_buf->header.stride;
+    lv_area_t changed = {INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN};
+    lv_area_t tile;
+    int32_t ty;
+    for(ty = area->y1 / LV_DISPLAY_FLUSH_TILE_SIZE; ty <= area->y2 / LV_DISPLAY_FLUSH_TILE_SIZE; ty++) {
+        tile.y1 = ty * LV_DISPLAY_FLUSH_TILE_SIZE;
+        tile.y2 = LV_MIN(tile.y1 + LV_DISPLAY_FLUSH_TILE_SIZE - 1, ver_res - 1);
+        uint32_t * hashes = &disp->tile_hashes[ty * disp->tile_hash_col_cnt];
+        int32_t tx;
+        for(tx = area->x1 / LV_DISPLAY_FLUSH_TILE_SIZE; tx <= area->x2 / LV_DISPLAY_FLUSH_TILE_SIZE; tx++) {
+            tile.x1 = tx * LV_DISPLAY_FLUSH_TILE_SIZE;
+            tile.x2 = LV_MIN(tile.x1 + LV_DISPLAY_FLUSH_TILE_SIZE - 1, hor_res - 1);
+
+            bool tile_changed;
+            if(lv_area_is_in(&tile, area, 0)) {
+                const uint8_t * px = draw_buf->data + (tile.y1 - area->y1) * stride + (tile.x1 - area->x1) * px_size;
+                uint32_t hash = tile_hash(px, lv_area_get_width(&tile) * px_size, lv_area_get_height(&tile), stride);
+                tile_changed = hash != hashes[tx];
+                hashes[tx] = hash;
+            }
+            else {
+                /*Only a part of the tile is flushed so the hash of the whole tile is unknown*/
+                tile_changed = true;
+                hashes[tx] = 0;
+            }
+
+            if(tile_changed) {
+                changed.x1 = LV_MIN(changed.x1, tile.x1);
+                changed.y1 = LV_MIN(changed.y1, tile.y1);
+                changed.x2 = LV_MAX(changed.x2, tile.x2);
+                changed.y2 = LV_MAX(changed.y2, tile.y2);
+            }
+        }
+    }
+
+    if(!lv_area_intersect(&changed, &changed, area)) return false;
+    if(lv_area_is_equal(&changed, area)) return true;
+
+    /*Flush only the changed area*/
+    move_to_buf_start(draw_buf, area, &changed);
+    *area = changed;
+    return true;
+}
+
+/**
+ * Move the rows of a part of a rendered area to the beginning of the buffer and reshape the buffer to it
+ * @param draw_buf  the buffer `area` was rendered into
+ * @param area      the rendered area
+ * @param part      the part of `area` to keep
+ */
+static void move_to_buf_start(lv_draw_buf_t * draw_buf, const lv_area_t * area, const lv_area_t * part)
+{
+    lv_color_format_t cf = draw_buf->header.cf;
+    uint32_t px_size = lv_color_format_get_size(cf);
+    uint32_t stride = draw_buf->header.stride;
+    int32_t w = lv_area_get_width(part);
+    int32_t h = lv_area_get_height(part);
+    uint32_t stride_new = lv_draw_buf_width_to_stride(w, cf);
+    const uint8_t * src = draw_buf->data + (part->y1 - area->y1) * stride + (part->x1 - area->x1) * px_size;
+    uint8_t * dest = draw_buf->data;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        lv_memmove(dest, src, w * px_size);
+        dest += stride_new;
+        src += stride;
+    }
+
+    lv_draw_buf_t * ret = lv_draw_buf_reshape(draw_buf, cf, w, h, stride_new);
+    LV_UNUSED(ret);
+    LV_ASSERT_NULL(ret);
+}
+
+/**
+ * Hash the pixels of a tile. 4 words are hashed in independent lanes to allow vectorization.
+ * @param px        pointer to the first pixel of the tile
+ * @param row_bytes number of bytes in a row of the tile
+ * @param h         number of rows
+ * @param stride    distance between the rows in bytes
+ * @return          the hash of the tile. Never 0 as it means unknown content.
+ */
+static uint32_t tile_hash(const uint8_t * px, uint32_t row_bytes, int32_t h, uint32_t stride)
+{
+    uint32_t lanes[4] = {0x9E3779B9, 0x85EBCA6B, 0xC2B2AE35, 0x27D4EB2F};
+    uint32_t hash = 0x165667B1;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint32_t i = 0;
+        if(((lv_uintptr_t)px & 0x3) == 0) {
+            const uint32_t * px32 = (const uint32_t *)px;
+            for(; i + 16 <= row_bytes; i += 16) {
+                uint32_t k;
+                for(k = 0; k < 4; k++) {
+                    lanes[k] = (lanes[k] ^ px32[k]) * 0x9E3779B1;
+                    lanes[k] ^= lanes[k] >> 15;
+                }
+                px32 += 4;
+            }
+        }
+
+        for(; i < row_bytes; i++) {
+            hash = (hash ^ px[i]) * 0x01000193;
+        }
+
+        px += stride;
+    }
+
+    uint32_t k;
+    for(k = 0; k < 4; k++) {
+        hash = (hash ^ lanes[k]) * 0x85EBCA6B;
+        hash ^= hash >> 13;
+    }
+
+    return hash == 0 ? 1 : hash;
+}
+
+static lv_display_ring_buf_t * get_ring_buf(lv_display_t * disp, const lv_draw_buf_t * buf)
+{
+    uint32_t i;
+    for(i = 0; i < disp->buf_ring_cnt; i++) {
+        if(disp->buf_ring[i].draw_buf == buf) return &disp->buf_ring[i];
+    }
+
+    return NULL;
+}
+
+static void wait_for_ring_buf(lv_display_t * disp, const lv_draw_buf_t * buf)
+{
+    lv_display_ring_buf_t * ring_buf = get_ring_buf(disp, buf);
+    if(ring_buf == NULL || ring_buf->flush_id == 0) return;
+
+    LV_PROFILER_REFR_BEGIN;
+    LV_LOG_TRACE("begin");
+
+    lv_display_send_event(disp, LV_EVENT_FLUSH_WAIT_START, NULL);
+
+    /*The buffer is released only by `lv_display_flush_ready/_buf()`*/
+    while(ring_buf->flush_id) {
+        if(disp->flush_wait_cb) disp->flush_wait_cb(disp);
+    }
+
+    lv_display_send_event(disp, LV_EVENT_FLUSH_WAIT_FINISH, NULL);
+
+    LV_LOG_TRACE("end");
+    LV_PROFILER_REFR_END;
+}
@@ -46,6 +46,9 @@ static void set_y_anim(void * obj, int32_t v);
 static void scr_anim_completed(lv_anim_t * a);
 static bool is_out_anim(lv_screen_load_anim_t a);
 static void disp_event_cb(lv_event_t * e);
+static void reset_buf_age(lv_display_t * disp);
+static void buf_ring_clear(lv_display_t * disp);
+static void reset_tile_hashes(lv_display_t * disp);
 
 /**********************
  *  STATIC VARIABLES
@@ -102,7 +105,11 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
     disp->inv_en_cnt = 1;
     disp->last_activity_time = lv_tick_get();
 
-    lv_ll_init(&disp->sync_areas, sizeof(lv_area_t));
+    uint32_t i;
+    for(i = 0; i < LV_DISPLAY_DAMAGE_HISTORY_CNT; i++) {
+        lv_array_init(&disp->damage_history[i], 0, sizeof(lv_area_t));
+    }
+    disp->buf_age = -1;
 
     lv_display_t * disp_def_tmp = disp_def;
     disp_def                 = disp; /*Temporarily change the default screen to create the default screens on the
@@ -223,7 +230,13 @@ void lv_display_delete(lv_display_t * disp)
         lv_obj_delete(disp->screens[0]);
     }
 
-    lv_ll_clear(&disp->sync_areas);
+    uint32_t i;
+    for(i = 0; i < LV_DISPLAY_DAMAGE_HISTORY_CNT; i++) {
+        lv_array_deinit(&disp->damage_history[i]);
+    }
+    lv_free(disp->inv_areas);
+    lv_free(disp->buf_ring);
+    lv_free(disp->tile_hashes);
     lv_ll_remove(disp_ll_p, disp);
     if(disp->refr_timer) lv_timer_delete(disp->refr_timer);
 
@@ -461,9 +474,11 @@ void lv_display_set_draw_buffers(lv_display_t * disp, lv_draw_buf_t * buf1, lv_d
     if(disp == NULL) disp = lv_display_get_default();
     if(disp == NULL) return;
 
+    buf_ring_clear(disp);
     disp->buf_1 = buf1;
     disp->buf_2 = buf2;
     disp->buf_act = disp->buf_1;
+    reset_buf_age(disp);
 
     disp->stride_is_auto = 0;
 }
@@ -476,7 +491,36 @@ void lv_display_set_3rd_draw_buffer(lv_display_t * disp, lv_draw_buf_t * buf3)
     LV_ASSERT_MSG(disp->buf_1 != NULL, "buf1 is null");
     LV_ASSERT_MSG(disp->buf_2 != NULL, "buf2 is null");
 
+    buf_ring_clear(disp);
     disp->buf_3 = buf3;
+    reset_buf_age(disp);
+}
+
+void lv_display_set_draw_buffer_ring(lv_display_t * disp, lv_draw_buf_t * bufs[], uint32_t cnt)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    LV_ASSERT_NULL(bufs);
+    LV_ASSERT_MSG(cnt > 0, "At least one buffer is required");
+    if(bufs == NULL || cnt == 0) return;
+
+    lv_display_ring_buf_t * ring = lv_malloc(cnt * sizeof(lv_display_ring_buf_t));
+    LV_ASSERT_MALLOC(ring);
+    if(ring == NULL) return;
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        LV_ASSERT_NULL(bufs[i]);
+        ring[i].draw_buf = bufs[i];
+        ring[i].flush_id = 0;
+    }
+
+    lv_display_set_draw_buffers(disp, bufs[0], cnt > 1 ? bufs[1] : NULL);
+    disp->buf_3 = cnt > 2 ? bufs[2] : NULL;
+    disp->buf_ring = ring;
+    disp->buf_ring_cnt = cnt;
+    disp->buf_ring_flush_cnt = 0;
 }
 
 void lv_display_set_buffers(lv_display_t * disp, void * buf1, void * buf2, uint32_t buf_size,
@@ -550,6 +594,8 @@ void lv_display_set_render_mode(lv_display_t * disp, lv_display_render_mode_t re
     if(disp == NULL) disp = lv_display_get_default();
     if(disp == NULL) return;
     disp->render_mode = render_mode;
+    reset_buf_age(disp);
+    reset_tile_hashes(disp);
 }
 
 void lv_display_set_flush_cb(lv_display_t * disp, lv_display_flush_cb_t flush_cb)
@@ -568,6 +614,23 @@ void lv_display_set_flush_wait_cb(lv_display_t * disp, lv_display_flush_wait_cb_
     disp->flush_wait_cb = wait_cb;
 }
 
+void lv_display_set_flush_skip_unchanged(lv_display_t * disp, bool en)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->flush_skip_unchanged = en;
+    reset_tile_hashes(disp);
+}
+
+bool lv_display_get_flush_skip_unchanged(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return false;
+
+    return disp->flush_skip_unchanged;
+}
+
 void lv_display_set_color_format(lv_display_t * disp, lv_color_format_t color_format)
 {
     if(disp == NULL) disp = lv_display_get_default();
@@ -578,6 +641,10 @@ void lv_display_set_color_format(lv_display_t * disp, lv_color_format_t color_fo
     if(disp->buf_1) disp->buf_1->header.cf = color_format;
     if(disp->buf_2) disp->buf_2->header.cf = color_format;
     if(disp->buf_3) disp->buf_3->header.cf = color_format;
+    uint32_t i;
+    for(i = 0; i < disp->buf_ring_cnt; i++) {
+        disp->buf_ring[i].draw_buf->header.cf = color_format;
+    }
 
     if(lv_color_format_has_alpha(disp->color_format)) {
         lv_obj_remove_local_style_prop(disp->bottom_layer, LV_STYLE_BG_OPA, 0);
@@ -643,6 +710,34 @@ lv_display_render_mode_t lv_display_get_render_mode(lv_display_t * disp)
 
 LV_ATTRIBUTE_FLUSH_READY void lv_display_flush_ready(lv_display_t * disp)
 {
+    /*With a buffer ring release the buffer of the oldest flush.
+     *Compare the differences of the IDs to handle overflow.*/
+    lv_display_ring_buf_t * oldest = NULL;
+    uint32_t oldest_id = 0;
+    uint32_t i;
+    for(i = 0; i < disp->buf_ring_cnt; i++) {
+        uint32_t id = disp->buf_ring[i].flush_id;
+        if(id == 0) continue;
+        if(oldest == NULL || (int32_t)(id - oldest_id) < 0) {
+            oldest = &disp->buf_ring[i];
+            oldest_id = id;
+        }
+    }
+    if(oldest) oldest->flush_id = 0;
+
+    disp->flushing = 0;
+}
+
+LV_ATTRIBUTE_FLUSH_READY void lv_display_flush_ready_buf(lv_display_t * disp, const uint8_t * px_map)
+{
+    uint32_t i;
+    for(i = 0; i < disp->buf_ring_cnt; i++) {
+        if(disp->buf_ring[i].draw_buf->data == px_map) {
+            disp->buf_ring[i].flush_id = 0;
+            break;
+        }
+    }
+
     disp->flushing = 0;
 }
 
@@ -656,6 +751,31 @@ bool lv_display_is_double_buffered(lv_display_t * disp)
     return disp->buf_2 != NULL;
 }
 
+void lv_display_set_buf_age(lv_display_t * disp, uint32_t age)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->buf_age = (int32_t)LV_MIN(age, INT32_MAX);
+}
+
+uint32_t lv_display_get_buf_age(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return 0;
+
+    if(disp->buf_age >= 0) return disp->buf_age;
+
+    uint32_t frame;
+    if(disp->buf_act == disp->buf_1) frame = disp->buf_frame[0];
+    else if(disp->buf_act == disp->buf_2) frame = disp->buf_frame[1];
+    else if(disp->buf_act == disp->buf_3) frame = disp->buf_frame[2];
+    else frame = 0;
+
+    if(frame == 0) return 0;
+    return disp->frame_cnt + 1 - frame;
+}
+
 /*---------------------
   * SCREENS
   *--------------------*/
@@ -1276,6 +1396,10 @@ uint32_t lv_display_get_invalidated_draw_buf_size(lv_display_t * disp, uint32_t
     LV_ASSERT(disp->buf_1 && disp->buf_1->data_size >= buf_size);
     if(disp->buf_2) LV_ASSERT(disp->buf_2->data_size >= buf_size);
     if(disp->buf_3) LV_ASSERT(disp->buf_3->data_size >= buf_size);
+    uint32_t i;
+    for(i = 0; i < disp->buf_ring_cnt; i++) {
+        LV_ASSERT(disp->buf_ring[i].draw_buf->data_size >= buf_size);
+    }
 
     return buf_size;
 }
@@ -1353,9 +1477,9 @@ static void update_resolution(lv_display_t * disp)
     lv_area_set_height(&disp->bottom_layer->coords, ver_res);
     lv_obj_send_event(disp->bottom_layer, LV_EVENT_SIZE_CHANGED, &prev_coords);
 
-    lv_memzero(disp->inv_areas, sizeof(disp->inv_areas));
-    lv_memzero(disp->inv_area_joined, sizeof(disp->inv_area_joined));
     disp->inv_p = 0;
+    reset_buf_age(disp);
+    reset_tile_hashes(disp);
     lv_obj_invalidate(disp->sys_layer);
 
     lv_obj_tree_walk(NULL, invalidate_layout_cb, NULL);
@@ -1473,3 +1597,33 @@ static void disp_event_cb(lv_event_t * e)
             break;
     }
 }
+
+/**
+ * Forget the content of the buffers and the damage of the previous frames,
+ * so that the next frames redraw all the invalidated areas in each buffer
+ * @param disp      pointer to a display
+ */
+static void reset_buf_age(lv_display_t * disp)
+{
+    lv_memzero(disp->buf_frame, sizeof(disp->buf_frame));
+    disp->damage_history_cnt = 0;
+}
+
+/**
+ * Forget the hashes of the flushed tiles, so that the next frames flush all the rendered pixels
+ * @param disp      pointer to a display
+ */
+static void reset_tile_hashes(lv_display_t * disp)
+{
+    lv_free(disp->tile_hashes);
+    disp->tile_hashes = NULL;
+    disp->tile_hash_col_cnt = 0;
+    disp->tile_hash_row_cnt = 0;
+}
+
+static void buf_ring_clear(lv_display_t * disp)
+{
+    lv_free(disp->buf_ring);
+    disp->buf_ring = NULL;
+    disp->buf_ring_cnt = 0;
+}
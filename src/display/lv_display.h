@@ -299,6 +299,20 @@ void lv_display_set_draw_buffers(lv_display_t * disp, lv_draw_buf_t * buf1, lv_d
  */
 void lv_display_set_3rd_draw_buffer(lv_display_t * disp, lv_draw_buf_t * buf3);
 
+/**
+ * Set any number of draw buffers used in a ring, mainly for LV_DISPLAY_RENDER_MODE_PARTIAL.
+ * The next bands are rendered while the previous ones are still being flushed, so `flush_cb`
+ * is called again before the earlier flushes are ready. LVGL waits only if the next buffer
+ * in the ring is still being flushed.
+ * The flushes can be finished in any order by `lv_display_flush_ready_buf()`, or in the
+ * order of starting them by `lv_display_flush_ready()`.
+ * @param disp              pointer to a display
+ * @param bufs              array of draw buffers. The array is copied.
+ * @param cnt               number of buffers in `bufs` (at least 1)
+ * @note  `flush_wait_cb` is called until the buffer is released, so it doesn't finish a flush by itself.
+ */
+void lv_display_set_draw_buffer_ring(lv_display_t * disp, lv_draw_buf_t * bufs[], uint32_t cnt);
+
 /**
  * Set display render mode
  * @param disp              pointer to a display
@@ -323,6 +337,27 @@ void lv_display_set_flush_cb(lv_display_t * disp, lv_display_flush_cb_t flush_cb
  */
 void lv_display_set_flush_wait_cb(lv_display_t * disp, lv_display_flush_wait_cb_t wait_cb);
 
+/**
+ * Don't flush the pixels which are the same as the ones flushed earlier.
+ * The rendered pixels are hashed in LV_DISPLAY_FLUSH_TILE_SIZE sized tiles and the flushed
+ * areas are shrunk to the changed tiles. If no tiles changed, `flush_cb` is not called at all.
+ * It's useful if flushing is slow (e.g. SPI displays) and works only in LV_DISPLAY_RENDER_MODE_PARTIAL.
+ * The invalidated areas are rounded to the tiles and the rendered bands' height to a multiple of
+ * the tile size, so that they are aligned to the tiles.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param en        true: skip the unchanged tiles; false: flush all rendered pixels
+ * @note            If the content of the display was changed by something else, call this function
+ *                  again to forget the earlier flushed tiles.
+ */
+void lv_display_set_flush_skip_unchanged(lv_display_t * disp, bool en);
+
+/**
+ * Get whether flushing the unchanged tiles is skipped.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          true: the unchanged tiles are not flushed
+ */
+bool lv_display_get_flush_skip_unchanged(lv_display_t * disp);
+
 /**
  * Set the color format of the display.
  * @param disp              pointer to a display
@@ -373,11 +408,21 @@ void lv_display_set_antialiasing(lv_display_t * disp, bool en);
 bool lv_display_get_antialiasing(lv_display_t * disp);
 
 /**
- * Call from the display driver when the flushing is finished
+ * Call from the display driver when the flushing is finished.
+ * With a buffer ring it finishes the oldest flush in progress.
  * @param disp      pointer to display whose `flush_cb` was called
  */
 LV_ATTRIBUTE_FLUSH_READY void lv_display_flush_ready(lv_display_t * disp);
 
+/**
+ * Call from the display driver when flushing a given buffer is finished.
+ * With a buffer ring (see `lv_display_set_draw_buffer_ring()`) the flushes can be
+ * finished in any order.
+ * @param disp      pointer to display whose `flush_cb` was called
+ * @param px_map    the `px_map` passed to `flush_cb`
+ */
+LV_ATTRIBUTE_FLUSH_READY void lv_display_flush_ready_buf(lv_display_t * disp, const uint8_t * px_map);
+
 /**
  * Tell if it's the last area of the refreshing process.
  * Can be called from `flush_cb` to execute some special display refreshing if needed when all areas area flushed.
@@ -389,6 +434,27 @@ LV_ATTRIBUTE_FLUSH_READY bool lv_display_flush_is_last(lv_display_t * disp);
 
 bool lv_display_is_double_buffered(lv_display_t * disp);
 
+/**
+ * Report the age of the active buffer, i.e. the buffer which will be rendered next in
+ * LV_DISPLAY_RENDER_MODE_DIRECT. Useful if the driver swaps the buffers on its own
+ * (e.g. EGL with `EGL_EXT_buffer_age`). The reported age is used only for the next frame,
+ * so it should be reported before every refresh.
+ * If it's not reported, LVGL tracks the age of `buf1`, `buf2` and `buf3` itself.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param age       0: unknown content, redraw everything;
+ *                  1: the buffer contains the last frame;
+ *                  N: the buffer contains the frame before the last N-1 frames
+ */
+void lv_display_set_buf_age(lv_display_t * disp, uint32_t age);
+
+/**
+ * Get the age of the active buffer in LV_DISPLAY_RENDER_MODE_DIRECT. The areas redrawn
+ * in the last age - 1 frames are redrawn in this buffer too to bring it up to date.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          the reported or tracked age of the buffer. 0: unknown content.
+ */
+uint32_t lv_display_get_buf_age(lv_display_t * disp);
+
 /**
  * Get display render mode
  * @param disp      pointer to a display
@@ -16,6 +16,7 @@ extern "C" {
 #include "../misc/lv_types.h"
 #include "../core/lv_obj.h"
 #include "../draw/lv_draw.h"
+#include "../misc/lv_array.h"
 #include "lv_display.h"
 
 #if LV_USE_SYSMON
@@ -30,13 +31,30 @@ extern "C" {
  *      DEFINES
  *********************/
 #ifndef LV_INV_BUF_SIZE
-#define LV_INV_BUF_SIZE 32 /**< Buffer size for invalid areas */
+#define LV_INV_BUF_SIZE 32 /**< Initial number of invalid areas. The buffer grows as needed. */
+#endif
+
+#ifndef LV_DISPLAY_FLUSH_TILE_SIZE
+#define LV_DISPLAY_FLUSH_TILE_SIZE 32 /**< Width and height of the tiles hashed to skip flushing unchanged pixels*/
+#endif
+
+#ifndef LV_DISPLAY_DAMAGE_HISTORY_CNT
+#define LV_DISPLAY_DAMAGE_HISTORY_CNT 4 /**< Number of frames whose damage is kept in DIRECT mode. The maximum usable buffer age.*/
 #endif
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/** A draw buffer of the ring set by `lv_display_set_draw_buffer_ring()`*/
+typedef struct {
+    lv_draw_buf_t * draw_buf;
+
+    /** Order of the flush in progress from this buffer. 0: not being flushed.
+     * (It's written from IRQ when the flushing is ready, so it shouldn't share a word with other fields) */
+    volatile uint32_t flush_id;
+} lv_display_ring_buf_t;
+
 struct _lv_display_t {
 #if LV_USE_EXT_DATA
     lv_ext_data_t ext_data;
@@ -76,6 +94,12 @@ struct _lv_display_t {
     /** Internal, used by the library*/
     lv_draw_buf_t * buf_act;
 
+    /** Draw buffers used in a ring. `buf_1`, `buf_2` and `buf_3` are its first 3 buffers.
+     *  The next band is rendered while the previous ones are still being flushed.*/
+    lv_display_ring_buf_t * buf_ring;
+    uint32_t buf_ring_cnt;          /**< Number of buffers in `buf_ring`*/
+    uint32_t buf_ring_flush_cnt;    /**< Number of flushes started from `buf_ring`, used to order them*/
+
     /** MANDATORY: Write the internal buffer (draw_buf) to the display. 'lv_display_flush_ready()' has to be
      * called when finished*/
     lv_display_flush_cb_t flush_cb;
@@ -100,6 +124,8 @@ struct _lv_display_t {
     uint32_t antialiasing : 1;       /**< 1: anti-aliasing is enabled on this display.*/
     uint32_t tile_cnt     : 8;       /**< Divide the display buffer into these number of tiles */
     uint32_t stride_is_auto : 1;     /**< 1: The stride of the buffers was not set explicitly. */
+    uint32_t flush_skip_unchanged : 1; /**< 1: Don't flush the tiles which didn't change since the last flush*/
+    uint32_t flushed_in_refr : 1;    /**< 1: An area of the current refresh was flushed already*/
 
 
     /** 1: The current screen rendering is in progress*/
@@ -107,14 +133,26 @@ struct _lv_display_t {
 
     lv_color_format_t   color_format;
 
-    /** Invalidated (marked to redraw) areas*/
-    lv_area_t inv_areas[LV_INV_BUF_SIZE];
-    uint8_t inv_area_joined[LV_INV_BUF_SIZE];
-    uint32_t inv_p;
+    /** Invalidated (marked to redraw) areas. Overlapping areas are joined before refreshing.*/
+    lv_area_t * inv_areas;
+    uint32_t inv_p;         /**< Number of invalidated areas*/
+    uint32_t inv_area_cap;  /**< Number of areas `inv_areas` can store before growing*/
     int32_t inv_en_cnt;
 
-    /** Double buffer sync areas (redrawn during last refresh) */
-    lv_ll_t sync_areas;
+    /** The areas redrawn in the last frames in DIRECT mode. They are redrawn again in the buffers
+     *  which don't contain those frames yet, according to the buffer's age.*/
+    lv_array_t damage_history[LV_DISPLAY_DAMAGE_HISTORY_CNT];
+    uint32_t damage_history_last;   /**< Index of the last frame in `damage_history`*/
+    uint32_t damage_history_cnt;    /**< Number of previous frames in `damage_history` which can be used*/
+    uint32_t frame_cnt;             /**< Number of frames rendered in DIRECT mode*/
+    uint32_t buf_frame[3];          /**< The last frame rendered into `buf_1/2/3`. 0: unknown content*/
+    int32_t buf_age;                /**< Age of `buf_act` reported by the driver, or -1 to track it internally*/
+
+    /** Hashes of the last flushed LV_DISPLAY_FLUSH_TILE_SIZE sized tiles in LV_DISPLAY_RENDER_MODE_PARTIAL.
+     *  The unchanged tiles are not flushed again. Allocated on the first flush, 0: unknown tile*/
+    uint32_t * tile_hashes;
+    uint32_t tile_hash_col_cnt;     /**< Number of tile columns in `tile_hashes`*/
+    uint32_t tile_hash_row_cnt;     /**< Number of tile rows in `tile_hashes`*/
 
     lv_draw_buf_t _static_buf1; /**< Used when user pass in a raw buffer as display draw buffer */
     lv_draw_buf_t _static_buf2;
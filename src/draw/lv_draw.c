@@ -14,6 +14,7 @@
 #include "../misc/lv_assert.h"
 #include "../misc/lv_event_private.h"
 #include "lv_draw_private.h"
+#include "lv_draw_display_list_private.h"
 #include "lv_draw_mask_private.h"
 #include "lv_draw_vector_private.h"
 #include "lv_draw_3d.h"
@@ -38,7 +39,23 @@
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check, uint8_t draw_unit_id);
 static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp);
 static inline size_t get_draw_dsc_size(lv_draw_task_type_t type);
+static inline size_t get_task_size(lv_draw_task_type_t type);
+static lv_draw_task_t * task_alloc(size_t size);
+static void task_free(lv_draw_task_t * t);
 static lv_draw_task_t * get_first_available_task(lv_layer_t * layer);
+#if LV_DRAW_TASK_GRID_THRESHOLD
+    static void grid_create(lv_layer_t * layer);
+    static void grid_delete(lv_layer_t * layer);
+    static bool grid_add_task(lv_draw_task_grid_t * grid, lv_draw_task_t * t);
+    static void grid_remove_task(lv_draw_task_grid_t * grid, lv_draw_task_t * t);
+    static void grid_get_bin_range(const lv_draw_task_grid_t * grid, const lv_area_t * area, lv_area_t * range);
+    static void grid_get_task_bin_range(const lv_draw_task_grid_t * grid, const lv_draw_task_t * t, lv_area_t * range);
+#endif
+#if LV_DRAW_OCCLUSION_CULLING
+    static bool get_opaque_area(const lv_draw_task_t * t, lv_area_t * cover_area);
+    static void cull_covered_tasks(lv_layer_t * layer, lv_draw_task_t * t_cover);
+    static void cull_task(lv_draw_task_t * t, const lv_area_t * cover_area);
+#endif
 
 #if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
@@ -81,6 +98,8 @@ void lv_draw_deinit(void)
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
+
+    lv_draw_task_pool_release();
 }
 
 void * lv_draw_create_unit(size_t size)
@@ -102,7 +121,7 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     LV_PROFILER_DRAW_BEGIN;
     size_t dsc_size = get_draw_dsc_size(type);
     LV_ASSERT_FORMAT_MSG(dsc_size > 0, "Draw task size is 0 for type %d", type);
-    lv_draw_task_t * new_task = lv_malloc_zeroed(LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + dsc_size);
+    lv_draw_task_t * new_task = task_alloc(get_task_size(type));
     LV_ASSERT_MALLOC(new_task);
     new_task->area = *coords;
     new_task->_real_area = *coords;
@@ -116,16 +135,15 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     new_task->draw_dsc = (uint8_t *)new_task + LV_ALIGN_UP(sizeof(lv_draw_task_t), 8);
     new_task->state = LV_DRAW_TASK_STATE_WAITING;
 
-    /*Find the tail*/
+    /*Append to the tail*/
     if(layer->draw_task_head == NULL) {
         layer->draw_task_head = new_task;
     }
     else {
-        lv_draw_task_t * tail = layer->draw_task_head;
-        while(tail->next) tail = tail->next;
-
-        tail->next = new_task;
+        layer->draw_task_tail->next = new_task;
     }
+    layer->draw_task_tail = new_task;
+    layer->draw_task_cnt++;
 
     LV_PROFILER_DRAW_END;
     return new_task;
@@ -137,8 +155,20 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
     lv_draw_dsc_base_t * base_dsc = t->draw_dsc;
     base_dsc->layer = layer;
 
+#if LV_DRAW_TASK_GRID_THRESHOLD
+    /*The areas are set at this point so the draw task can be sorted into the grid*/
+    if(layer->draw_task_grid) {
+        if(!grid_add_task(layer->draw_task_grid, t)) grid_delete(layer);
+    }
+    else if(layer->draw_task_cnt > LV_DRAW_TASK_GRID_THRESHOLD) grid_create(layer);
+#endif
+
     lv_draw_global_info_t * info = &_draw_info;
 
+    /*Record the draw task before the event as the event will be sent again on replay.
+     *The draw tasks added in the event are not recorded for the same reason.*/
+    if(layer->display_list && info->task_running == false) lv_draw_display_list_add_task(layer->display_list, t);
+
     /*Send LV_EVENT_DRAW_TASK_ADDED and dispatch only on the "main" draw_task
      *and not on the draw tasks added in the event.
      *Sending LV_EVENT_DRAW_TASK_ADDED events might cause recursive event sends and besides
@@ -170,6 +200,9 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
             t->state = LV_DRAW_TASK_STATE_FINISHED;
         }
         else {
+#if LV_DRAW_OCCLUSION_CULLING
+            cull_covered_tasks(layer, t);
+#endif
             lv_draw_dispatch();
         }
     }
@@ -242,12 +275,18 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
     while(t) {
         t_next = t->next;
         if(t->state == LV_DRAW_TASK_STATE_FINISHED) {
+#if LV_DRAW_TASK_GRID_THRESHOLD
+            if(layer->draw_task_grid) grid_remove_task(layer->draw_task_grid, t);
+#endif
             cleanup_task(t, disp);
             remove_task = true;
             if(t_prev != NULL)
                 t_prev->next = t_next;
             else
                 layer->draw_task_head = t_next;
+
+            if(layer->draw_task_tail == t) layer->draw_task_tail = t_prev;
+            layer->draw_task_cnt--;
         }
         else {
             t_prev = t;
@@ -255,6 +294,10 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
         t = t_next;
     }
 
+#if LV_DRAW_TASK_GRID_THRESHOLD
+    if(layer->draw_task_grid && layer->draw_task_head == NULL) grid_delete(layer);
+#endif
+
     bool task_dispatched = false;
 
     /*This layer is ready, enable blending its buffer*/
@@ -316,11 +359,39 @@ void lv_draw_dispatch_request(void)
     LV_PROFILER_DRAW_END;
 }
 
+void lv_draw_task_pool_release(void)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_TASK_POOL_CLASS_CNT; i++) {
+        lv_draw_task_t * t = _draw_info.task_pool[i];
+        while(t) {
+            lv_draw_task_t * t_next = t->next;
+            lv_free(t);
+            t = t_next;
+        }
+        _draw_info.task_pool[i] = NULL;
+    }
+    LV_PROFILER_DRAW_END;
+}
+
 uint32_t lv_draw_get_unit_count(void)
 {
     return _draw_info.unit_cnt;
 }
 
+#if LV_DRAW_OCCLUSION_CULLING
+uint32_t lv_draw_get_culled_task_count(void)
+{
+    return _draw_info.culled_task_cnt;
+}
+
+uint32_t lv_draw_get_culled_pixel_count(void)
+{
+    return _draw_info.culled_px_cnt;
+}
+#endif
+
 lv_draw_task_t * lv_draw_get_available_task(lv_layer_t * layer, lv_draw_task_t * t_prev, uint8_t draw_unit_id)
 {
     if(_draw_info.unit_cnt == 1) {
@@ -373,6 +444,37 @@ uint32_t lv_draw_get_dependent_count(lv_draw_task_t * t_check)
     LV_PROFILER_DRAW_BEGIN;
     uint32_t cnt = 0;
 
+#if LV_DRAW_TASK_GRID_THRESHOLD
+    lv_draw_task_grid_t * grid = t_check->target_layer->draw_task_grid;
+    if(grid && t_check->grid_seq) {
+        lv_area_t range;
+        grid_get_bin_range(grid, &t_check->area, &range);
+        int32_t bx, by;
+        for(by = range.y1; by <= range.y2; by++) {
+            for(bx = range.x1; bx <= range.x2; bx++) {
+                lv_draw_task_bin_t * bin = &grid->bins[by * LV_DRAW_TASK_GRID_SIZE + bx];
+                /*The newer draw tasks are at the end of the bin*/
+                int32_t i;
+                for(i = (int32_t)bin->cnt - 1; i >= 0; i--) {
+                    lv_draw_task_t * t = bin->tasks[i];
+                    if(t->grid_seq <= t_check->grid_seq) break;
+
+                    if((t->state == LV_DRAW_TASK_STATE_WAITING || t->state == LV_DRAW_TASK_STATE_BLOCKED) &&
+                       lv_area_is_on(&t_check->area, &t->area)) {
+                        /*A draw task can be in multiple bins. Count it only in the first common bin.*/
+                        lv_area_t t_range;
+                        grid_get_task_bin_range(grid, t, &t_range);
+                        if(bx == LV_MAX(range.x1, t_range.x1) && by == LV_MAX(range.y1, t_range.y1)) cnt++;
+                    }
+                }
+            }
+        }
+
+        LV_PROFILER_DRAW_END;
+        return cnt;
+    }
+#endif
+
     lv_draw_task_t * t = t_check->next;
     while(t) {
         if((t->state == LV_DRAW_TASK_STATE_WAITING || t->state == LV_DRAW_TASK_STATE_BLOCKED) &&
@@ -587,6 +689,41 @@ void lv_draw_layer_finish_drop_shadow(lv_layer_t * drop_shadow_layer, const lv_d
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check, uint8_t draw_unit_id)
 {
     LV_PROFILER_DRAW_BEGIN;
+
+#if LV_DRAW_TASK_GRID_THRESHOLD
+    /*Check only the older draw tasks in the bins of `t_check`*/
+    lv_draw_task_grid_t * grid = layer->draw_task_grid;
+    if(grid && t_check->grid_seq) {
+        lv_area_t range;
+        grid_get_bin_range(grid, &t_check->_real_area, &range);
+        int32_t bx, by;
+        for(by = range.y1; by <= range.y2; by++) {
+            for(bx = range.x1; bx <= range.x2; bx++) {
+                lv_draw_task_bin_t * bin = &grid->bins[by * LV_DRAW_TASK_GRID_SIZE + bx];
+                uint32_t i;
+                for(i = 0; i < bin->cnt; i++) {
+                    lv_draw_task_t * t = bin->tasks[i];
+                    if(t->grid_seq >= t_check->grid_seq) break;
+
+                    if(t->state == LV_DRAW_TASK_STATE_FINISHED ||
+                       (t->state == LV_DRAW_TASK_STATE_QUEUED && t->preferred_draw_unit_id == draw_unit_id)) {
+                        continue;
+                    }
+
+                    lv_area_t a;
+                    if(lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) {
+                        LV_PROFILER_DRAW_END;
+                        return false;
+                    }
+                }
+            }
+        }
+
+        LV_PROFILER_DRAW_END;
+        return true;
+    }
+#endif
+
     lv_draw_task_t * t = layer->draw_task_head;
 
     /*If t_check is outside of the older tasks then it's independent*/
@@ -665,6 +802,55 @@ static inline size_t get_draw_dsc_size(lv_draw_task_type_t type)
     return 0;
 }
 
+/**
+ * Get the size of the memory required for a draw task with its draw descriptor
+ * @param type      type of the draw task
+ * @return          size of the draw task in bytes
+ */
+static inline size_t get_task_size(lv_draw_task_type_t type)
+{
+    return LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + get_draw_dsc_size(type);
+}
+
+/**
+ * Allocate a zeroed draw task. Reuse a previously finished draw task
+ * from the pool if there is one in the matching size class.
+ * @param size      size of the draw task with its draw descriptor
+ * @return          the allocated draw task or NULL on error
+ */
+static lv_draw_task_t * task_alloc(size_t size)
+{
+    uint32_t class_idx = (uint32_t)((size - 1) / LV_DRAW_TASK_POOL_CLASS_SIZE);
+    if(class_idx >= LV_DRAW_TASK_POOL_CLASS_CNT) return lv_malloc_zeroed(size);
+
+    /*Allocate the whole size class so that the task can be reused by any type of this class*/
+    size = (class_idx + 1) * LV_DRAW_TASK_POOL_CLASS_SIZE;
+
+    lv_draw_task_t * t = _draw_info.task_pool[class_idx];
+    if(t == NULL) return lv_malloc_zeroed(size);
+
+    _draw_info.task_pool[class_idx] = t->next;
+    lv_memzero(t, size);
+    return t;
+}
+
+/**
+ * Put a draw task back to the pool to be reused by `task_alloc`.
+ * Draw tasks larger than the largest size class are freed.
+ * @param t         pointer to a draw task
+ */
+static void task_free(lv_draw_task_t * t)
+{
+    uint32_t class_idx = (uint32_t)((get_task_size(t->type) - 1) / LV_DRAW_TASK_POOL_CLASS_SIZE);
+    if(class_idx >= LV_DRAW_TASK_POOL_CLASS_CNT) {
+        lv_free(t);
+        return;
+    }
+
+    t->next = _draw_info.task_pool[class_idx];
+    _draw_info.task_pool[class_idx] = t;
+}
+
 /**
  * Clean-up resources allocated by a finished task
  * @param t         pointer to a draw task
@@ -678,7 +864,11 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
         lv_draw_image_dsc_t * draw_image_dsc = t->draw_dsc;
         lv_layer_t * layer_drawn = (lv_layer_t *)draw_image_dsc->src;
 
-        if(layer_drawn->draw_buf) {
+#if LV_DRAW_TASK_GRID_THRESHOLD
+        if(layer_drawn->draw_task_grid) grid_delete(layer_drawn);
+#endif
+
+        if(layer_drawn->draw_buf && !layer_drawn->keep_draw_buf) {
             int32_t h = lv_area_get_height(&layer_drawn->buf_area);
             uint32_t layer_size_byte = h * layer_drawn->draw_buf->header.stride;
 
@@ -720,7 +910,7 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
         draw_label_dsc->text = NULL;
     }
 
-    lv_free(t);
+    task_free(t);
     LV_PROFILER_DRAW_END;
 }
 
@@ -752,3 +942,325 @@ static lv_draw_task_t * get_first_available_task(lv_layer_t * layer)
     LV_PROFILER_DRAW_END;
     return t;
 }
+
+#if LV_DRAW_TASK_GRID_THRESHOLD
+
+/**
+ * Create a grid for a layer and add all of its draw tasks
+ * @param layer     pointer to a layer
+ */
+static void grid_create(lv_layer_t * layer)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    lv_draw_task_grid_t * grid = lv_malloc_zeroed(sizeof(lv_draw_task_grid_t));
+    if(grid == NULL) {
+        LV_LOG_WARN("Couldn't allocate the draw task grid. Checking all the draw tasks instead.");
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+
+    grid->area = layer->buf_area;
+    grid->bin_w = LV_MAX(1, (lv_area_get_width(&grid->area) + LV_DRAW_TASK_GRID_SIZE - 1) / LV_DRAW_TASK_GRID_SIZE);
+    grid->bin_h = LV_MAX(1, (lv_area_get_height(&grid->area) + LV_DRAW_TASK_GRID_SIZE - 1) / LV_DRAW_TASK_GRID_SIZE);
+    grid->seq_next = 1;
+    layer->draw_task_grid = grid;
+
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t) {
+        if(!grid_add_task(grid, t)) {
+            grid_delete(layer);
+            break;
+        }
+        t = t->next;
+    }
+    LV_PROFILER_DRAW_END;
+}
+
+/**
+ * Delete the grid of a layer
+ * @param layer     pointer to a layer
+ */
+static void grid_delete(lv_layer_t * layer)
+{
+    lv_draw_task_grid_t * grid = layer->draw_task_grid;
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_TASK_GRID_SIZE * LV_DRAW_TASK_GRID_SIZE; i++) {
+        lv_free(grid->bins[i].tasks);
+    }
+
+    /*The remaining draw tasks will be checked linearly*/
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t) {
+        t->grid_seq = 0;
+        t = t->next;
+    }
+
+    lv_free(grid);
+    layer->draw_task_grid = NULL;
+}
+
+/**
+ * Add a draw task to the end of all the bins it overlaps
+ * @param grid      pointer to a grid
+ * @param t         pointer to a draw task
+ * @return          false if the bins couldn't be grown. The draw task is not added to any bins in this case
+ *                  and the grid can't be used anymore as it doesn't contain all the draw tasks.
+ */
+static bool grid_add_task(lv_draw_task_grid_t * grid, lv_draw_task_t * t)
+{
+    if(t->grid_seq) return true;
+
+    lv_area_t range;
+    grid_get_task_bin_range(grid, t, &range);
+
+    /*Grow all the bins first to not add the draw task to only some of them*/
+    int32_t bx, by;
+    for(by = range.y1; by <= range.y2; by++) {
+        for(bx = range.x1; bx <= range.x2; bx++) {
+            lv_draw_task_bin_t * bin = &grid->bins[by * LV_DRAW_TASK_GRID_SIZE + bx];
+            if(bin->cnt == bin->capacity) {
+                uint32_t new_capacity = bin->capacity ? bin->capacity * 2 : 8;
+                lv_draw_task_t ** new_tasks = lv_realloc(bin->tasks, new_capacity * sizeof(lv_draw_task_t *));
+                LV_ASSERT_MALLOC(new_tasks);
+                if(new_tasks == NULL) {
+                    LV_LOG_WARN("Couldn't grow a bin of the draw task grid. Checking all the draw tasks instead.");
+                    return false;
+                }
+                bin->tasks = new_tasks;
+                bin->capacity = new_capacity;
+            }
+        }
+    }
+
+    t->grid_seq = grid->seq_next++;
+    for(by = range.y1; by <= range.y2; by++) {
+        for(bx = range.x1; bx <= range.x2; bx++) {
+            lv_draw_task_bin_t * bin = &grid->bins[by * LV_DRAW_TASK_GRID_SIZE + bx];
+            bin->tasks[bin->cnt] = t;
+            bin->cnt++;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Remove a draw task from all the bins it overlaps
+ * @param grid      pointer to a grid
+ * @param t         pointer to a draw task
+ */
+static void grid_remove_task(lv_draw_task_grid_t * grid, lv_draw_task_t * t)
+{
+    if(t->grid_seq == 0) return;
+
+    lv_area_t range;
+    grid_get_task_bin_range(grid, t, &range);
+    int32_t bx, by;
+    for(by = range.y1; by <= range.y2; by++) {
+        for(bx = range.x1; bx <= range.x2; bx++) {
+            lv_draw_task_bin_t * bin = &grid->bins[by * LV_DRAW_TASK_GRID_SIZE + bx];
+
+            /*The bins are sorted by `grid_seq`, so use binary search*/
+            uint32_t min = 0;
+            uint32_t max = bin->cnt;
+            while(min < max) {
+                uint32_t mid = (min + max) / 2;
+                if(bin->tasks[mid]->grid_seq < t->grid_seq) min = mid + 1;
+                else max = mid;
+            }
+
+            if(min < bin->cnt && bin->tasks[min] == t) {
+                lv_memmove(&bin->tasks[min], &bin->tasks[min + 1], (bin->cnt - min - 1) * sizeof(lv_draw_task_t *));
+                bin->cnt--;
+            }
+        }
+    }
+
+    t->grid_seq = 0;
+}
+
+/**
+ * Get the range of bins overlapping with an area.
+ * Areas out of the grid are clamped to the closest bins.
+ * @param grid      pointer to a grid
+ * @param area      the area to check
+ * @param range     store the indices of the first and last bins in both directions here
+ */
+static void grid_get_bin_range(const lv_draw_task_grid_t * grid, const lv_area_t * area, lv_area_t * range)
+{
+    range->x1 = LV_CLAMP(0, (area->x1 - grid->area.x1) / grid->bin_w, LV_DRAW_TASK_GRID_SIZE - 1);
+    range->x2 = LV_CLAMP(0, (area->x2 - grid->area.x1) / grid->bin_w, LV_DRAW_TASK_GRID_SIZE - 1);
+    range->y1 = LV_CLAMP(0, (area->y1 - grid->area.y1) / grid->bin_h, LV_DRAW_TASK_GRID_SIZE - 1);
+    range->y2 = LV_CLAMP(0, (area->y2 - grid->area.y1) / grid->bin_h, LV_DRAW_TASK_GRID_SIZE - 1);
+}
+
+/**
+ * Get the range of bins where a draw task is stored.
+ * It's the union of `area` and `_real_area` as both are used to find the overlapping draw tasks.
+ * @param grid      pointer to a grid
+ * @param t         pointer to a draw task
+ * @param range     store the indices of the first and last bins in both directions here
+ */
+static void grid_get_task_bin_range(const lv_draw_task_grid_t * grid, const lv_draw_task_t * t, lv_area_t * range)
+{
+    lv_area_t a;
+    lv_area_join(&a, &t->area, &t->_real_area);
+    grid_get_bin_range(grid, &a, range);
+}
+
+#endif /*LV_DRAW_TASK_GRID_THRESHOLD*/
+
+#if LV_DRAW_OCCLUSION_CULLING
+
+/**
+ * Check if a draw task overwrites all the pixels of an area with opaque pixels
+ * @param t             pointer to a draw task
+ * @param cover_area    store the fully covered area here
+ * @return              true: the draw task is opaque and `cover_area` is set
+ */
+static bool get_opaque_area(const lv_draw_task_t * t, lv_area_t * cover_area)
+{
+    if(t->opa < LV_OPA_MAX) return false;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    if(!lv_matrix_is_identity(&t->matrix)) return false;
+#endif
+
+    if(t->type == LV_DRAW_TASK_TYPE_FILL) {
+        const lv_draw_fill_dsc_t * dsc = t->draw_dsc;
+        if(dsc->opa < LV_OPA_MAX || dsc->radius != 0) return false;
+        if(dsc->grad.dir != LV_GRAD_DIR_NONE) {
+            /*Complex gradients might not pad the whole area*/
+            if(dsc->grad.dir != LV_GRAD_DIR_VER && dsc->grad.dir != LV_GRAD_DIR_HOR) return false;
+            uint32_t i;
+            for(i = 0; i < dsc->grad.stops_count; i++) {
+                if(dsc->grad.stops[i].opa < LV_OPA_MAX) return false;
+            }
+        }
+    }
+    else if(t->type == LV_DRAW_TASK_TYPE_IMAGE) {
+        const lv_draw_image_dsc_t * dsc = t->draw_dsc;
+        if(dsc->opa < LV_OPA_MAX || dsc->blend_mode != LV_BLEND_MODE_NORMAL) return false;
+        if(dsc->rotation != 0 || dsc->scale_x != LV_SCALE_NONE || dsc->scale_y != LV_SCALE_NONE ||
+           dsc->skew_x != 0 || dsc->skew_y != 0) return false;
+        if(dsc->clip_radius != 0 || dsc->bitmap_mask_src || dsc->colorkey) return false;
+
+        /*Only the color formats which can't have transparent pixels*/
+        switch(dsc->header.cf) {
+            case LV_COLOR_FORMAT_L8:
+            case LV_COLOR_FORMAT_RGB565:
+            case LV_COLOR_FORMAT_RGB565_SWAPPED:
+            case LV_COLOR_FORMAT_RGB888:
+            case LV_COLOR_FORMAT_XRGB8888:
+                break;
+            default:
+                return false;
+        }
+
+        /*A not tiled image covers only its own size*/
+        if(!dsc->tile && (!lv_area_is_equal(&dsc->image_area, &t->area) ||
+                          dsc->header.w != lv_area_get_width(&t->area) ||
+                          dsc->header.h != lv_area_get_height(&t->area))) return false;
+    }
+    else {
+        return false;
+    }
+
+    return lv_area_intersect(cover_area, &t->area, &t->clip_area);
+}
+
+/**
+ * Mark the waiting draw tasks which are fully covered by an opaque draw task as finished,
+ * so that they are removed without being drawn.
+ * @param layer         the layer of `t_cover`
+ * @param t_cover       the last draw task added to `layer`
+ */
+static void cull_covered_tasks(lv_layer_t * layer, lv_draw_task_t * t_cover)
+{
+    lv_area_t cover_area;
+    if(!get_opaque_area(t_cover, &cover_area)) return;
+
+    LV_PROFILER_DRAW_BEGIN;
+
+    /*Blur reads the pixels drawn by the older draw tasks, so don't cull the draw tasks below it.
+     *The other draw tasks draw only on their own area, and that area will be overwritten anyway.*/
+
+#if LV_DRAW_TASK_GRID_THRESHOLD
+    lv_draw_task_grid_t * grid = layer->draw_task_grid;
+    if(grid && t_cover->grid_seq) {
+        lv_area_t range;
+        grid_get_bin_range(grid, &cover_area, &range);
+
+        uint32_t seq_min = 0;
+        int32_t bx, by;
+        for(by = range.y1; by <= range.y2; by++) {
+            for(bx = range.x1; bx <= range.x2; bx++) {
+                lv_draw_task_bin_t * bin = &grid->bins[by * LV_DRAW_TASK_GRID_SIZE + bx];
+                int32_t i;
+                for(i = (int32_t)bin->cnt - 1; i >= 0; i--) {
+                    lv_draw_task_t * t = bin->tasks[i];
+                    if(t->grid_seq <= seq_min) break;
+                    if(t->type == LV_DRAW_TASK_TYPE_BLUR && lv_area_is_on(&t->area, &cover_area)) {
+                        seq_min = t->grid_seq;
+                    }
+                }
+            }
+        }
+
+        for(by = range.y1; by <= range.y2; by++) {
+            for(bx = range.x1; bx <= range.x2; bx++) {
+                lv_draw_task_bin_t * bin = &grid->bins[by * LV_DRAW_TASK_GRID_SIZE + bx];
+                int32_t i;
+                for(i = (int32_t)bin->cnt - 1; i >= 0; i--) {
+                    lv_draw_task_t * t = bin->tasks[i];
+                    if(t->grid_seq <= seq_min) break;
+                    if(t != t_cover) cull_task(t, &cover_area);
+                }
+            }
+        }
+
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+#endif
+
+    lv_draw_task_t * t_first = layer->draw_task_head;
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t != t_cover) {
+        if(t->type == LV_DRAW_TASK_TYPE_BLUR && lv_area_is_on(&t->area, &cover_area)) t_first = t->next;
+        t = t->next;
+    }
+
+    t = t_first;
+    while(t != t_cover) {
+        cull_task(t, &cover_area);
+        t = t->next;
+    }
+
+    LV_PROFILER_DRAW_END;
+}
+
+/**
+ * Mark a draw task as finished if it's waiting and all the pixels it would draw are covered
+ * @param t             pointer to an older draw task
+ * @param cover_area    the area which will be overwritten with opaque pixels
+ */
+static void cull_task(lv_draw_task_t * t, const lv_area_t * cover_area)
+{
+    if(t->state != LV_DRAW_TASK_STATE_WAITING) return;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    if(!lv_matrix_is_identity(&t->matrix)) return;
+#endif
+
+    lv_area_t draw_area;
+    uint32_t px_cnt = 0;
+    if(lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area)) {
+        if(!lv_area_is_in(&draw_area, cover_area, 0)) return;
+        px_cnt = lv_area_get_size(&draw_area);
+    }
+
+    t->state = LV_DRAW_TASK_STATE_FINISHED;
+    _draw_info.culled_task_cnt++;
+    _draw_info.culled_px_cnt += px_cnt;
+}
+
+#endif /*LV_DRAW_OCCLUSION_CULLING*/
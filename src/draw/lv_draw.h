@@ -100,6 +100,18 @@ struct _lv_layer_t  {
     /** Linked list of draw tasks */
     lv_draw_task_t * draw_task_head;
 
+    /** Last draw task of `draw_task_head` to append new draw tasks quickly */
+    lv_draw_task_t * draw_task_tail;
+
+    /** Number of draw tasks in `draw_task_head` */
+    uint32_t draw_task_cnt;
+
+    /** Grid of the draw tasks to find the overlapping ones quickly. Created only if there are many draw tasks.*/
+    lv_draw_task_grid_t * draw_task_grid;
+
+    /** If set, the new draw tasks are also recorded into this display list */
+    lv_draw_display_list_t * display_list;
+
     /** Parent layer */
     lv_layer_t * parent;
 
@@ -142,6 +154,12 @@ struct _lv_layer_t  {
     /** Flag indicating all tasks are added */
     bool all_tasks_added;
 
+    /** Set while the display is adding the draw tasks of the layer */
+    bool adding_tasks;
+
+    /** Don't free `draw_buf` with the layer as it's managed by someone else (e.g. a cache) */
+    bool keep_draw_buf;
+
     /** Opacity of the layer */
     lv_opa_t opa;
 };
@@ -264,6 +282,22 @@ void lv_draw_dispatch_request(void);
   */
 uint32_t lv_draw_get_unit_count(void);
 
+#if LV_DRAW_OCCLUSION_CULLING
+/**
+ * Get the number of draw tasks which were not drawn because a later opaque draw task covered them.
+ * The counter is not reset, so compare two readings to get the value for a given period.
+ * @return      the number of culled draw tasks since `lv_init()`
+ */
+uint32_t lv_draw_get_culled_task_count(void);
+
+/**
+ * Get the number of pixels not drawn because a later opaque draw task covered them.
+ * The counter is not reset, so compare two readings to get the value for a given period.
+ * @return      the number of pixels of the culled draw tasks since `lv_init()`
+ */
+uint32_t lv_draw_get_culled_pixel_count(void);
+#endif
+
 /**
  * If there is only one draw unit check the first draw task if it's available.
  * If there are multiple draw units call `lv_draw_get_next_available_task` to find a task.
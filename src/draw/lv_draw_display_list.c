@@ -0,0 +1,279 @@
+/**
+ * @file lv_draw_display_list.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_private.h"
+#include "lv_draw_display_list_private.h"
+#include "lv_draw_mask_private.h"
+#include "lv_draw_rect.h"
+#include "lv_draw_label.h"
+#include "lv_draw_image.h"
+#include "lv_draw_line.h"
+#include "lv_draw_arc.h"
+#include "lv_draw_triangle.h"
+#include "lv_draw_blur.h"
+#include "../misc/lv_area_private.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static size_t get_dsc_size(lv_draw_task_type_t type);
+static inline void * get_entry_dsc(const lv_draw_display_list_entry_t * entry);
+static void translate_dsc(lv_draw_task_type_t type, void * dsc, int32_t ofs_x, int32_t ofs_y);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_draw_display_list_t * lv_draw_display_list_create(void)
+{
+    lv_draw_display_list_t * list = lv_malloc_zeroed(sizeof(lv_draw_display_list_t));
+    LV_ASSERT_MALLOC(list);
+    return list;
+}
+
+void lv_draw_display_list_delete(lv_draw_display_list_t * list)
+{
+    if(list == NULL) return;
+
+    lv_draw_display_list_clear(list);
+    lv_free(list);
+}
+
+void lv_draw_display_list_clear(lv_draw_display_list_t * list)
+{
+    lv_draw_display_list_entry_t * entry = list->entry_head;
+    while(entry) {
+        lv_draw_display_list_entry_t * entry_next = entry->next;
+        lv_free(entry);
+        entry = entry_next;
+    }
+
+    list->entry_head = NULL;
+    list->entry_tail = NULL;
+    list->ready = 0;
+    list->unsupported = 0;
+}
+
+void lv_draw_display_list_record_start(lv_draw_display_list_t * list, lv_layer_t * layer, const lv_area_t * coords)
+{
+    lv_draw_display_list_clear(list);
+    list->coords = *coords;
+    layer->display_list = list;
+}
+
+void lv_draw_display_list_record_end(lv_draw_display_list_t * list, lv_layer_t * layer)
+{
+    layer->display_list = NULL;
+
+    if(list->unsupported) {
+        /*Keep only the flag to not try again*/
+        lv_draw_display_list_clear(list);
+        list->unsupported = 1;
+    }
+    else {
+        list->ready = 1;
+    }
+}
+
+void lv_draw_display_list_add_task(lv_draw_display_list_t * list, const lv_draw_task_t * t)
+{
+    if(list->unsupported) return;
+
+    size_t dsc_size = get_dsc_size(t->type);
+    if(dsc_size == 0) {
+        list->unsupported = 1;
+        return;
+    }
+
+    /*Labels might free the text or change it later, so save a copy*/
+    const lv_draw_label_dsc_t * label_dsc = t->type == LV_DRAW_TASK_TYPE_LABEL ? t->draw_dsc : NULL;
+    size_t text_size = 0;
+    if(label_dsc && label_dsc->text) text_size = lv_strlen(label_dsc->text) + 1;
+
+    size_t entry_size = LV_ALIGN_UP(sizeof(lv_draw_display_list_entry_t), 8);
+    lv_draw_display_list_entry_t * entry = lv_malloc(entry_size + dsc_size + text_size);
+    LV_ASSERT_MALLOC(entry);
+    if(entry == NULL) {
+        list->unsupported = 1;
+        return;
+    }
+
+    entry->next = NULL;
+    entry->type = t->type;
+    entry->area = t->area;
+    entry->real_area = t->_real_area;
+    entry->clip_area = t->clip_area;
+
+    void * dsc = get_entry_dsc(entry);
+    lv_memcpy(dsc, t->draw_dsc, dsc_size);
+
+    if(label_dsc) {
+        lv_draw_label_dsc_t * entry_label_dsc = dsc;
+        if(text_size) {
+            char * text = (char *)dsc + dsc_size;
+            lv_memcpy(text, label_dsc->text, text_size);
+            entry_label_dsc->text = text;
+        }
+        entry_label_dsc->text_local = 0;
+        entry_label_dsc->text_static = 0;
+    }
+
+    if(list->entry_tail) list->entry_tail->next = entry;
+    else list->entry_head = entry;
+    list->entry_tail = entry;
+}
+
+void lv_draw_display_list_replay(const lv_draw_display_list_t * list, lv_layer_t * layer, const lv_area_t * coords)
+{
+    LV_PROFILER_DRAW_BEGIN;
+
+    int32_t ofs_x = coords->x1 - list->coords.x1;
+    int32_t ofs_y = coords->y1 - list->coords.y1;
+
+    lv_area_t clip_area_ori = layer->_clip_area;
+    lv_draw_display_list_entry_t * entry = list->entry_head;
+    while(entry) {
+        lv_area_t clip_area = entry->clip_area;
+        lv_area_move(&clip_area, ofs_x, ofs_y);
+        lv_area_t real_area = entry->real_area;
+        lv_area_move(&real_area, ofs_x, ofs_y);
+
+        if(lv_area_intersect(&clip_area, &clip_area, &clip_area_ori) && lv_area_is_on(&real_area, &clip_area)) {
+            lv_area_t area = entry->area;
+            lv_area_move(&area, ofs_x, ofs_y);
+
+            layer->_clip_area = clip_area;
+            lv_draw_task_t * t = lv_draw_add_task(layer, &area, entry->type);
+            lv_memcpy(t->draw_dsc, get_entry_dsc(entry), get_dsc_size(entry->type));
+            translate_dsc(entry->type, t->draw_dsc, ofs_x, ofs_y);
+            t->_real_area = real_area;
+
+            lv_draw_finalize_task_creation(layer, t);
+        }
+
+        entry = entry->next;
+    }
+
+    layer->_clip_area = clip_area_ori;
+
+    LV_PROFILER_DRAW_END;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Get the size of the draw descriptor of the draw tasks which can be recorded
+ * @param type      type of the draw task
+ * @return          size of the draw descriptor or 0 if it can't be recorded
+ */
+static size_t get_dsc_size(lv_draw_task_type_t type)
+{
+    switch(type) {
+        case LV_DRAW_TASK_TYPE_FILL:
+            return sizeof(lv_draw_fill_dsc_t);
+        case LV_DRAW_TASK_TYPE_BORDER:
+            return sizeof(lv_draw_border_dsc_t);
+        case LV_DRAW_TASK_TYPE_BOX_SHADOW:
+            return sizeof(lv_draw_box_shadow_dsc_t);
+        case LV_DRAW_TASK_TYPE_LETTER:
+            return sizeof(lv_draw_letter_dsc_t);
+        case LV_DRAW_TASK_TYPE_LABEL:
+            return sizeof(lv_draw_label_dsc_t);
+        case LV_DRAW_TASK_TYPE_IMAGE:
+            return sizeof(lv_draw_image_dsc_t);
+        case LV_DRAW_TASK_TYPE_LINE:
+            return sizeof(lv_draw_line_dsc_t);
+        case LV_DRAW_TASK_TYPE_ARC:
+            return sizeof(lv_draw_arc_dsc_t);
+        case LV_DRAW_TASK_TYPE_TRIANGLE:
+            return sizeof(lv_draw_triangle_dsc_t);
+        case LV_DRAW_TASK_TYPE_BLUR:
+            return sizeof(lv_draw_blur_dsc_t);
+        case LV_DRAW_TASK_TYPE_MASK_RECTANGLE:
+            return sizeof(lv_draw_mask_rect_dsc_t);
+
+        /*Layers are freed after drawing and the others refer to external data*/
+        default:
+            return 0;
+    }
+}
+
+static inline void * get_entry_dsc(const lv_draw_display_list_entry_t * entry)
+{
+    return (uint8_t *)entry + LV_ALIGN_UP(sizeof(lv_draw_display_list_entry_t), 8);
+}
+
+/**
+ * Move the absolute coordinates stored in a draw descriptor
+ * @param type      type of the draw task
+ * @param dsc       pointer to the draw descriptor
+ * @param ofs_x     move horizontally by this value
+ * @param ofs_y     move vertically by this value
+ */
+static void translate_dsc(lv_draw_task_type_t type, void * dsc, int32_t ofs_x, int32_t ofs_y)
+{
+    if(ofs_x == 0 && ofs_y == 0) return;
+
+    switch(type) {
+        case LV_DRAW_TASK_TYPE_IMAGE: {
+                lv_draw_image_dsc_t * image_dsc = dsc;
+                lv_area_move(&image_dsc->image_area, ofs_x, ofs_y);
+                break;
+            }
+        case LV_DRAW_TASK_TYPE_LINE: {
+                lv_draw_line_dsc_t * line_dsc = dsc;
+                line_dsc->p1.x += ofs_x;
+                line_dsc->p1.y += ofs_y;
+                line_dsc->p2.x += ofs_x;
+                line_dsc->p2.y += ofs_y;
+                break;
+            }
+        case LV_DRAW_TASK_TYPE_ARC: {
+                lv_draw_arc_dsc_t * arc_dsc = dsc;
+                arc_dsc->center.x += ofs_x;
+                arc_dsc->center.y += ofs_y;
+                break;
+            }
+        case LV_DRAW_TASK_TYPE_TRIANGLE: {
+                lv_draw_triangle_dsc_t * triangle_dsc = dsc;
+                uint32_t i;
+                for(i = 0; i < 3; i++) {
+                    triangle_dsc->p[i].x += ofs_x;
+                    triangle_dsc->p[i].y += ofs_y;
+                }
+                break;
+            }
+        case LV_DRAW_TASK_TYPE_MASK_RECTANGLE: {
+                lv_draw_mask_rect_dsc_t * mask_dsc = dsc;
+                lv_area_move(&mask_dsc->area, ofs_x, ofs_y);
+                break;
+            }
+        default:
+            break;
+    }
+}
@@ -0,0 +1,119 @@
+/**
+ * @file lv_draw_display_list_private.h
+ *
+ */
+
+#ifndef LV_DRAW_DISPLAY_LIST_PRIVATE_H
+#define LV_DRAW_DISPLAY_LIST_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_draw.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct _lv_draw_display_list_entry_t lv_draw_display_list_entry_t;
+
+/**
+ * A recorded draw task.
+ * It's followed by the draw descriptor and by the copy of the text in case of labels.
+ */
+struct _lv_draw_display_list_entry_t {
+    lv_draw_display_list_entry_t * next;
+    lv_draw_task_type_t type;
+    lv_area_t area;
+    lv_area_t real_area;
+    lv_area_t clip_area;
+};
+
+struct _lv_draw_display_list_t {
+    lv_draw_display_list_entry_t * entry_head;
+    lv_draw_display_list_entry_t * entry_tail;
+
+    /** The coordinates of the widget when the draw tasks were recorded.
+     * Used to translate the draw tasks when the widget is moved (e.g. scrolled). */
+    lv_area_t coords;
+
+    /** 1: all the draw tasks are recorded and the list can be replayed */
+    uint8_t ready : 1;
+
+    /** 1: a draw task which can't be recorded was added (e.g. a layer).
+     * Don't try recording again until the list is cleared.*/
+    uint8_t unsupported : 1;
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create an empty display list
+ * @return      the new display list or NULL on error
+ */
+lv_draw_display_list_t * lv_draw_display_list_create(void);
+
+/**
+ * Delete a display list and all the recorded draw tasks
+ * @param list  pointer to a display list
+ */
+void lv_draw_display_list_delete(lv_draw_display_list_t * list);
+
+/**
+ * Remove all the recorded draw tasks, so that the list will be recorded again
+ * @param list  pointer to a display list
+ */
+void lv_draw_display_list_clear(lv_draw_display_list_t * list);
+
+/**
+ * Start recording the draw tasks added to a layer
+ * @param list      pointer to a display list
+ * @param layer     the layer whose new draw tasks should be recorded
+ * @param coords    the current coordinates of the recorded widget
+ */
+void lv_draw_display_list_record_start(lv_draw_display_list_t * list, lv_layer_t * layer, const lv_area_t * coords);
+
+/**
+ * Stop recording the draw tasks of a layer.
+ * If all the draw tasks could be recorded the list becomes ready.
+ * @param list      pointer to a display list
+ * @param layer     the layer passed to `lv_draw_display_list_record_start()`
+ */
+void lv_draw_display_list_record_end(lv_draw_display_list_t * list, lv_layer_t * layer);
+
+/**
+ * Save a copy of a draw task into a display list. Called by `lv_draw_finalize_task_creation()`
+ * while the target layer is recorded.
+ * @param list      pointer to a display list
+ * @param t         the draw task to record
+ */
+void lv_draw_display_list_add_task(lv_draw_display_list_t * list, const lv_draw_task_t * t);
+
+/**
+ * Add the recorded draw tasks to a layer again
+ * @param list      pointer to a ready display list
+ * @param layer     the layer to add the draw tasks to. Its `_clip_area` is also applied.
+ * @param coords    the current coordinates of the recorded widget
+ */
+void lv_draw_display_list_replay(const lv_draw_display_list_t * list, lv_layer_t * layer, const lv_area_t * coords);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_DISPLAY_LIST_PRIVATE_H*/
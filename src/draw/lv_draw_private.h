@@ -26,6 +26,15 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Size step of the draw task pool's size classes [bytes]*/
+#define LV_DRAW_TASK_POOL_CLASS_SIZE    64
+
+/** Number of size classes in the draw task pool. Larger draw tasks are not pooled.*/
+#define LV_DRAW_TASK_POOL_CLASS_CNT     16
+
+/** Number of bins of the draw task grid in both directions*/
+#define LV_DRAW_TASK_GRID_SIZE          16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -84,6 +93,27 @@ struct _lv_draw_task_t {
      */
     uint8_t preference_score;
 
+    /** Order of the draw task in the layer's draw task grid. 0: not added to the grid*/
+    uint32_t grid_seq;
+};
+
+/** A bin of the draw task grid with the draw tasks overlapping it, in order of creation*/
+typedef struct {
+    lv_draw_task_t ** tasks;
+    uint32_t cnt;
+    uint32_t capacity;
+} lv_draw_task_bin_t;
+
+struct _lv_draw_task_grid_t {
+    /** The area covered by the bins. Draw tasks outside of it are added to the closest bins.*/
+    lv_area_t area;
+    int32_t bin_w;
+    int32_t bin_h;
+
+    /** `grid_seq` of the next added draw task*/
+    uint32_t seq_next;
+
+    lv_draw_task_bin_t bins[LV_DRAW_TASK_GRID_SIZE * LV_DRAW_TASK_GRID_SIZE];
 };
 
 struct _lv_draw_mask_t {
@@ -193,12 +223,28 @@ typedef struct {
 #endif
     lv_mutex_t circle_cache_mutex;
     bool task_running;
+
+    /** Finished draw tasks kept for reuse. One singly linked list per size class.*/
+    lv_draw_task_t * task_pool[LV_DRAW_TASK_POOL_CLASS_CNT];
+
+#if LV_DRAW_OCCLUSION_CULLING
+    /** Statistics about the draw tasks removed without drawing, as they were covered by an opaque draw task*/
+    uint32_t culled_task_cnt;
+    uint32_t culled_px_cnt;
+#endif
 } lv_draw_global_info_t;
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Free the draw tasks which were kept for reuse after they were finished.
+ * Should be called when a batch of draw tasks are ready (e.g. at the end of a refresh)
+ * to not keep the memory allocated between the batches.
+ */
+void lv_draw_task_pool_release(void);
+
 /**********************
  *      MACROS
  **********************/
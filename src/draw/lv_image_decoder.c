@@ -119,21 +119,29 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
     dsc->src = src;
     dsc->src_type = lv_image_src_get_type(src);
 
-    lv_mutex_lock(img_decoder_open_lock_p);
-
+    bool use_cache = false;
     if(lv_image_cache_is_enabled()) {
         dsc->cache = img_cache_p;
         /*Try cache first, unless we are told to ignore cache.*/
-        if(!(args && args->no_cache)) {
-            /*
-            * Check the cache first
-            * If the image is found in the cache, just return it.*/
-            if(try_cache(dsc) == LV_RESULT_OK) {
-                lv_mutex_unlock(img_decoder_open_lock_p);
-                LV_PROFILER_DECODER_END;
-                return LV_RESULT_OK;
-            }
-        }
+        use_cache = !(args && args->no_cache);
+    }
+
+    /*
+     * Check the cache first
+     * If the image is found in the cache, just return it.
+     * The cache has its own lock, so the hits don't wait for the images opened by other threads.*/
+    if(use_cache && try_cache(dsc) == LV_RESULT_OK) {
+        LV_PROFILER_DECODER_END;
+        return LV_RESULT_OK;
+    }
+
+    lv_mutex_lock(img_decoder_open_lock_p);
+
+    /*Another thread might have added the image while this one was waiting*/
+    if(use_cache && try_cache(dsc) == LV_RESULT_OK) {
+        lv_mutex_unlock(img_decoder_open_lock_p);
+        LV_PROFILER_DECODER_END;
+        return LV_RESULT_OK;
     }
 
     /*Find the decoder that can open the image source, and get the header info in the same time.*/
@@ -17,6 +17,7 @@
 #include "../../display/lv_display_private.h"
 #include "../../stdlib/lv_string.h"
 #include "../../core/lv_obj_private.h"
+#include "../../core/lv_obj_bitmap_cache_private.h"
 
 /*********************
  *      DEFINES
@@ -177,6 +178,9 @@ lv_result_t lv_snapshot_take_to_draw_buf(lv_obj_t * obj, lv_color_format_t cf, l
         lv_draw_dispatch();
     }
 
+    lv_draw_task_pool_release();
+    lv_obj_bitmap_cache_release_used();
+
     disp_new->layer_head = layer_old;
     lv_refr_set_disp_refreshing(disp_old);
 
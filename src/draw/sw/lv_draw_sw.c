@@ -48,6 +48,22 @@
  **********************/
 #if LV_USE_OS
     static void render_thread_cb(void * ptr);
+    static void thread_queue_push(lv_draw_sw_thread_dsc_t * thread_dsc, lv_draw_task_t * t);
+    static lv_draw_task_t * thread_queue_pop(lv_draw_sw_thread_dsc_t * thread_dsc);
+    static lv_draw_task_t * thread_steal(lv_draw_sw_thread_dsc_t * thread_dsc);
+#endif
+
+#if LV_DRAW_SW_USE_BIN_JOB
+#if LV_DRAW_SW_BIN_TILE_HEIGHT
+    static uint32_t bin_layer(lv_draw_sw_unit_t * draw_sw_unit, lv_layer_t * layer);
+#endif
+#if LV_DRAW_SW_SPLIT_THRESHOLD
+    static bool split_task(lv_draw_sw_unit_t * draw_sw_unit, lv_draw_task_t * t);
+#endif
+    static bool bin_job_start(lv_draw_sw_unit_t * draw_sw_unit, lv_draw_task_t * task_head, uint32_t task_cnt,
+                              const lv_area_t * area, int32_t tile_h);
+    static void bin_job_delete_rendered(lv_draw_sw_unit_t * draw_sw_unit);
+    static bool bin_job_render_tile(lv_draw_sw_unit_t * draw_sw_unit);
 #endif
 
 static void execute_drawing(lv_draw_task_t * t);
@@ -90,11 +106,16 @@ void lv_draw_sw_init(void)
 #endif
 
 #if LV_USE_OS
+#if LV_DRAW_SW_USE_BIN_JOB
+    lv_mutex_init(&draw_sw_unit->bin_lock);
+#endif
+
     uint32_t i;
     for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
         lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
         thread_dsc->idx = i;
         thread_dsc->draw_unit = (void *) draw_sw_unit;
+        lv_mutex_init(&thread_dsc->queue_lock);
         lv_thread_init(&thread_dsc->thread, "swdraw", LV_DRAW_THREAD_PRIO, render_thread_cb,
                        LV_DRAW_THREAD_STACK_SIZE, thread_dsc);
     }
@@ -139,8 +160,14 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
             lv_thread_sync_signal(&thread_dsc->sync);
         }
         lv_thread_delete(&thread_dsc->thread);
+        lv_mutex_delete(&thread_dsc->queue_lock);
     }
 
+#if LV_DRAW_SW_USE_BIN_JOB
+    bin_job_delete_rendered(draw_sw_unit);
+    lv_mutex_delete(&draw_sw_unit->bin_lock);
+#endif
+
     return 0;
 #else
     LV_UNUSED(draw_unit);
@@ -260,48 +287,95 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
      * Otherwise return taken_cnt;
      */
 
-    /*If at least one is busy, it's not all idle*/
+    /*If at least one is busy, it's not all idle.
+     *Lock all the threads as a stolen draw task moves from one thread to another.*/
     bool all_idle = true;
     for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
-        if(draw_sw_unit->thread_dscs[i].task_act) {
+        lv_mutex_lock(&draw_sw_unit->thread_dscs[i].queue_lock);
+    }
+    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
+        if(thread_dsc->task_act || thread_dsc->queue_cnt) {
             all_idle = false;
             break;
         }
     }
+    for(i = LV_DRAW_SW_DRAW_UNIT_CNT; i > 0; i--) {
+        lv_mutex_unlock(&draw_sw_unit->thread_dscs[i - 1].queue_lock);
+    }
+
+#if LV_DRAW_SW_USE_BIN_JOB
+    bin_job_delete_rendered(draw_sw_unit);
+    lv_mutex_lock(&draw_sw_unit->bin_lock);
+    if(draw_sw_unit->bin_job) all_idle = false;
+    lv_mutex_unlock(&draw_sw_unit->bin_lock);
+#endif
+
+#if LV_DRAW_SW_BIN_TILE_HEIGHT
+    if(layer->parent == NULL) {
+        /*Wait until all the draw tasks of the display are added*/
+        if(layer->adding_tasks) {
+            LV_PROFILER_DRAW_END;
+            return all_idle ? LV_DRAW_UNIT_IDLE : 0;
+        }
+
+        /*Render the draw tasks tile by tile if possible*/
+        if(draw_sw_unit->bin_job == NULL) {
+            taken_cnt = bin_layer(draw_sw_unit, layer);
+            if(taken_cnt) {
+                LV_PROFILER_DRAW_END;
+                return taken_cnt;
+            }
+        }
+    }
+#endif
 
+    /*Claim the available tasks and always give them to the thread with the shortest queue.
+     *The claimed tasks don't overlap with any unfinished older tasks, so the threads can
+     *render them in any order and an idle thread can steal them from the others.*/
     lv_draw_task_t * t = NULL;
-    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
-        lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
+    while(1) {
+        lv_draw_sw_thread_dsc_t * thread_dsc = NULL;
+        uint32_t min_cnt = LV_DRAW_SW_THREAD_QUEUE_SIZE;
+        for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+            lv_draw_sw_thread_dsc_t * d = &draw_sw_unit->thread_dscs[i];
+            lv_mutex_lock(&d->queue_lock);
+            uint32_t cnt = d->queue_cnt + (d->task_act ? 1 : 0);
+            lv_mutex_unlock(&d->queue_lock);
+            if(cnt < min_cnt) {
+                min_cnt = cnt;
+                thread_dsc = d;
+            }
+        }
 
-        /*Do nothing if busy*/
-        if(thread_dsc->task_act) continue;
+        /*All queues are full*/
+        if(thread_dsc == NULL) break;
 
         /*Find an available task. Start from the previously taken task.*/
         t = lv_draw_get_next_available_task(layer, t, DRAW_UNIT_ID_SW);
-
-        /*If there is not available task don't try other threads as there won't be available
-         *tasks for then either*/
-        if(t == NULL) {
-            LV_PROFILER_DRAW_END;
-            if(all_idle) return LV_DRAW_UNIT_IDLE;  /*Couldn't start rendering*/
-            else return taken_cnt;
-        }
+        if(t == NULL) break;
 
         /*Allocate a buffer if not done yet.*/
         void * buf = lv_draw_layer_alloc_buf(layer);
-        /*Do not return is failed. The other thread might already have a buffer can do something. */
-        if(buf == NULL) continue;
+        if(buf == NULL) break;
 
-        /*Take the task*/
         all_idle = false;
         taken_cnt++;
+
+#if LV_DRAW_SW_SPLIT_THRESHOLD
+        /*Let all the threads render a part of a huge draw task*/
+        if(draw_sw_unit->bin_job == NULL && split_task(draw_sw_unit, t)) continue;
+#endif
+
+        /*Take the task*/
         t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
-        thread_dsc->task_act = t;
+        thread_queue_push(thread_dsc, t);
 
         /*Let the render thread work*/
         if(thread_dsc->inited) lv_thread_sync_signal(&thread_dsc->sync);
     }
 
+    LV_PROFILER_DRAW_END;
     if(all_idle) return LV_DRAW_UNIT_IDLE;  /*Couldn't start rendering*/
     else return taken_cnt;
 
@@ -349,35 +423,374 @@ static void render_thread_cb(void * ptr)
     lv_thread_sync_init(&thread_dsc->sync);
     thread_dsc->inited = true;
 
+    /*The busy periods of each render thread are traced to see the utilization of the threads*/
+    bool busy = false;
     while(1) {
-        while(thread_dsc->task_act == NULL) {
-            if(thread_dsc->exit_status) {
-                break;
+        if(thread_dsc->exit_status) {
+            LV_LOG_INFO("ready to exit software rendering thread");
+            break;
+        }
+
+        /*Take a task from the own queue or steal one from another thread*/
+        lv_draw_task_t * t = thread_queue_pop(thread_dsc);
+        if(t == NULL) t = thread_steal(thread_dsc);
+
+#if LV_DRAW_SW_USE_BIN_JOB
+        if(t == NULL) {
+            lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *) thread_dsc->draw_unit;
+            if(bin_job_render_tile(draw_sw_unit)) {
+                if(!busy) {
+                    LV_PROFILER_DRAW_BEGIN_TAG("sw_thread_busy");
+                    busy = true;
+                }
+                continue;
+            }
+        }
+#endif
+
+        if(t == NULL) {
+            if(busy) {
+                LV_PROFILER_DRAW_END_TAG("sw_thread_busy");
+                busy = false;
             }
             lv_thread_sync_wait(&thread_dsc->sync);
+            continue;
         }
 
-        if(thread_dsc->exit_status) {
-            LV_LOG_INFO("ready to exit software rendering thread");
-            break;
+        if(!busy) {
+            LV_PROFILER_DRAW_BEGIN_TAG("sw_thread_busy");
+            busy = true;
         }
 
-        execute_drawing(thread_dsc->task_act);
+        execute_drawing(t);
 #if LV_USE_PARALLEL_DRAW_DEBUG
-        parallel_debug_draw(thread_dsc->task_act, thread_dsc->idx);
+        parallel_debug_draw(t, thread_dsc->idx);
 #endif
-        thread_dsc->task_act->state = LV_DRAW_TASK_STATE_FINISHED;
+        t->state = LV_DRAW_TASK_STATE_FINISHED;
+        lv_mutex_lock(&thread_dsc->queue_lock);
         thread_dsc->task_act = NULL;
+        lv_mutex_unlock(&thread_dsc->queue_lock);
 
-        /*The draw unit is free now. Request a new dispatching as it can get a new task*/
+        /*A task is finished so new tasks might be available. Request a new dispatching.*/
         lv_draw_dispatch_request();
-
     }
 
+    if(busy) LV_PROFILER_DRAW_END_TAG("sw_thread_busy");
+
     thread_dsc->inited = false;
     lv_thread_sync_delete(&thread_dsc->sync);
     LV_LOG_INFO("exit software rendering thread");
 }
+
+static void thread_queue_push(lv_draw_sw_thread_dsc_t * thread_dsc, lv_draw_task_t * t)
+{
+    lv_mutex_lock(&thread_dsc->queue_lock);
+    uint32_t i = (thread_dsc->queue_head + thread_dsc->queue_cnt) % LV_DRAW_SW_THREAD_QUEUE_SIZE;
+    thread_dsc->queue[i] = t;
+    thread_dsc->queue_cnt++;
+    lv_mutex_unlock(&thread_dsc->queue_lock);
+}
+
+static lv_draw_task_t * thread_queue_pop(lv_draw_sw_thread_dsc_t * thread_dsc)
+{
+    lv_draw_task_t * t = NULL;
+    lv_mutex_lock(&thread_dsc->queue_lock);
+    if(thread_dsc->queue_cnt) {
+        t = thread_dsc->queue[thread_dsc->queue_head];
+        thread_dsc->queue_head = (thread_dsc->queue_head + 1) % LV_DRAW_SW_THREAD_QUEUE_SIZE;
+        thread_dsc->queue_cnt--;
+        thread_dsc->task_act = t;
+    }
+    lv_mutex_unlock(&thread_dsc->queue_lock);
+    return t;
+}
+
+static lv_draw_task_t * thread_steal(lv_draw_sw_thread_dsc_t * thread_dsc)
+{
+    lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *) thread_dsc->draw_unit;
+    lv_draw_task_t * t = NULL;
+
+    /*Take the newest task of the first thread which has queued tasks*/
+    uint32_t i;
+    for(i = 1; i < LV_DRAW_SW_DRAW_UNIT_CNT && t == NULL; i++) {
+        lv_draw_sw_thread_dsc_t * victim = &draw_sw_unit->thread_dscs[(thread_dsc->idx + i) % LV_DRAW_SW_DRAW_UNIT_CNT];
+
+        /*Lock both threads to move the task from the queue of the victim to the active task of this thread
+         *without a moment when it's in neither. Lock them in the order of their index as `dispatch()` does
+         *to not deadlock with other stealing threads.*/
+        lv_draw_sw_thread_dsc_t * first = victim->idx < thread_dsc->idx ? victim : thread_dsc;
+        lv_draw_sw_thread_dsc_t * second = victim->idx < thread_dsc->idx ? thread_dsc : victim;
+        lv_mutex_lock(&first->queue_lock);
+        lv_mutex_lock(&second->queue_lock);
+        if(victim->queue_cnt) {
+            victim->queue_cnt--;
+            t = victim->queue[(victim->queue_head + victim->queue_cnt) % LV_DRAW_SW_THREAD_QUEUE_SIZE];
+            thread_dsc->task_act = t;
+        }
+        lv_mutex_unlock(&second->queue_lock);
+        lv_mutex_unlock(&first->queue_lock);
+    }
+
+    return t;
+}
+#endif
+
+#if LV_DRAW_SW_USE_BIN_JOB
+#if LV_DRAW_SW_BIN_TILE_HEIGHT
+/**
+ * Render all the draw tasks of a layer tile by tile if all of them can be clipped to tiles.
+ * @param draw_sw_unit  pointer to the SW draw unit
+ * @param layer         the layer whose draw tasks should be binned
+ * @return              number of the taken draw tasks, 0 if the layer can't be rendered by tiles
+ */
+static uint32_t bin_layer(lv_draw_sw_unit_t * draw_sw_unit, lv_layer_t * layer)
+{
+    /*All draw tasks need to be waiting for SW rendering. Blur reads the pixels around the
+     *clip area and vector graphics are rendered in one go, so those can't be split into tiles.*/
+    lv_area_t area = {0};
+    bool area_set = false;
+    uint32_t task_cnt = 0;
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t) {
+        if(t->state != LV_DRAW_TASK_STATE_WAITING || t->preferred_draw_unit_id != DRAW_UNIT_ID_SW ||
+           t->type == LV_DRAW_TASK_TYPE_BLUR) {
+            return 0;
+        }
+#if LV_USE_VECTOR_GRAPHIC
+        if(t->type == LV_DRAW_TASK_TYPE_VECTOR) return 0;
+#endif
+
+        lv_area_t draw_area;
+        if(lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area)) {
+            if(area_set) lv_area_join(&area, &area, &draw_area);
+            else area = draw_area;
+            area_set = true;
+        }
+        task_cnt++;
+        t = t->next;
+    }
+
+    if(!area_set) return 0;
+
+    /*With one tile it's better to look for independent draw tasks*/
+    if(lv_area_get_height(&area) <= LV_DRAW_SW_BIN_TILE_HEIGHT) return 0;
+
+    if(!bin_job_start(draw_sw_unit, layer->draw_task_head, task_cnt, &area, LV_DRAW_SW_BIN_TILE_HEIGHT)) return 0;
+
+    return task_cnt;
+}
+#endif
+
+#if LV_DRAW_SW_SPLIT_THRESHOLD
+/**
+ * Split a huge draw task to as many tiles as many render threads are.
+ * @param draw_sw_unit  pointer to the SW draw unit
+ * @param t             the draw task to split
+ * @return              true if the draw task was split
+ */
+static bool split_task(lv_draw_sw_unit_t * draw_sw_unit, lv_draw_task_t * t)
+{
+    switch(t->type) {
+        case LV_DRAW_TASK_TYPE_FILL:
+        case LV_DRAW_TASK_TYPE_IMAGE:
+        case LV_DRAW_TASK_TYPE_LAYER:
+        case LV_DRAW_TASK_TYPE_BOX_SHADOW:
+            break;
+        default:
+            return false;
+    }
+
+    lv_area_t draw_area;
+    if(!lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area)) return false;
+    if(lv_area_get_size(&draw_area) < LV_DRAW_SW_SPLIT_THRESHOLD) return false;
+
+    int32_t h = lv_area_get_height(&draw_area);
+    int32_t tile_h = (h + LV_DRAW_SW_DRAW_UNIT_CNT - 1) / LV_DRAW_SW_DRAW_UNIT_CNT;
+    if(tile_h >= h) return false;
+
+    return bin_job_start(draw_sw_unit, t, 1, &draw_area, tile_h);
+}
+#endif
+
+/**
+ * Sort draw tasks into full width tiles and let the render threads render them tile by tile.
+ * @param draw_sw_unit  pointer to the SW draw unit
+ * @param task_head     the first draw task to sort
+ * @param task_cnt      number of draw tasks to sort from `task_head`
+ * @param area          the area to cover with tiles
+ * @param tile_h        height of the tiles
+ * @return              true if the tiles are created
+ */
+static bool bin_job_start(lv_draw_sw_unit_t * draw_sw_unit, lv_draw_task_t * task_head, uint32_t task_cnt,
+                          const lv_area_t * area, int32_t tile_h)
+{
+    if(lv_draw_layer_alloc_buf(task_head->target_layer) == NULL) return false;
+
+    /*Use full width tiles as some draw tasks (e.g. transformed images) might render
+     *slightly different pixels if the rows are started from a different X coordinate*/
+    uint32_t tile_cnt = (lv_area_get_height(area) + tile_h - 1) / tile_h;
+
+    lv_draw_sw_bin_job_t * job = lv_malloc_zeroed(sizeof(lv_draw_sw_bin_job_t));
+    LV_ASSERT_MALLOC(job);
+    if(job == NULL) return false;
+
+    job->area = *area;
+    job->tile_h = tile_h;
+    job->tile_cnt = tile_cnt;
+    job->task_cnt = task_cnt;
+    job->tasks = lv_malloc(task_cnt * sizeof(lv_draw_task_t *));
+    job->tile_task_start = lv_malloc_zeroed((tile_cnt + 1) * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(job->tasks);
+    LV_ASSERT_MALLOC(job->tile_task_start);
+    if(job->tasks == NULL || job->tile_task_start == NULL) {
+        lv_free(job->tasks);
+        lv_free(job->tile_task_start);
+        lv_free(job);
+        return false;
+    }
+
+    /*Count the draw tasks of each tile*/
+    uint32_t i;
+    uint32_t entry_cnt = 0;
+    lv_draw_task_t * t = task_head;
+    for(i = 0; i < task_cnt; i++) {
+        job->tasks[i] = t;
+        lv_area_t draw_area;
+        if(lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area)) {
+            int32_t tile1 = (draw_area.y1 - area->y1) / tile_h;
+            int32_t tile2 = (draw_area.y2 - area->y1) / tile_h;
+            int32_t tile;
+            for(tile = tile1; tile <= tile2; tile++) {
+                job->tile_task_start[tile + 1]++;
+            }
+            entry_cnt += tile2 - tile1 + 1;
+        }
+        t = t->next;
+    }
+
+    job->tile_tasks = lv_malloc(entry_cnt * sizeof(lv_draw_task_t *));
+    LV_ASSERT_MALLOC(job->tile_tasks);
+    if(job->tile_tasks == NULL) {
+        lv_free(job->tasks);
+        lv_free(job->tile_task_start);
+        lv_free(job);
+        return false;
+    }
+
+    /*Convert the counts to start indices and use `tile_task_start[tile + 1]` as write position.
+     *When all the draw tasks are added it becomes the start index of the next tile.*/
+    for(i = 1; i <= tile_cnt; i++) {
+        job->tile_task_start[i] += job->tile_task_start[i - 1];
+    }
+    for(i = tile_cnt; i > 0; i--) {
+        job->tile_task_start[i] = job->tile_task_start[i - 1];
+    }
+
+    for(i = 0; i < task_cnt; i++) {
+        t = job->tasks[i];
+        t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+
+        lv_area_t draw_area;
+        if(!lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area)) continue;
+
+        int32_t tile1 = (draw_area.y1 - area->y1) / tile_h;
+        int32_t tile2 = (draw_area.y2 - area->y1) / tile_h;
+        int32_t tile;
+        for(tile = tile1; tile <= tile2; tile++) {
+            job->tile_tasks[job->tile_task_start[tile + 1]++] = t;
+        }
+    }
+
+    lv_mutex_lock(&draw_sw_unit->bin_lock);
+    draw_sw_unit->bin_job = job;
+    lv_mutex_unlock(&draw_sw_unit->bin_lock);
+
+    /*Wake up all the threads to render the tiles*/
+    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
+        if(thread_dsc->inited) lv_thread_sync_signal(&thread_dsc->sync);
+    }
+
+    return true;
+}
+
+/**
+ * Free the binning job if all of its tiles are rendered.
+ * Called from the main thread to not call `lv_free` from the render threads.
+ * @param draw_sw_unit  pointer to the SW draw unit
+ */
+static void bin_job_delete_rendered(lv_draw_sw_unit_t * draw_sw_unit)
+{
+    lv_mutex_lock(&draw_sw_unit->bin_lock);
+    lv_draw_sw_bin_job_t * job = draw_sw_unit->bin_job;
+    if(job && job->tile_rendered == job->tile_cnt) draw_sw_unit->bin_job = NULL;
+    else job = NULL;
+    lv_mutex_unlock(&draw_sw_unit->bin_lock);
+
+    if(job) {
+        lv_free(job->tasks);
+        lv_free(job->tile_task_start);
+        lv_free(job->tile_tasks);
+        lv_free(job);
+    }
+}
+
+/**
+ * Render the next tile of the binning job.
+ * The draw tasks of the tile are rendered in order and clipped to the tile.
+ * @param draw_sw_unit  pointer to the SW draw unit
+ * @return              true if a tile was rendered
+ */
+static bool bin_job_render_tile(lv_draw_sw_unit_t * draw_sw_unit)
+{
+    lv_mutex_lock(&draw_sw_unit->bin_lock);
+    lv_draw_sw_bin_job_t * job = draw_sw_unit->bin_job;
+    if(job == NULL || job->tile_next >= job->tile_cnt) {
+        lv_mutex_unlock(&draw_sw_unit->bin_lock);
+        return false;
+    }
+    uint32_t tile = job->tile_next;
+    job->tile_next++;
+    lv_mutex_unlock(&draw_sw_unit->bin_lock);
+
+    LV_PROFILER_DRAW_BEGIN;
+    lv_area_t tile_area = job->area;
+    tile_area.y1 = job->area.y1 + (int32_t)tile * job->tile_h;
+    tile_area.y2 = LV_MIN(tile_area.y1 + job->tile_h - 1, job->area.y2);
+
+    /*Render a copy of the draw tasks clipped to the tile as the other threads
+     *render the same draw tasks on other tiles*/
+    uint32_t i;
+    for(i = job->tile_task_start[tile]; i < job->tile_task_start[tile + 1]; i++) {
+        lv_draw_task_t tile_task = *job->tile_tasks[i];
+        if(!lv_area_intersect(&tile_task.clip_area, &tile_task.clip_area, &tile_area)) continue;
+
+        /*The hint of labels is updated while drawing, so don't let the threads share it*/
+        lv_draw_label_dsc_t label_dsc;
+        if(tile_task.type == LV_DRAW_TASK_TYPE_LABEL) {
+            label_dsc = *(lv_draw_label_dsc_t *)tile_task.draw_dsc;
+            label_dsc.hint = NULL;
+            tile_task.draw_dsc = &label_dsc;
+        }
+
+        execute_drawing(&tile_task);
+    }
+
+    /*All the tiles are ready, so all the draw tasks are ready too*/
+    lv_mutex_lock(&draw_sw_unit->bin_lock);
+    job->tile_rendered++;
+    if(job->tile_rendered == job->tile_cnt) {
+        for(i = 0; i < job->task_cnt; i++) {
+            job->tasks[i]->state = LV_DRAW_TASK_STATE_FINISHED;
+        }
+    }
+    lv_mutex_unlock(&draw_sw_unit->bin_lock);
+
+    lv_draw_dispatch_request();
+    LV_PROFILER_DRAW_END;
+
+    return true;
+}
 #endif
 
 static void execute_drawing(lv_draw_task_t * t)
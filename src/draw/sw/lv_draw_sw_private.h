@@ -23,6 +23,12 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Number of independent draw tasks which can be queued for a render thread in advance */
+#define LV_DRAW_SW_THREAD_QUEUE_SIZE    4
+
+/** Some draw tasks might be rendered tile by tile by all the render threads */
+#define LV_DRAW_SW_USE_BIN_JOB          (LV_USE_OS && (LV_DRAW_SW_BIN_TILE_HEIGHT > 0 || LV_DRAW_SW_SPLIT_THRESHOLD > 0))
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -33,6 +39,12 @@ extern "C" {
 
 typedef struct {
     lv_draw_task_t * task_act;
+    /** Ring buffer of independent draw tasks claimed for this thread.
+     * The thread takes the oldest one, idle threads steal the newest one.*/
+    lv_draw_task_t * queue[LV_DRAW_SW_THREAD_QUEUE_SIZE];
+    uint32_t queue_head;
+    uint32_t queue_cnt;
+    lv_mutex_t queue_lock;
     lv_thread_t thread;
     lv_thread_sync_t sync;
     lv_draw_unit_t * draw_unit;
@@ -41,10 +53,29 @@ typedef struct {
     volatile bool exit_status;
 } lv_draw_sw_thread_dsc_t;
 
+#if LV_DRAW_SW_USE_BIN_JOB
+/** Draw tasks sorted into full width tiles. The threads render whole tiles. */
+typedef struct {
+    lv_area_t area;                 /**< Area covered by the tiles */
+    int32_t tile_h;
+    uint32_t tile_cnt;
+    uint32_t tile_next;             /**< Index of the next tile to render */
+    uint32_t tile_rendered;         /**< Number of rendered tiles */
+    uint32_t * tile_task_start;     /**< `tile_cnt + 1` indices of the first draw task of the tiles in `tile_tasks` */
+    lv_draw_task_t ** tile_tasks;   /**< The draw tasks of each tile in drawing order */
+    lv_draw_task_t ** tasks;        /**< All the binned draw tasks */
+    uint32_t task_cnt;
+} lv_draw_sw_bin_job_t;
+#endif
+
 struct _lv_draw_sw_unit_t {
     lv_draw_unit_t base_unit;
 #if LV_USE_OS
     lv_draw_sw_thread_dsc_t thread_dscs[LV_DRAW_SW_DRAW_UNIT_CNT];
+#if LV_DRAW_SW_USE_BIN_JOB
+    lv_draw_sw_bin_job_t * bin_job;
+    lv_mutex_t bin_lock;
+#endif
 #else
     lv_draw_task_t * task_act;
 #endif
@@ -211,26 +211,21 @@ errout:
 #if defined(CONFIG_FB_UPDATE)
 static void fbdev_join_inv_areas(lv_display_t * disp, lv_area_t * final_inv_area)
 {
-    uint16_t inv_index;
-
-    bool area_joined = false;
+    uint32_t inv_index;
 
     for(inv_index = 0; inv_index < disp->inv_p; inv_index++) {
-        if(disp->inv_area_joined[inv_index] == 0) {
-            const lv_area_t * area_p = &disp->inv_areas[inv_index];
+        const lv_area_t * area_p = &disp->inv_areas[inv_index];
 
-            /* Join to final_area */
+        /* Join to final_area */
 
-            if(!area_joined) {
-                /* copy first area */
-                lv_area_copy(final_inv_area, area_p);
-                area_joined = true;
-            }
-            else {
-                lv_area_join(final_inv_area,
-                             final_inv_area,
-                             area_p);
-            }
+        if(inv_index == 0) {
+            /* copy first area */
+            lv_area_copy(final_inv_area, area_p);
+        }
+        else {
+            lv_area_join(final_inv_area,
+                         final_inv_area,
+                         area_p);
         }
     }
 }
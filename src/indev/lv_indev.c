@@ -16,6 +16,7 @@
 #include "../display/lv_display_private.h"
 #include "../core/lv_global.h"
 #include "../core/lv_obj_private.h"
+#include "../core/lv_obj_hit_index_private.h"
 #include "../core/lv_group.h"
 #include "../core/lv_refr.h"
 
@@ -622,6 +623,15 @@ lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point)
         int32_t i;
         uint32_t child_cnt = lv_obj_get_child_count(obj);
 
+#if LV_OBJ_HIT_INDEX_MIN_CHILDREN
+        /*With many children check only the ones around the point*/
+        if(child_cnt >= LV_OBJ_HIT_INDEX_MIN_CHILDREN &&
+           lv_obj_hit_index_search(obj, &p_trans, &found_p) == LV_RESULT_OK) {
+            child_cnt = 0;
+            if(found_p) return found_p;
+        }
+#endif
+
         /*If a child matches use it*/
         for(i = child_cnt - 1; i >= 0; i--) {
             lv_obj_t * child = obj->spec_attr->children[i];
@@ -9,6 +9,7 @@
 #include "lv_flex.h"
 #include "../lv_layout.h"
 #include "../../core/lv_obj_private.h"
+#include "../../core/lv_obj_hit_index_private.h"
 
 #if LV_USE_FLEX
 
@@ -178,7 +179,7 @@ static void flex_update(lv_obj_t * cont, void * user_data)
     int32_t next_track_first_item;
 
     if(track_cross_place != LV_FLEX_ALIGN_START) {
-        track_first_item = f.rev ? cont->spec_attr->child_cnt - 1 : 0;
+        track_first_item = f.rev ? (int32_t)cont->spec_attr->child_cnt - 1 : 0;
         track_t t;
         while(track_first_item < (int32_t)cont->spec_attr->child_cnt && track_first_item >= 0) {
             /*Search the first item of the next row*/
@@ -196,7 +197,7 @@ static void flex_update(lv_obj_t * cont, void * user_data)
         place_content(track_cross_place, max_cross_size, total_track_cross_size, track_cnt, cross_pos, &gap);
     }
 
-    track_first_item = f.rev ? cont->spec_attr->child_cnt - 1 : 0;
+    track_first_item = f.rev ? (int32_t)cont->spec_attr->child_cnt - 1 : 0;
 
     if(rtl && !f.row) {
         *cross_pos += total_track_cross_size;
@@ -484,6 +485,7 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
             item->coords.y2 += diff_y;
             lv_obj_invalidate(item);
             lv_obj_move_children_by(item, diff_x, diff_y, false);
+            lv_obj_hit_index_children_changed(item->parent);
         }
 
         if(!(f->row && rtl)) main_pos += area_get_main_size(&item->coords) + item_gap + place_gap
@@ -13,6 +13,7 @@
 #include "../../stdlib/lv_string.h"
 #include "../lv_layout.h"
 #include "../../core/lv_obj_private.h"
+#include "../../core/lv_obj_hit_index_private.h"
 #include "../../core/lv_global.h"
 /*********************
  *      DEFINES
@@ -576,6 +577,7 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
         item->coords.y2 += diff_y;
         lv_obj_invalidate(item);
         lv_obj_move_children_by(item, diff_x, diff_y, false);
+        lv_obj_hit_index_children_changed(item->parent);
     }
 }
 
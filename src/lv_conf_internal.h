@@ -235,6 +235,29 @@
     #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+/** Allocate the widgets, their attributes and small style arrays from chunks of this size
+ *  instead of allocating each of them from the heap. The chunks are grouped by 16 byte size classes
+ *  up to 512 bytes and freed when they become empty. It makes creating and deleting many widgets
+ *  faster and reduces fragmentation. 0: disable */
+#ifndef LV_OBJ_POOL_CHUNK_SIZE
+    #ifdef CONFIG_LV_OBJ_POOL_CHUNK_SIZE
+        #define LV_OBJ_POOL_CHUNK_SIZE CONFIG_LV_OBJ_POOL_CHUNK_SIZE
+    #else
+        #define LV_OBJ_POOL_CHUNK_SIZE  0       /**< [bytes] */
+    #endif
+#endif
+
+/** Allocate the timers, the animations and the style transitions from chunks of this size
+ *  instead of allocating each of them from the heap. It keeps the items iterated in every refresh
+ *  close to each other in the memory. 0: disable */
+#ifndef LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    #ifdef CONFIG_LV_TIMER_ANIM_POOL_CHUNK_SIZE
+        #define LV_TIMER_ANIM_POOL_CHUNK_SIZE CONFIG_LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    #else
+        #define LV_TIMER_ANIM_POOL_CHUNK_SIZE  0    /**< [bytes] */
+    #endif
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -258,6 +281,18 @@
     #endif
 #endif
 
+/** The cost of refreshing an invalidated area besides its pixels (e.g. traversing the widgets and
+ *  starting a flush), expressed in pixels. Invalidated areas are joined if redrawing their bounding
+ *  box costs less than redrawing them separately. Use a larger value if rendering and flushing
+ *  pixels is fast, and a smaller one if e.g. flushing over SPI is the bottleneck. */
+#ifndef LV_INV_AREA_OVERHEAD
+    #ifdef CONFIG_LV_INV_AREA_OVERHEAD
+        #define LV_INV_AREA_OVERHEAD CONFIG_LV_INV_AREA_OVERHEAD
+    #else
+        #define LV_INV_AREA_OVERHEAD 1024   /**< [px] */
+    #endif
+#endif
+
 /*=================
  * OPERATING SYSTEM
  *=================*/
@@ -371,6 +406,30 @@
     #endif
 #endif
 
+/** If a layer has more draw tasks than this, the draw tasks are also sorted into a grid of bins.
+ *  This way only the draw tasks in the same bins need to be checked to find the independent ones,
+ *  which is much faster with thousands of draw tasks and multiple draw units or threads.
+ *  Set it to 0 to always check all the draw tasks of the layer. */
+#ifndef LV_DRAW_TASK_GRID_THRESHOLD
+    #ifdef CONFIG_LV_DRAW_TASK_GRID_THRESHOLD
+        #define LV_DRAW_TASK_GRID_THRESHOLD CONFIG_LV_DRAW_TASK_GRID_THRESHOLD
+    #else
+        #define LV_DRAW_TASK_GRID_THRESHOLD 128
+    #endif
+#endif
+
+/** 1: Don't draw the waiting draw tasks which are fully covered by a newer opaque draw task
+ *  (e.g. a fill without radius, or an image without alpha channel and transformation).
+ *  The draw units don't receive the culled draw tasks at all.
+ *  `lv_draw_get_culled_pixel_count()` tells how many pixels were saved this way. */
+#ifndef LV_DRAW_OCCLUSION_CULLING
+    #ifdef CONFIG_LV_DRAW_OCCLUSION_CULLING
+        #define LV_DRAW_OCCLUSION_CULLING CONFIG_LV_DRAW_OCCLUSION_CULLING
+    #else
+        #define LV_DRAW_OCCLUSION_CULLING 0
+    #endif
+#endif
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -562,6 +621,29 @@
         #endif
     #endif
 
+    /** If > 0, wait until all draw tasks of the display are added, sort them into
+     *  full width tiles of this height (in pixels) and let the threads render whole tiles.
+     *  This way all threads can work even if the draw tasks overlap.
+     *  Requires `LV_DRAW_SW_DRAW_UNIT_CNT > 1`. */
+    #ifndef LV_DRAW_SW_BIN_TILE_HEIGHT
+        #ifdef CONFIG_LV_DRAW_SW_BIN_TILE_HEIGHT
+            #define LV_DRAW_SW_BIN_TILE_HEIGHT CONFIG_LV_DRAW_SW_BIN_TILE_HEIGHT
+        #else
+            #define LV_DRAW_SW_BIN_TILE_HEIGHT  0
+        #endif
+    #endif
+
+    /** If > 0, split fill, image, layer and box shadow draw tasks larger than this many
+     *  pixels into `LV_DRAW_SW_DRAW_UNIT_CNT` horizontal bands which are rendered by all the threads.
+     *  Requires `LV_DRAW_SW_DRAW_UNIT_CNT > 1`. */
+    #ifndef LV_DRAW_SW_SPLIT_THRESHOLD
+        #ifdef CONFIG_LV_DRAW_SW_SPLIT_THRESHOLD
+            #define LV_DRAW_SW_SPLIT_THRESHOLD CONFIG_LV_DRAW_SW_SPLIT_THRESHOLD
+        #else
+            #define LV_DRAW_SW_SPLIT_THRESHOLD  0
+        #endif
+    #endif
+
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #ifndef LV_USE_DRAW_ARM2D_SYNC
         #ifdef CONFIG_LV_USE_DRAW_ARM2D_SYNC
@@ -1532,6 +1614,18 @@
     #endif
 #endif
 
+/** Memory budget in bytes for the bitmaps of the widgets with `LV_OBJ_FLAG_CACHE_BITMAP`.
+ *  These widgets are rendered once into an ARGB8888 bitmap which is drawn until they are invalidated.
+ *  If the budget is exceeded the least recently used bitmaps are freed.
+ *  If size is 0, the flag has no effect. */
+#ifndef LV_OBJ_BITMAP_CACHE_DEF_SIZE
+    #ifdef CONFIG_LV_OBJ_BITMAP_CACHE_DEF_SIZE
+        #define LV_OBJ_BITMAP_CACHE_DEF_SIZE CONFIG_LV_OBJ_BITMAP_CACHE_DEF_SIZE
+    #else
+        #define LV_OBJ_BITMAP_CACHE_DEF_SIZE 0
+    #endif
+#endif
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -1565,6 +1659,57 @@
     #endif
 #endif
 
+/** Memory budget in bytes of caching the resolved values of the style properties per widget
+ *  (e.g. the values used for drawing). Only non-inheritable properties are cached. 0: disable */
+#ifndef LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    #ifdef CONFIG_LV_OBJ_STYLE_VALUE_CACHE_SIZE
+        #define LV_OBJ_STYLE_VALUE_CACHE_SIZE CONFIG_LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    #else
+        #define LV_OBJ_STYLE_VALUE_CACHE_SIZE   0
+    #endif
+#endif
+
+/** Non-constant styles with more properties than this keep their properties sorted by ID
+ *  so that they can be found by binary search instead of a linear scan. */
+#ifndef LV_STYLE_SORTED_PROP_CNT_MIN
+    #ifdef CONFIG_LV_STYLE_SORTED_PROP_CNT_MIN
+        #define LV_STYLE_SORTED_PROP_CNT_MIN CONFIG_LV_STYLE_SORTED_PROP_CNT_MIN
+    #else
+        #define LV_STYLE_SORTED_PROP_CNT_MIN    8
+    #endif
+#endif
+
+/** Search the property IDs of the styles with SSE2, AVX2 or NEON instructions if the compiler enables them.
+ *  The property IDs of each style are padded to the vector width (16 or 32 bytes). */
+#ifndef LV_USE_STYLE_SIMD
+    #ifdef CONFIG_LV_USE_STYLE_SIMD
+        #define LV_USE_STYLE_SIMD CONFIG_LV_USE_STYLE_SIMD
+    #else
+        #define LV_USE_STYLE_SIMD       0
+    #endif
+#endif
+
+/** Find the clicked widget among the children of widgets with at least this many children
+ *  by a grid of their click areas instead of hit testing all children.
+ *  The grid is built when the pointer is used and rebuilt when the children change. 0: disable */
+#ifndef LV_OBJ_HIT_INDEX_MIN_CHILDREN
+    #ifdef CONFIG_LV_OBJ_HIT_INDEX_MIN_CHILDREN
+        #define LV_OBJ_HIT_INDEX_MIN_CHILDREN CONFIG_LV_OBJ_HIT_INDEX_MIN_CHILDREN
+    #else
+        #define LV_OBJ_HIT_INDEX_MIN_CHILDREN   0
+    #endif
+#endif
+
+/** Compute the values of the animations with the same built-in path in one pass and
+ *  coalesce the invalidations of the widgets while the animations are applied */
+#ifndef LV_USE_ANIM_BATCH
+    #ifdef CONFIG_LV_USE_ANIM_BATCH
+        #define LV_USE_ANIM_BATCH CONFIG_LV_USE_ANIM_BATCH
+    #else
+        #define LV_USE_ANIM_BATCH       0
+    #endif
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -2512,6 +2657,18 @@
     #endif
 #endif
 
+#ifndef LV_USE_RECYCLERVIEW
+    #ifdef LV_KCONFIG_PRESENT
+        #ifdef CONFIG_LV_USE_RECYCLERVIEW
+            #define LV_USE_RECYCLERVIEW CONFIG_LV_USE_RECYCLERVIEW
+        #else
+            #define LV_USE_RECYCLERVIEW 0
+        #endif
+    #else
+        #define LV_USE_RECYCLERVIEW 1   /**< Requires: lv_label */
+    #endif
+#endif
+
 #ifndef LV_USE_ROLLER
     #ifdef LV_KCONFIG_PRESENT
         #ifdef CONFIG_LV_USE_ROLLER
@@ -2759,6 +2916,16 @@
     #endif
 #endif
 
+/** Find the properties in the styles of the built-in themes by precomputed property tables
+ *  instead of searching them. Needs about 200 bytes of ROM per style (~13 kB for the default theme). */
+#ifndef LV_USE_THEME_STYLE_TABLES
+    #ifdef CONFIG_LV_USE_THEME_STYLE_TABLES
+        #define LV_USE_THEME_STYLE_TABLES CONFIG_LV_USE_THEME_STYLE_TABLES
+    #else
+        #define LV_USE_THEME_STYLE_TABLES 0
+    #endif
+#endif
+
 /*==================
  * LAYOUTS
  *==================*/
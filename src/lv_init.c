@@ -13,6 +13,7 @@
 #include "draw/lv_draw_buf_private.h"
 #include "core/lv_refr_private.h"
 #include "core/lv_obj_style_private.h"
+#include "core/lv_obj_pool_private.h"
 #include "core/lv_group_private.h"
 #include "lv_init.h"
 #include "core/lv_global.h"
@@ -288,6 +289,8 @@ void lv_init(void)
 
     lv_obj_style_init();
 
+    lv_obj_pool_init();
+
     /*Initialize the screen refresh system*/
     lv_refr_init();
 
@@ -475,6 +478,8 @@ void lv_deinit(void)
 
     lv_obj_style_deinit();
 
+    lv_obj_pool_deinit();
+
 #if LV_USE_UEFI
     lv_uefi_platform_deinit();
 #endif
@@ -27,6 +27,12 @@
 static void cache_drop_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
 static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_data);
 static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
+static void cache_entry_acquire(lv_cache_t * cache, lv_cache_entry_t * entry);
+static void cache_entry_delete(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data);
+static lv_cache_lock_t * get_ref_lock(lv_cache_t * cache, const lv_cache_entry_t * entry);
+static void lock_init(lv_cache_lock_t * lock);
+static void lock_take(lv_cache_lock_t * lock);
+static void lock_give(lv_cache_lock_t * lock);
 
 /**********************
  *  GLOBAL VARIABLES
@@ -63,7 +69,11 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
         return NULL;
     }
 
-    lv_mutex_init(&cache->lock);
+    lock_init(&cache->lock);
+    uint32_t i;
+    for(i = 0; i < LV_CACHE_REF_LOCK_CNT; i++) {
+        lock_init(&cache->ref_locks[i]);
+    }
 
     return cache;
 }
@@ -72,10 +82,14 @@ void lv_cache_destroy(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
-    lv_mutex_lock(&cache->lock);
+    lock_take(&cache->lock);
     cache->clz->destroy_cb(cache, user_data);
-    lv_mutex_unlock(&cache->lock);
-    lv_mutex_delete(&cache->lock);
+    lock_give(&cache->lock);
+    lv_mutex_delete(&cache->lock.mutex);
+    uint32_t i;
+    for(i = 0; i < LV_CACHE_REF_LOCK_CNT; i++) {
+        lv_mutex_delete(&cache->ref_locks[i].mutex);
+    }
     lv_free(cache);
 }
 
@@ -84,22 +98,17 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
-    LV_PROFILER_CACHE_BEGIN;
-
-    lv_mutex_lock(&cache->lock);
+    /*Don't wait for the other threads if there is nothing to find*/
+    if(cache->size == 0) return NULL;
 
-    if(cache->size == 0) {
-        lv_mutex_unlock(&cache->lock);
-
-        LV_PROFILER_CACHE_END;
-        return NULL;
-    }
+    LV_PROFILER_CACHE_BEGIN;
 
+    lock_take(&cache->lock);
     lv_cache_entry_t * entry = cache->clz->get_cb(cache, key, user_data);
     if(entry != NULL) {
-        lv_cache_entry_acquire_data(entry);
+        cache_entry_acquire(cache, entry);
     }
-    lv_mutex_unlock(&cache->lock);
+    lock_give(&cache->lock);
 
     LV_PROFILER_CACHE_END;
     return entry;
@@ -110,14 +119,20 @@ void lv_cache_release(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_
 
     LV_PROFILER_CACHE_BEGIN;
 
-    lv_mutex_lock(&cache->lock);
+    /*Only the reference count is changed, so it's enough to lock it.
+     *The dropped entries are already removed from the cache and only the last reference can free them.*/
+    lv_cache_lock_t * ref_lock = get_ref_lock(cache, entry);
+    lock_take(ref_lock);
     lv_cache_entry_release_data(entry, user_data);
+    bool last_of_invalid = lv_cache_entry_get_ref(entry) == 0 && lv_cache_entry_is_invalid(entry);
+    lock_give(ref_lock);
 
-    if(lv_cache_entry_get_ref(entry) == 0 && lv_cache_entry_is_invalid(entry)) {
+    if(last_of_invalid) {
+        lock_take(&cache->lock);
         cache->ops.free_cb(lv_cache_entry_get_data(entry), user_data);
         lv_cache_entry_delete(entry);
+        lock_give(&cache->lock);
     }
-    lv_mutex_unlock(&cache->lock);
 
     LV_PROFILER_CACHE_END;
 }
@@ -126,21 +141,16 @@ lv_cache_entry_t * lv_cache_add(lv_cache_t * cache, const void * key, void * use
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
-    LV_PROFILER_CACHE_BEGIN;
-
-    lv_mutex_lock(&cache->lock);
-    if(cache->max_size == 0) {
-        lv_mutex_unlock(&cache->lock);
+    if(cache->max_size == 0) return NULL;
 
-        LV_PROFILER_CACHE_END;
-        return NULL;
-    }
+    LV_PROFILER_CACHE_BEGIN;
 
+    lock_take(&cache->lock);
     lv_cache_entry_t * entry = cache_add_internal_no_lock(cache, key, user_data);
     if(entry != NULL) {
-        lv_cache_entry_acquire_data(entry);
+        cache_entry_acquire(cache, entry);
     }
-    lv_mutex_unlock(&cache->lock);
+    lock_give(&cache->lock);
 
     LV_PROFILER_CACHE_END;
     return entry;
@@ -152,14 +162,14 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
 
     LV_PROFILER_CACHE_BEGIN;
 
-    lv_mutex_lock(&cache->lock);
+    lock_take(&cache->lock);
     lv_cache_entry_t * entry = NULL;
 
     if(cache->size != 0) {
         entry = cache->clz->get_cb(cache, key, user_data);
         if(entry != NULL) {
-            lv_cache_entry_acquire_data(entry);
-            lv_mutex_unlock(&cache->lock);
+            cache_entry_acquire(cache, entry);
+            lock_give(&cache->lock);
 
             LV_PROFILER_CACHE_END;
             return entry;
@@ -167,15 +177,17 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
     }
 
     if(cache->max_size == 0) {
-        lv_mutex_unlock(&cache->lock);
+        lock_give(&cache->lock);
 
         LV_PROFILER_CACHE_END;
         return NULL;
     }
 
+    /*The entry is created while the cache is locked
+     *because the other threads looking for the same key would need to wait for it anyway*/
     entry = cache_add_internal_no_lock(cache, key, user_data);
     if(entry == NULL) {
-        lv_mutex_unlock(&cache->lock);
+        lock_give(&cache->lock);
 
         LV_PROFILER_CACHE_END;
         return NULL;
@@ -188,9 +200,9 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
         entry = NULL;
     }
     else {
-        lv_cache_entry_acquire_data(entry);
+        cache_entry_acquire(cache, entry);
     }
-    lv_mutex_unlock(&cache->lock);
+    lock_give(&cache->lock);
 
     LV_PROFILER_CACHE_END;
     return entry;
@@ -215,9 +227,9 @@ void lv_cache_drop(lv_cache_t * cache, const void * key, void * user_data)
 
     LV_PROFILER_CACHE_BEGIN;
 
-    lv_mutex_lock(&cache->lock);
+    lock_take(&cache->lock);
     cache_drop_internal_no_lock(cache, key, user_data);
-    lv_mutex_unlock(&cache->lock);
+    lock_give(&cache->lock);
 
     LV_PROFILER_CACHE_END;
 }
@@ -227,9 +239,9 @@ bool lv_cache_evict_one(lv_cache_t * cache, void * user_data)
 
     LV_PROFILER_CACHE_BEGIN;
 
-    lv_mutex_lock(&cache->lock);
+    lock_take(&cache->lock);
     bool res = cache_evict_one_internal_no_lock(cache, user_data);
-    lv_mutex_unlock(&cache->lock);
+    lock_give(&cache->lock);
 
     LV_PROFILER_CACHE_END;
     return res;
@@ -240,9 +252,17 @@ void lv_cache_drop_all(lv_cache_t * cache, void * user_data)
 
     LV_PROFILER_CACHE_BEGIN;
 
-    lv_mutex_lock(&cache->lock);
+    /*The entries without references are freed, so wait for the ongoing releases*/
+    lock_take(&cache->lock);
+    uint32_t i;
+    for(i = 0; i < LV_CACHE_REF_LOCK_CNT; i++) {
+        lock_take(&cache->ref_locks[i]);
+    }
     cache->clz->drop_all_cb(cache, user_data);
-    lv_mutex_unlock(&cache->lock);
+    for(i = 0; i < LV_CACHE_REF_LOCK_CNT; i++) {
+        lock_give(&cache->ref_locks[i]);
+    }
+    lock_give(&cache->lock);
 
     LV_PROFILER_CACHE_END;
 }
@@ -296,6 +316,19 @@ const char * lv_cache_get_name(lv_cache_t * cache)
     return cache->name;
 }
 
+uint32_t lv_cache_get_contention_cnt(lv_cache_t * cache)
+{
+    LV_ASSERT_NULL(cache);
+
+    uint32_t cnt = cache->lock.contention_cnt;
+    uint32_t i;
+    for(i = 0; i < LV_CACHE_REF_LOCK_CNT; i++) {
+        cnt += cache->ref_locks[i].contention_cnt;
+    }
+
+    return cnt;
+}
+
 lv_iter_t * lv_cache_iter_create(lv_cache_t * cache)
 {
     LV_ASSERT_NULL(cache);
@@ -314,15 +347,18 @@ static void cache_drop_internal_no_lock(lv_cache_t * cache, const void * key, vo
         return;
     }
 
-    if(lv_cache_entry_get_ref(entry) == 0) {
-        cache->clz->remove_cb(cache, entry, user_data);
+    /*If it's still referenced, the last release will free it*/
+    lv_cache_lock_t * ref_lock = get_ref_lock(cache, entry);
+    lock_take(ref_lock);
+    bool referenced = lv_cache_entry_get_ref(entry) != 0;
+    if(referenced) lv_cache_entry_set_flag(entry, LV_CACHE_ENTRY_FLAG_INVALID);
+    lock_give(ref_lock);
+
+    cache->clz->remove_cb(cache, entry, user_data);
+    if(!referenced) {
         cache->ops.free_cb(lv_cache_entry_get_data(entry), user_data);
         lv_cache_entry_delete(entry);
     }
-    else {
-        lv_cache_entry_set_flag(entry, LV_CACHE_ENTRY_FLAG_INVALID);
-        cache->clz->remove_cb(cache, entry, user_data);
-    }
 }
 
 static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_data)
@@ -335,8 +371,7 @@ static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_dat
     }
 
     cache->clz->remove_cb(cache, victim, user_data);
-    cache->ops.free_cb(lv_cache_entry_get_data(victim), user_data);
-    lv_cache_entry_delete(victim);
+    cache_entry_delete(cache, victim, user_data);
     return true;
 }
 
@@ -357,3 +392,61 @@ static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const v
 
     return entry;
 }
+
+/**
+ * Add a reference to an entry. The cache needs to be locked.
+ * @param cache     pointer to a cache
+ * @param entry     an entry of `cache`
+ */
+static void cache_entry_acquire(lv_cache_t * cache, lv_cache_entry_t * entry)
+{
+    lv_cache_lock_t * ref_lock = get_ref_lock(cache, entry);
+    lock_take(ref_lock);
+    lv_cache_entry_acquire_data(entry);
+    lock_give(ref_lock);
+}
+
+/**
+ * Free an entry without references which is already removed from the cache. The cache needs to be locked.
+ * @param cache     pointer to a cache
+ * @param entry     an entry removed from `cache`
+ * @param user_data passed to `free_cb`
+ */
+static void cache_entry_delete(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data)
+{
+    /*The thread which released the last reference might be still reading the entry*/
+    lv_cache_lock_t * ref_lock = get_ref_lock(cache, entry);
+    lock_take(ref_lock);
+    lock_give(ref_lock);
+
+    cache->ops.free_cb(lv_cache_entry_get_data(entry), user_data);
+    lv_cache_entry_delete(entry);
+}
+
+static lv_cache_lock_t * get_ref_lock(lv_cache_t * cache, const lv_cache_entry_t * entry)
+{
+    return &cache->ref_locks[((lv_uintptr_t)entry >> 4) % LV_CACHE_REF_LOCK_CNT];
+}
+
+static void lock_init(lv_cache_lock_t * lock)
+{
+    lv_mutex_init(&lock->mutex);
+    lock->depth = 0;
+    lock->contention_cnt = 0;
+}
+
+static void lock_take(lv_cache_lock_t * lock)
+{
+    /*If another thread holds it now, it's not held anymore when this thread gets it.
+     *If this thread holds it, it's still held. It's a recursive mutex.*/
+    bool held = lock->depth != 0;
+    lv_mutex_lock(&lock->mutex);
+    if(held && lock->depth == 0) lock->contention_cnt++;
+    lock->depth++;
+}
+
+static void lock_give(lv_cache_lock_t * lock)
+{
+    lock->depth--;
+    lv_mutex_unlock(&lock->mutex);
+}
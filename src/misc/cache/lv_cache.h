@@ -215,6 +215,14 @@ void lv_cache_set_name(lv_cache_t * cache, const char * name);
  */
 const char * lv_cache_get_name(lv_cache_t * cache);
 
+/**
+ * Get how many times a thread had to wait for the locks of a cache because another thread held them.
+ * The count is approximate and is meant only for profiling.
+ * @param cache         The cache object pointer to get the contention count.
+ * @return              Returns the number of contended lock operations since the cache was created.
+ */
+uint32_t lv_cache_get_contention_cnt(lv_cache_t * cache);
+
 /**
  * Create an iterator for the cache object. The iterator is used to iterate over all cache entries.
  * @param cache         The cache object pointer to create the iterator.
@@ -20,10 +20,27 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Number of locks protecting the reference counts of the entries of a cache.
+ *  The entries are mapped to them by their address.*/
+#if LV_USE_OS == LV_OS_NONE
+#define LV_CACHE_REF_LOCK_CNT   1
+#else
+#define LV_CACHE_REF_LOCK_CNT   8
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * A mutex of a cache which counts how many times it was found locked by another thread
+ */
+typedef struct {
+    lv_mutex_t mutex;
+    volatile uint32_t depth;            /**< How many times it's locked by the thread holding it */
+    uint32_t contention_cnt;            /**< Number of times it had to be waited for. Approximate. */
+} lv_cache_lock_t;
+
 /**
  * The result of the cache reserve condition callback
  */
@@ -135,7 +152,9 @@ struct _lv_cache_t {
 
     lv_cache_ops_t ops;               /**< Cache operations struct _lv_cache_ops_t */
 
-    lv_mutex_t lock;                  /**< Cache lock used to protect the cache in multithreading environments */
+    lv_cache_lock_t lock;             /**< Cache lock used to protect the cache in multithreading environments */
+    lv_cache_lock_t ref_locks[LV_CACHE_REF_LOCK_CNT]; /**< Protect the reference counts of the entries,
+                                                        *   so releasing an entry doesn't need `lock`*/
 
     const char * name;                /**< Name of the cache */
 };
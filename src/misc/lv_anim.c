@@ -15,6 +15,9 @@
 #include "lv_math.h"
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_string.h"
+#if LV_USE_ANIM_BATCH
+    #include "../core/lv_obj_private.h"
+#endif
 
 /*********************
  *      DEFINES
@@ -30,7 +33,7 @@
 #define LV_ANIM_SPEED_MASK 0x80000000
 
 #define state LV_GLOBAL_DEFAULT()->anim_state
-#define anim_ll_p &(state.anim_ll)
+#define anim_list_p &(state.anim_list)
 
 /**********************
  *      TYPEDEFS
@@ -49,10 +52,32 @@ static void lv_anim_pause_for_internal(lv_anim_t * a, uint32_t ms);
 static void resolve_time(lv_anim_t * a);
 static bool remove_concurrent_anims(const lv_anim_t * a_current);
 static void remove_anim(void * a);
+static void free_anim(lv_anim_t * a);
+static lv_anim_t * anim_mem_alloc(void);
+static void anim_mem_free(lv_anim_t * a);
+static void anim_advance_time(lv_anim_t * a);
+static int32_t anim_get_value(lv_anim_t * a);
+#if LV_USE_ANIM_BATCH
+    static void anim_batch_compute(void);
+    static bool anim_batch_add(lv_anim_batch_t * batch, lv_anim_t * a);
+    static void anim_batch_linear(lv_anim_batch_t * batch);
+    static void anim_batch_cubic_bezier(lv_anim_batch_t * batch, int32_t x1, int32_t y1, int32_t x2, int32_t y2);
+    static void anim_batch_step(lv_anim_batch_t * batch);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_USE_ANIM_BATCH
+static const lv_anim_path_cb_t batch_path_cbs[LV_ANIM_BATCH_PATH_CNT] = {
+    [LV_ANIM_BATCH_PATH_LINEAR] = lv_anim_path_linear,
+    [LV_ANIM_BATCH_PATH_EASE_IN] = lv_anim_path_ease_in,
+    [LV_ANIM_BATCH_PATH_EASE_OUT] = lv_anim_path_ease_out,
+    [LV_ANIM_BATCH_PATH_EASE_IN_OUT] = lv_anim_path_ease_in_out,
+    [LV_ANIM_BATCH_PATH_OVERSHOOT] = lv_anim_path_overshoot,
+    [LV_ANIM_BATCH_PATH_STEP] = lv_anim_path_step,
+};
+#endif
 
 /**********************
  *      MACROS
@@ -69,7 +94,10 @@ static void remove_anim(void * a);
 
 void lv_anim_core_init(void)
 {
-    lv_ll_init(anim_ll_p, sizeof(lv_anim_t));
+    lv_ilist_init(anim_list_p, offsetof(lv_anim_t, link));
+#if LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    lv_slab_init(&state.anim_pool, sizeof(lv_anim_t), LV_TIMER_ANIM_POOL_CHUNK_SIZE);
+#endif
     state.timer = lv_timer_create(anim_timer, LV_DEF_REFR_PERIOD, NULL);
     anim_mark_list_change(); /*Turn off the animation timer*/
     state.anim_list_changed = false;
@@ -79,6 +107,22 @@ void lv_anim_core_init(void)
 void lv_anim_core_deinit(void)
 {
     lv_anim_delete_all();
+#if LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    lv_slab_deinit(&state.anim_pool);
+#endif
+
+#if LV_USE_ANIM_BATCH
+    uint32_t i;
+    for(i = 0; i < LV_ANIM_BATCH_PATH_CNT; i++) {
+        lv_anim_batch_t * batch = &state.batches[i];
+        lv_free(batch->act_times);
+        lv_free(batch->durations);
+        lv_free(batch->start_values);
+        lv_free(batch->end_values);
+        lv_free(batch->values);
+        lv_memzero(batch, sizeof(lv_anim_batch_t));
+    }
+#endif
 }
 
 void lv_anim_enable_vsync_mode(bool enable)
@@ -130,12 +174,13 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
     }
 
     /*Add the new animation to the animation linked list*/
-    lv_anim_t * new_anim = lv_ll_ins_head(anim_ll_p);
+    lv_anim_t * new_anim = anim_mem_alloc();
     LV_ASSERT_MALLOC(new_anim);
     if(new_anim == NULL) return NULL;
 
     /*Initialize the animation descriptor*/
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
+    lv_ilist_ins_head(anim_list_p, new_anim);
     if(a->var == a) new_anim->var = new_anim;
     new_anim->run_round = state.anim_run_round;
     new_anim->last_timer_run = lv_tick_get();
@@ -187,7 +232,7 @@ bool lv_anim_delete(void * var, lv_anim_exec_xcb_t exec_cb)
 {
     lv_anim_t * a;
     bool del_any = false;
-    a        = lv_ll_get_head(anim_ll_p);
+    a        = lv_ilist_get_head(anim_list_p);
     while(a != NULL) {
         bool del = false;
         if((a->var == var || var == NULL) && (a->exec_cb == exec_cb || exec_cb == NULL)) {
@@ -199,23 +244,57 @@ bool lv_anim_delete(void * var, lv_anim_exec_xcb_t exec_cb)
         }
 
         /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
+         *how `anim_list_p` was changes in `a->deleted_cb` */
+        a = del ? lv_ilist_get_head(anim_list_p) : lv_ilist_get_next(anim_list_p, a);
     }
 
     return del_any;
 }
 
+bool lv_anim_delete_filtered(bool (*filter_cb)(void * var, void * user_data), void * user_data)
+{
+    /*Collect the animations to delete first because `a->deleted_cb` might change `anim_list_p`*/
+    lv_ilist_t del_list;
+    lv_ilist_init(&del_list, offsetof(lv_anim_t, link));
+
+    lv_anim_t * a = lv_ilist_get_head(anim_list_p);
+    while(a != NULL) {
+        lv_anim_t * a_next = lv_ilist_get_next(anim_list_p, a);
+        if(filter_cb(a->var, user_data)) {
+            lv_ilist_remove(anim_list_p, a);
+            lv_ilist_ins_tail(&del_list, a);
+        }
+        a = a_next;
+    }
+
+    if(lv_ilist_is_empty(&del_list)) return false;
+
+    anim_mark_list_change(); /*Read by `anim_timer`*/
+
+    a = lv_ilist_get_head(&del_list);
+    while(a != NULL) {
+        lv_ilist_remove(&del_list, a);
+        free_anim(a);
+        a = lv_ilist_get_head(&del_list);
+    }
+
+    return true;
+}
+
 void lv_anim_delete_all(void)
 {
-    lv_ll_clear_custom(anim_ll_p, remove_anim);
+    lv_anim_t * a = lv_ilist_get_head(anim_list_p);
+    while(a != NULL) {
+        remove_anim(a);
+        a = lv_ilist_get_head(anim_list_p);
+    }
     anim_mark_list_change();
 }
 
 lv_anim_t * lv_anim_get(void * var, lv_anim_exec_xcb_t exec_cb)
 {
     lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) {
+    LV_ILIST_READ(anim_list_p, a) {
         if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
             return a;
         }
@@ -233,7 +312,7 @@ uint16_t lv_anim_count_running(void)
 {
     uint16_t cnt = 0;
     lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) cnt++;
+    LV_ILIST_READ(anim_list_p, a) cnt++;
 
     return cnt;
 }
@@ -587,25 +666,17 @@ static void anim_timer(lv_timer_t * param)
     /*Flip the run round*/
     state.anim_run_round = state.anim_run_round ? false : true;
 
-    lv_anim_t * a = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        uint32_t elaps = lv_tick_elaps(a->last_timer_run);
+#if LV_USE_ANIM_BATCH
+    anim_batch_compute();
 
-        if(a->is_paused) {
-            const uint32_t time_paused = lv_tick_elaps(a->pause_time);
-            const bool is_pause_over = a->pause_duration != LV_ANIM_PAUSE_FOREVER && time_paused >= a->pause_duration;
+    /*The exec_cbs usually invalidate the same widgets several times*/
+    lv_obj_inv_batch_t inv_batch;
+    lv_obj_invalidate_batch_begin(&inv_batch);
+#endif
 
-            if(is_pause_over) {
-                const uint32_t pause_overrun = time_paused - a->pause_duration;
-                a->is_paused = false;
-                a->act_time += pause_overrun;
-                a->run_round = !state.anim_run_round;
-            }
-        }
-        else {
-            a->act_time += elaps;
-        }
-        a->last_timer_run = lv_tick_get();
+    lv_anim_t * a = lv_ilist_get_head(anim_list_p);
+    while(a != NULL) {
+        anim_advance_time(a);
 
         /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation delete
          * happened in `anim_completed_handler` which could make this linked list reading corrupt
@@ -639,7 +710,7 @@ static void anim_timer(lv_timer_t * param)
 
                 int32_t act_time_before_exec = a->act_time;
                 int32_t new_value;
-                new_value = a->path_cb(a);
+                new_value = anim_get_value(a);
 
                 if(new_value != a->current_value) {
                     a->current_value = new_value;
@@ -666,13 +737,201 @@ static void anim_timer(lv_timer_t * param)
         /*If the linked list changed due to anim. delete then it's not safe to continue
          *the reading of the list from here -> start from the head*/
         if(state.anim_list_changed)
-            a = lv_ll_get_head(anim_ll_p);
+            a = lv_ilist_get_head(anim_list_p);
         else
-            a = lv_ll_get_next(anim_ll_p, a);
+            a = lv_ilist_get_next(anim_list_p, a);
     }
 
+#if LV_USE_ANIM_BATCH
+    lv_obj_invalidate_batch_end(&inv_batch);
+#endif
+}
+
+/**
+ * Add the time elapsed since the last run to the time of an animation and end its pause if it's over.
+ * @param a     pointer to an animation
+ */
+static void anim_advance_time(lv_anim_t * a)
+{
+    uint32_t elaps = lv_tick_elaps(a->last_timer_run);
+
+    if(a->is_paused) {
+        const uint32_t time_paused = lv_tick_elaps(a->pause_time);
+        const bool is_pause_over = a->pause_duration != LV_ANIM_PAUSE_FOREVER && time_paused >= a->pause_duration;
+
+        if(is_pause_over) {
+            const uint32_t pause_overrun = time_paused - a->pause_duration;
+            a->is_paused = false;
+            a->act_time += pause_overrun;
+            a->run_round = !state.anim_run_round;
+        }
+    }
+    else {
+        a->act_time += elaps;
+    }
+    a->last_timer_run = lv_tick_get();
+}
+
+/**
+ * Get the current value of an animation. `act_time` should be already limited to `duration`.
+ * @param a     pointer to an animation
+ * @return      the value computed in the batch of the animation or by its `path_cb`
+ */
+static int32_t anim_get_value(lv_anim_t * a)
+{
+#if LV_USE_ANIM_BATCH
+    if(a->batch_path != LV_ANIM_BATCH_PATH_NONE && a->path_cb == batch_path_cbs[a->batch_path]) {
+        const lv_anim_batch_t * batch = &state.batches[a->batch_path];
+        const uint32_t i = a->batch_index;
+
+        /*Use the computed value only if nothing has changed since then, e.g. in a callback*/
+        if(i < batch->cnt && batch->act_times[i] == a->act_time && batch->durations[i] == a->duration &&
+           batch->start_values[i] == a->start_value && batch->end_values[i] == a->end_value) {
+            return batch->values[i];
+        }
+    }
+#endif
+
+    return a->path_cb(a);
 }
 
+#if LV_USE_ANIM_BATCH
+
+/**
+ * Advance the time of the animations and compute the values of those that will run now
+ * with a built-in path. The values are computed path by path in tight loops over
+ * the parameters stored by fields, instead of calling `path_cb` for each animation.
+ */
+static void anim_batch_compute(void)
+{
+    uint32_t i;
+    for(i = 0; i < LV_ANIM_BATCH_PATH_CNT; i++) {
+        state.batches[i].cnt = 0;
+    }
+
+    lv_anim_t * a;
+    LV_ILIST_READ(anim_list_p, a) {
+        anim_advance_time(a);
+        a->batch_path = LV_ANIM_BATCH_PATH_NONE;
+
+        /*The ones starting now are skipped as `start_cb` and `get_value_cb` might change them*/
+        if(a->is_paused || a->run_round == state.anim_run_round || !a->start_cb_called || a->act_time < 0) continue;
+
+        for(i = LV_ANIM_BATCH_PATH_NONE + 1; i < LV_ANIM_BATCH_PATH_CNT; i++) {
+            if(a->path_cb == batch_path_cbs[i]) break;
+        }
+        if(i == LV_ANIM_BATCH_PATH_CNT) continue;
+
+        if(anim_batch_add(&state.batches[i], a)) a->batch_path = i;
+    }
+
+    anim_batch_linear(&state.batches[LV_ANIM_BATCH_PATH_LINEAR]);
+    anim_batch_cubic_bezier(&state.batches[LV_ANIM_BATCH_PATH_EASE_IN], LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
+                            LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1));
+    anim_batch_cubic_bezier(&state.batches[LV_ANIM_BATCH_PATH_EASE_OUT], LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0),
+                            LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+    anim_batch_cubic_bezier(&state.batches[LV_ANIM_BATCH_PATH_EASE_IN_OUT], LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
+                            LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+    anim_batch_cubic_bezier(&state.batches[LV_ANIM_BATCH_PATH_OVERSHOOT], 341, 0, 683, 1300);
+    anim_batch_step(&state.batches[LV_ANIM_BATCH_PATH_STEP]);
+}
+
+/**
+ * Add the parameters of an animation to a batch
+ * @param batch     pointer to a batch
+ * @param a         pointer to an animation
+ * @return          true: added; false: out of memory
+ */
+static bool anim_batch_add(lv_anim_batch_t * batch, lv_anim_t * a)
+{
+    if(batch->cnt == batch->cap) {
+        uint32_t new_cap = batch->cap ? batch->cap * 2 : 16;
+        int32_t ** arrays[] = {&batch->act_times, &batch->durations, &batch->start_values, &batch->end_values, &batch->values};
+        uint32_t i;
+        for(i = 0; i < sizeof(arrays) / sizeof(arrays[0]); i++) {
+            int32_t * new_array = lv_realloc(*arrays[i], new_cap * sizeof(int32_t));
+            if(new_array == NULL) return false;
+            *arrays[i] = new_array;
+        }
+        batch->cap = new_cap;
+    }
+
+    const uint32_t i = batch->cnt;
+    batch->act_times[i] = a->act_time > a->duration ? a->duration : a->act_time;
+    batch->durations[i] = a->duration;
+    batch->start_values[i] = a->start_value;
+    batch->end_values[i] = a->end_value;
+    a->batch_index = i;
+    batch->cnt++;
+
+    return true;
+}
+
+/**
+ * Compute the values of a batch the same way as `lv_anim_path_linear`
+ * @param batch     pointer to a batch
+ */
+static void anim_batch_linear(lv_anim_batch_t * batch)
+{
+    const int32_t * act_times = batch->act_times;
+    const int32_t * durations = batch->durations;
+    const int32_t * start_values = batch->start_values;
+    const int32_t * end_values = batch->end_values;
+    int32_t * values = batch->values;
+    const uint32_t cnt = batch->cnt;
+    uint32_t i;
+
+    /*The same as `lv_map(act_time, 0, duration, 0, LV_ANIM_RESOLUTION)` as `act_time` is in [0..duration]*/
+    for(i = 0; i < cnt; i++) {
+        int32_t step = durations[i] ? (act_times[i] * LV_ANIM_RESOLUTION) / durations[i] : 0;
+        values[i] = ((step * (end_values[i] - start_values[i])) >> LV_ANIM_RES_SHIFT) + start_values[i];
+    }
+}
+
+/**
+ * Compute the values of a batch the same way as `lv_anim_path_cubic_bezier`
+ * @param batch     pointer to a batch
+ * @param x1        x coordinate of the first control point
+ * @param y1        y coordinate of the first control point
+ * @param x2        x coordinate of the second control point
+ * @param y2        y coordinate of the second control point
+ */
+static void anim_batch_cubic_bezier(lv_anim_batch_t * batch, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    int32_t * values = batch->values;
+    const uint32_t cnt = batch->cnt;
+    uint32_t i;
+
+    for(i = 0; i < cnt; i++) {
+        values[i] = batch->durations[i] ? (batch->act_times[i] * (int32_t)LV_BEZIER_VAL_MAX) / batch->durations[i] : 0;
+    }
+
+    /*The curve is solved iteratively, so it's done in a separate pass*/
+    for(i = 0; i < cnt; i++) {
+        values[i] = lv_cubic_bezier(values[i], x1, y1, x2, y2);
+    }
+
+    for(i = 0; i < cnt; i++) {
+        values[i] = ((values[i] * (batch->end_values[i] - batch->start_values[i])) >> LV_BEZIER_VAL_SHIFT) +
+                    batch->start_values[i];
+    }
+}
+
+/**
+ * Compute the values of a batch the same way as `lv_anim_path_step`
+ * @param batch     pointer to a batch
+ */
+static void anim_batch_step(lv_anim_batch_t * batch)
+{
+    const uint32_t cnt = batch->cnt;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        batch->values[i] = batch->act_times[i] >= batch->durations[i] ? batch->end_values[i] : batch->start_values[i];
+    }
+}
+
+#endif /*LV_USE_ANIM_BATCH*/
+
 /**
  * Called when an animation is completed to do the necessary things
  * e.g. repeat, play in reverse, delete etc.
@@ -692,7 +951,7 @@ static void anim_completed_handler(lv_anim_t * a)
 
         /*Delete the animation from the list.
          * This way the `completed_cb` will see the animations like it's animation is already deleted*/
-        lv_ll_remove(anim_ll_p, a);
+        lv_ilist_remove(anim_list_p, a);
         /*Flag that the list has changed*/
         anim_mark_list_change();
 
@@ -705,7 +964,7 @@ static void anim_completed_handler(lv_anim_t * a)
             a->ext_data.data = NULL;
         }
 #endif
-        lv_free(a);
+        anim_mem_free(a);
     }
     /*If the animation is not deleted then restart it*/
     else {
@@ -742,7 +1001,7 @@ static void anim_vsync_event(lv_event_t * e)
 static void anim_mark_list_change(void)
 {
     state.anim_list_changed = true;
-    if(lv_ll_get_head(anim_ll_p) == NULL) {
+    if(lv_ilist_get_head(anim_list_p) == NULL) {
         if(state.timer) {
             lv_timer_pause(state.timer);
             return;
@@ -809,7 +1068,7 @@ static bool remove_concurrent_anims(const lv_anim_t * a_current)
 
     lv_anim_t * a;
     bool del_any = false;
-    a = lv_ll_get_head(anim_ll_p);
+    a = lv_ilist_get_head(anim_list_p);
     while(a != NULL) {
         bool del = false;
         /*We can't test for custom_exec_cb equality because in the MicroPython binding
@@ -820,7 +1079,7 @@ static bool remove_concurrent_anims(const lv_anim_t * a_current)
            (a->var == a_current->var) &&
            ((a->exec_cb && a->exec_cb == a_current->exec_cb)
             /*|| (a->custom_exec_cb && a->custom_exec_cb == a_current->custom_exec_cb)*/)) {
-            lv_ll_remove(anim_ll_p, a);
+            lv_ilist_remove(anim_list_p, a);
             if(a->deleted_cb != NULL) a->deleted_cb(a);
 #if LV_USE_EXT_DATA
             if(a->ext_data.free_cb) {
@@ -828,7 +1087,7 @@ static bool remove_concurrent_anims(const lv_anim_t * a_current)
                 a->ext_data.data = NULL;
             }
 #endif
-            lv_free(a);
+            anim_mem_free(a);
             /*Read by `anim_timer`. It need to know if a delete occurred in the linked list*/
             anim_mark_list_change();
 
@@ -837,8 +1096,8 @@ static bool remove_concurrent_anims(const lv_anim_t * a_current)
         }
 
         /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
+         *how `anim_list_p` was changes in `a->deleted_cb` */
+        a = del ? lv_ilist_get_head(anim_list_p) : lv_ilist_get_next(anim_list_p, a);
     }
 
     return del_any;
@@ -846,14 +1105,40 @@ static bool remove_concurrent_anims(const lv_anim_t * a_current)
 
 static void remove_anim(void * a)
 {
-    lv_anim_t * anim = a;
-    lv_ll_remove(anim_ll_p, a);
-    if(anim->deleted_cb != NULL) anim->deleted_cb(anim);
+    lv_ilist_remove(anim_list_p, a);
+    free_anim(a);
+}
+
+/**
+ * Free an animation already removed from the animation list
+ * @param a     pointer to the animation
+ */
+static void free_anim(lv_anim_t * a)
+{
+    if(a->deleted_cb != NULL) a->deleted_cb(a);
 #if LV_USE_EXT_DATA
-    if(anim->ext_data.free_cb) {
-        anim->ext_data.free_cb(anim->ext_data.data);
-        anim->ext_data.data = NULL;
+    if(a->ext_data.free_cb) {
+        a->ext_data.free_cb(a->ext_data.data);
+        a->ext_data.data = NULL;
     }
 #endif
+    anim_mem_free(a);
+}
+
+static lv_anim_t * anim_mem_alloc(void)
+{
+#if LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    return lv_slab_alloc(&state.anim_pool);
+#else
+    return lv_malloc(sizeof(lv_anim_t));
+#endif
+}
+
+static void anim_mem_free(lv_anim_t * a)
+{
+#if LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    lv_slab_free(a);
+#else
     lv_free(a);
+#endif
 }
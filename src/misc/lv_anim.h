@@ -18,6 +18,7 @@ extern "C" {
 #include "lv_math.h"
 #include "lv_timer.h"
 #include "lv_ll.h"
+#include "lv_ilist.h"
 
 #if LV_USE_EXT_DATA
 #include "../lvgl_private.h"
@@ -153,6 +154,7 @@ struct _lv_anim_t {
     } parameter;
 
     /* Animation system use these - user shouldn't set */
+    lv_ilist_link_t link;                     /**< Links of the list of the running animations */
     uint32_t last_timer_run;
     uint32_t pause_time;                      /**<The time when the animation was paused*/
     uint32_t pause_duration;                  /**<The amount of the time the animation must stay paused for*/
@@ -162,6 +164,10 @@ struct _lv_anim_t {
                                                * time animation timer executes), indicates this animation needs to be updated. */
     uint8_t start_cb_called : 1;              /**< Indicates that `start_cb` was already called */
     uint8_t early_apply  : 1;                 /**< 1: Apply start value immediately even is there is a `delay` */
+#if LV_USE_ANIM_BATCH
+    uint8_t batch_path : 3;                   /**< The batch the value was computed in. See `lv_anim_batch_path_t` */
+    uint32_t batch_index;                     /**< Index of the value in the batch*/
+#endif
 };
 
 /**********************
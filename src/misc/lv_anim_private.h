@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_anim.h"
+#include "lv_slab.h"
 
 /*********************
  *      DEFINES
@@ -24,12 +25,46 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_ANIM_BATCH
+/** The built-in paths whose values are computed in batches*/
+typedef enum {
+    LV_ANIM_BATCH_PATH_NONE,    /**< Computed by calling `path_cb`*/
+    LV_ANIM_BATCH_PATH_LINEAR,
+    LV_ANIM_BATCH_PATH_EASE_IN,
+    LV_ANIM_BATCH_PATH_EASE_OUT,
+    LV_ANIM_BATCH_PATH_EASE_IN_OUT,
+    LV_ANIM_BATCH_PATH_OVERSHOOT,
+    LV_ANIM_BATCH_PATH_STEP,
+    LV_ANIM_BATCH_PATH_CNT,
+} lv_anim_batch_path_t;
+
+/**
+ * The parameters of the animations with the same path, stored by fields
+ * so that their values can be computed in one pass.
+ */
+typedef struct {
+    int32_t * act_times;        /**< `act_time` limited to `duration`*/
+    int32_t * durations;
+    int32_t * start_values;
+    int32_t * end_values;
+    int32_t * values;           /**< The computed values*/
+    uint32_t cnt;               /**< Number of animations in the batch*/
+    uint32_t cap;               /**< Number of animations the arrays have room for*/
+} lv_anim_batch_t;
+#endif
+
 typedef struct {
     bool anim_list_changed;
     bool anim_run_round;
     bool anim_vsync_registered;
     lv_timer_t * timer;
-    lv_ll_t anim_ll;
+    lv_ilist_t anim_list;       /**< The running animations, linked by their `link` field*/
+#if LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    lv_slab_t anim_pool;        /**< The running animations are allocated from here*/
+#endif
+#if LV_USE_ANIM_BATCH
+    lv_anim_batch_t batches[LV_ANIM_BATCH_PATH_CNT];
+#endif
 } lv_anim_state_t;
 
 /**********************
@@ -52,6 +87,15 @@ void lv_anim_core_deinit(void);
  */
 void lv_anim_enable_vsync_mode(bool enable);
 
+/**
+ * Delete the animations whose variable is selected by a callback.
+ * The animation list is walked only once regardless of how many animations are deleted.
+ * @param filter_cb     called with the variable of each animation. Return `true` to delete the animation.
+ * @param user_data     passed to `filter_cb`
+ * @return              true: at least 1 animation was deleted
+ */
+bool lv_anim_delete_filtered(bool (*filter_cb)(void * var, void * user_data), void * user_data);
+
 /**********************
  *      MACROS
  **********************/
@@ -92,6 +92,33 @@ lv_result_t lv_async_call_cancel(lv_async_cb_t async_xcb, void * user_data)
     return res;
 }
 
+lv_result_t lv_async_call_cancel_filtered(lv_async_cb_t async_xcb, lv_async_filter_cb_t filter_cb, void * filter_data)
+{
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+    lv_result_t res = LV_RESULT_INVALID;
+
+    while(timer != NULL) {
+        /*Find the next timer node*/
+        lv_timer_t * timer_next = lv_timer_get_next(timer);
+
+        /*Find async timer callback*/
+        if(timer->timer_cb == lv_async_timer_cb) {
+            lv_async_info_t * info = (lv_async_info_t *)timer->user_data;
+
+            /*Match user function callback and let the filter check the user data*/
+            if(info->cb == async_xcb && filter_cb(info->user_data, filter_data)) {
+                lv_timer_delete(timer);
+                lv_free(info);
+                res = LV_RESULT_OK;
+            }
+        }
+
+        timer = timer_next;
+    }
+
+    return res;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
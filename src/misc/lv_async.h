@@ -29,6 +29,11 @@ extern "C" {
  */
 typedef void (*lv_async_cb_t)(void *);
 
+/**
+ * Type for selecting asynchronous calls by their user data.
+ */
+typedef bool (*lv_async_filter_cb_t)(void * user_data, void * filter_data);
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -50,6 +55,16 @@ lv_result_t lv_async_call(lv_async_cb_t async_xcb, void * user_data);
  */
 lv_result_t lv_async_call_cancel(lv_async_cb_t async_xcb, void * user_data);
 
+/**
+ * Cancel the asynchronous calls of a function whose user data is selected by a callback.
+ * The timer list is walked only once regardless of how many calls are canceled.
+ * @param async_xcb     a callback which is the task itself.
+ * @param filter_cb     called with the user data of each call. Return `true` to cancel the call.
+ * @param filter_data   passed to `filter_cb`
+ * @return              LV_RESULT_OK: at least 1 call was canceled
+ */
+lv_result_t lv_async_call_cancel_filtered(lv_async_cb_t async_xcb, lv_async_filter_cb_t filter_cb, void * filter_data);
+
 /**********************
  *      MACROS
  **********************/
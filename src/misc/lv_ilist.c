@@ -0,0 +1,106 @@
+/**
+ * @file lv_ilist.c
+ * Handle intrusive linked lists.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_ilist.h"
+#include "lv_assert.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static inline lv_ilist_link_t * get_link(const lv_ilist_t * list, void * item);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_ilist_init(lv_ilist_t * list, uint32_t link_ofs)
+{
+    LV_ASSERT_NULL(list);
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->link_ofs = link_ofs;
+}
+
+void lv_ilist_ins_head(lv_ilist_t * list, void * item)
+{
+    LV_ASSERT_NULL(item);
+
+    lv_ilist_link_t * link = get_link(list, item);
+    link->prev = NULL;
+    link->next = list->head;
+
+    if(list->head) get_link(list, list->head)->prev = item;
+    else list->tail = item;
+
+    list->head = item;
+}
+
+void lv_ilist_ins_tail(lv_ilist_t * list, void * item)
+{
+    LV_ASSERT_NULL(item);
+
+    lv_ilist_link_t * link = get_link(list, item);
+    link->prev = list->tail;
+    link->next = NULL;
+
+    if(list->tail) get_link(list, list->tail)->next = item;
+    else list->head = item;
+
+    list->tail = item;
+}
+
+void lv_ilist_remove(lv_ilist_t * list, void * item)
+{
+    LV_ASSERT_NULL(item);
+
+    lv_ilist_link_t * link = get_link(list, item);
+
+    if(link->prev) get_link(list, link->prev)->next = link->next;
+    else list->head = link->next;
+
+    if(link->next) get_link(list, link->next)->prev = link->prev;
+    else list->tail = link->prev;
+
+    link->prev = NULL;
+    link->next = NULL;
+}
+
+uint32_t lv_ilist_get_len(const lv_ilist_t * list)
+{
+    uint32_t len = 0;
+    void * item;
+    LV_ILIST_READ(list, item) len++;
+
+    return len;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static inline lv_ilist_link_t * get_link(const lv_ilist_t * list, void * item)
+{
+    return (lv_ilist_link_t *)((uint8_t *)item + list->link_ofs);
+}
@@ -0,0 +1,143 @@
+/**
+ * @file lv_ilist.h
+ * Handle intrusive linked lists. The links are fields of the items so the list doesn't allocate memory.
+ */
+
+#ifndef LV_ILIST_H
+#define LV_ILIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** The links of an item. It needs to be a field of the items.*/
+typedef struct {
+    void * prev;
+    void * next;
+} lv_ilist_link_t;
+
+/** Description of an intrusive linked list*/
+typedef struct {
+    void * head;
+    void * tail;
+    uint32_t link_ofs;      /**< Offset of the `lv_ilist_link_t` field in the items*/
+} lv_ilist_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize an intrusive linked list
+ * @param list          pointer to an `lv_ilist_t` variable
+ * @param link_ofs      offset of the `lv_ilist_link_t` field in the items, e.g. `offsetof(my_item_t, link)`
+ */
+void lv_ilist_init(lv_ilist_t * list, uint32_t link_ofs);
+
+/**
+ * Add an item as the new head of a list
+ * @param list          pointer to a list
+ * @param item          pointer to an item which is not in any list
+ */
+void lv_ilist_ins_head(lv_ilist_t * list, void * item);
+
+/**
+ * Add an item as the new tail of a list
+ * @param list          pointer to a list
+ * @param item          pointer to an item which is not in any list
+ */
+void lv_ilist_ins_tail(lv_ilist_t * list, void * item);
+
+/**
+ * Remove an item from a list. The item is not freed.
+ * @param list          pointer to a list
+ * @param item          pointer to an item of `list`
+ */
+void lv_ilist_remove(lv_ilist_t * list, void * item);
+
+/**
+ * Get the number of items in a list
+ * @param list          pointer to a list
+ * @return              number of items
+ */
+uint32_t lv_ilist_get_len(const lv_ilist_t * list);
+
+/**
+ * Get the first item of a list
+ * @param list          pointer to a list
+ * @return              the head or NULL if the list is empty
+ */
+static inline void * lv_ilist_get_head(const lv_ilist_t * list)
+{
+    return list->head;
+}
+
+/**
+ * Get the last item of a list
+ * @param list          pointer to a list
+ * @return              the tail or NULL if the list is empty
+ */
+static inline void * lv_ilist_get_tail(const lv_ilist_t * list)
+{
+    return list->tail;
+}
+
+/**
+ * Get the item after an item
+ * @param list          pointer to a list
+ * @param item          pointer to an item of `list`
+ * @return              the next item or NULL if `item` is the tail
+ */
+static inline void * lv_ilist_get_next(const lv_ilist_t * list, const void * item)
+{
+    return ((const lv_ilist_link_t *)((const uint8_t *)item + list->link_ofs))->next;
+}
+
+/**
+ * Get the item before an item
+ * @param list          pointer to a list
+ * @param item          pointer to an item of `list`
+ * @return              the previous item or NULL if `item` is the head
+ */
+static inline void * lv_ilist_get_prev(const lv_ilist_t * list, const void * item)
+{
+    return ((const lv_ilist_link_t *)((const uint8_t *)item + list->link_ofs))->prev;
+}
+
+/**
+ * Check if a list is empty
+ * @param list          pointer to a list
+ * @return              true: the list is empty; false: not empty
+ */
+static inline bool lv_ilist_is_empty(const lv_ilist_t * list)
+{
+    return list->head == NULL;
+}
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define LV_ILIST_READ(list, i) for(i = lv_ilist_get_head(list); i != NULL; i = lv_ilist_get_next(list, i))
+
+#define LV_ILIST_READ_BACK(list, i) for(i = lv_ilist_get_tail(list); i != NULL; i = lv_ilist_get_prev(list, i))
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_ILIST_H*/
@@ -0,0 +1,163 @@
+/**
+ * @file lv_slab.c
+ * Allocate items of the same size from larger chunks of memory.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_slab.h"
+#include "lv_assert.h"
+#include "lv_math.h"
+#include "../stdlib/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Each item is preceded by a pointer to its chunk to find the chunk when the item is freed*/
+#define ITEM_HEADER_SIZE    LV_ALIGN_UP(sizeof(slab_chunk_t *), 8)
+#define CHUNK_HEADER_SIZE   LV_ALIGN_UP(sizeof(slab_chunk_t), 8)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Header of a chunk. It's followed by the items.*/
+typedef struct {
+    lv_slab_t * slab;
+    void * free_head;       /*Singly linked list of the free items of the chunk*/
+    uint32_t used_cnt;
+} slab_chunk_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static slab_chunk_t * chunk_create(lv_slab_t * slab);
+static inline uint32_t get_item_stride(const lv_slab_t * slab);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_slab_init(lv_slab_t * slab, uint32_t item_size, uint32_t chunk_size)
+{
+    LV_ASSERT_NULL(slab);
+
+    slab->item_size = LV_ALIGN_UP(LV_MAX(item_size, sizeof(void *)), 8);
+    slab->item_cnt = chunk_size > CHUNK_HEADER_SIZE ? (chunk_size - CHUNK_HEADER_SIZE) / get_item_stride(slab) : 0;
+    if(slab->item_cnt == 0) slab->item_cnt = 1;
+    slab->chunk_cnt = 0;
+    slab->used_cnt = 0;
+
+    lv_ll_init(&slab->chunk_ll, CHUNK_HEADER_SIZE + slab->item_cnt * get_item_stride(slab));
+}
+
+void lv_slab_deinit(lv_slab_t * slab)
+{
+    LV_ASSERT_NULL(slab);
+
+    lv_ll_clear(&slab->chunk_ll);
+    slab->chunk_cnt = 0;
+    slab->used_cnt = 0;
+}
+
+void * lv_slab_alloc(lv_slab_t * slab)
+{
+    LV_ASSERT_NULL(slab);
+
+    /*The chunks with free items are at the beginning of the list*/
+    slab_chunk_t * chunk = lv_ll_get_head(&slab->chunk_ll);
+    if(chunk == NULL || chunk->free_head == NULL) {
+        chunk = chunk_create(slab);
+        if(chunk == NULL) return NULL;
+    }
+
+    uint8_t * item = chunk->free_head;
+    chunk->free_head = *(void **)item;
+    chunk->used_cnt++;
+    slab->used_cnt++;
+
+    /*Move the full chunks to the end to find a free item in the head right away*/
+    if(chunk->free_head == NULL) lv_ll_move_before(&slab->chunk_ll, chunk, NULL);
+
+    return item;
+}
+
+void lv_slab_free(void * item)
+{
+    if(item == NULL) return;
+
+    slab_chunk_t * chunk = *(slab_chunk_t **)((uint8_t *)item - ITEM_HEADER_SIZE);
+    lv_slab_t * slab = chunk->slab;
+
+    bool was_full = chunk->free_head == NULL;
+    *(void **)item = chunk->free_head;
+    chunk->free_head = item;
+    chunk->used_cnt--;
+    slab->used_cnt--;
+
+    if(chunk->used_cnt == 0) {
+        lv_ll_remove(&slab->chunk_ll, chunk);
+        lv_free(chunk);
+        slab->chunk_cnt--;
+    }
+    else if(was_full) {
+        lv_ll_move_before(&slab->chunk_ll, chunk, lv_ll_get_head(&slab->chunk_ll));
+    }
+}
+
+size_t lv_slab_get_size(const lv_slab_t * slab)
+{
+    LV_ASSERT_NULL(slab);
+
+    return (size_t)slab->chunk_cnt * slab->chunk_ll.n_size;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Allocate a new chunk, link its items into its free list and add it to the head of the chunk list
+ * @param slab      pointer to a slab allocator
+ * @return          the new chunk or NULL on failure
+ */
+static slab_chunk_t * chunk_create(lv_slab_t * slab)
+{
+    slab_chunk_t * chunk = lv_ll_ins_head(&slab->chunk_ll);
+    LV_ASSERT_MALLOC(chunk);
+    if(chunk == NULL) return NULL;
+
+    chunk->slab = slab;
+    chunk->used_cnt = 0;
+    chunk->free_head = NULL;
+
+    uint32_t stride = get_item_stride(slab);
+    uint8_t * slot = (uint8_t *)chunk + CHUNK_HEADER_SIZE + (slab->item_cnt - 1) * stride;
+    uint32_t i;
+    for(i = 0; i < slab->item_cnt; i++) {
+        *(slab_chunk_t **)slot = chunk;
+        uint8_t * item = slot + ITEM_HEADER_SIZE;
+        *(void **)item = chunk->free_head;
+        chunk->free_head = item;
+        slot -= stride;
+    }
+
+    slab->chunk_cnt++;
+    return chunk;
+}
+
+static inline uint32_t get_item_stride(const lv_slab_t * slab)
+{
+    return ITEM_HEADER_SIZE + slab->item_size;
+}
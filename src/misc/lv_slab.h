@@ -0,0 +1,84 @@
+/**
+ * @file lv_slab.h
+ * Allocate items of the same size from larger chunks of memory.
+ * The chunks are allocated by the 'lv_mem' module and freed when all of their items are freed.
+ */
+
+#ifndef LV_SLAB_H
+#define LV_SLAB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "lv_types.h"
+#include "lv_ll.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Description of a slab allocator*/
+typedef struct {
+    lv_ll_t chunk_ll;       /**< The chunks. The ones with free items are before the full ones.*/
+    uint32_t item_size;     /**< Size of an item in bytes*/
+    uint32_t item_cnt;      /**< Number of items in a chunk*/
+    uint32_t chunk_cnt;     /**< Number of allocated chunks*/
+    uint32_t used_cnt;      /**< Number of allocated items in all chunks*/
+} lv_slab_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize a slab allocator
+ * @param slab          pointer to an `lv_slab_t` variable
+ * @param item_size     size of an item in bytes
+ * @param chunk_size    size of the chunks in bytes. They will contain at least one item.
+ */
+void lv_slab_init(lv_slab_t * slab, uint32_t item_size, uint32_t chunk_size);
+
+/**
+ * Free all chunks of a slab allocator. The items allocated from it become invalid.
+ * @param slab          pointer to a slab allocator
+ */
+void lv_slab_deinit(lv_slab_t * slab);
+
+/**
+ * Allocate an item
+ * @param slab          pointer to a slab allocator
+ * @return              pointer to the uninitialized item, or NULL on failure
+ */
+void * lv_slab_alloc(lv_slab_t * slab);
+
+/**
+ * Free an item. Its chunk is also freed if it has no more allocated items.
+ * @param item          pointer to an item allocated by `lv_slab_alloc()`
+ */
+void lv_slab_free(void * item);
+
+/**
+ * Get the size of the memory allocated for the chunks of a slab allocator
+ * @param slab          pointer to a slab allocator
+ * @return              size in bytes
+ */
+size_t lv_slab_get_size(const lv_slab_t * slab);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_SLAB_H*/
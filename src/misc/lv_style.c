@@ -13,6 +13,14 @@
 #include "lv_assert.h"
 #include "lv_types.h"
 
+#if LV_USE_STYLE_SIMD && defined(__GNUC__)
+    #if defined(__AVX2__) || defined(__SSE2__)
+        #include <immintrin.h>
+    #elif defined(__ARM_NEON)
+        #include <arm_neon.h>
+    #endif
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -20,6 +28,19 @@
 #define lv_style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define last_custom_prop_id LV_GLOBAL_DEFAULT()->style_last_custom_prop_id
 
+/*Number of property IDs compared at once by the SIMD search. 1 if they are compared one by one.
+ *It depends only on how LVGL is compiled as only this file reads the padding.*/
+#if LV_USE_STYLE_SIMD && defined(__GNUC__) && defined(__AVX2__)
+    #define PROPS_SIMD_WIDTH    32
+#elif LV_USE_STYLE_SIMD && defined(__GNUC__) && (defined(__SSE2__) || defined(__ARM_NEON))
+    #define PROPS_SIMD_WIDTH    16
+#else
+    #define PROPS_SIMD_WIDTH    1
+#endif
+
+/*Size of the property IDs of a non-constant style with padding for the SIMD search*/
+#define PROPS_SIZE(cnt) LV_ALIGN_UP((size_t)(cnt), PROPS_SIMD_WIDTH)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -27,6 +48,13 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static int32_t find_prop_index(const lv_style_t * style, lv_style_prop_t prop);
+#if PROPS_SIMD_WIDTH > 1
+    static int32_t find_prop_simd(const lv_style_prop_t * props, uint32_t cnt, lv_style_prop_t prop);
+#endif
+static void sort_props(lv_style_prop_t * props, lv_style_value_t * values, uint32_t cnt);
+static bool set_table_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value);
+static void table_to_props(lv_style_t * style);
 
 /**********************
  *  GLOBAL VARIABLES
@@ -195,11 +223,26 @@ void lv_style_init(lv_style_t * style)
 #endif
 }
 
+void lv_style_init_table(lv_style_t * style, const lv_style_prop_table_t * prop_table)
+{
+    lv_style_init(style);
+
+    /*The values follow the header in the same allocation*/
+    size_t size = sizeof(lv_style_table_t) + prop_table->prop_cnt * sizeof(lv_style_value_t);
+    lv_style_table_t * table = lv_malloc_zeroed(size);
+    LV_ASSERT_MALLOC(table);
+    if(table == NULL) return;
+
+    table->prop_table = prop_table;
+    style->values_and_props = table;
+    style->prop_cnt = LV_STYLE_PROP_TABLE;
+}
+
 void lv_style_reset(lv_style_t * style)
 {
     LV_ASSERT_STYLE(style);
 
-    if(style->prop_cnt != 255) lv_free(style->values_and_props);
+    if(!lv_style_is_const(style)) lv_free(style->values_and_props);
     lv_memzero(style, sizeof(lv_style_t));
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
@@ -239,11 +282,19 @@ void lv_style_merge(lv_style_t * dst, const lv_style_t * src)
     /* Merge the styles */
     int32_t i;
     if(lv_style_is_const(src)) {
-        lv_style_const_prop_t * props_and_values = (lv_style_const_prop_t *)src->values_and_props;
+        const lv_style_const_prop_t * props_and_values = lv_style_get_const_props(src);
         for(i = 0; props_and_values[i].prop != LV_STYLE_PROP_INV; i++) {
             lv_style_set_prop(dst, props_and_values[i].prop, props_and_values[i].value);
         }
     }
+    else if(src->prop_cnt == LV_STYLE_PROP_TABLE) {
+        const lv_style_table_t * table = src->values_and_props;
+        const lv_style_value_t * values = (const lv_style_value_t *)(table + 1);
+        for(i = 0; i < table->prop_table->prop_cnt; i++) {
+            lv_style_prop_t prop = table->prop_table->props[i];
+            if(lv_style_table_has_prop(table, prop)) lv_style_set_prop(dst, prop, values[i]);
+        }
+    }
     else {
         lv_style_prop_t * props = (lv_style_prop_t *)src->values_and_props + src->prop_cnt * sizeof(lv_style_value_t);
         lv_style_value_t * values = (lv_style_value_t *)src->values_and_props;
@@ -300,46 +351,53 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
 
     if(style->prop_cnt == 0)  return false;
 
+    if(style->prop_cnt == LV_STYLE_PROP_TABLE) {
+        lv_style_table_t * table = style->values_and_props;
+        if(!lv_style_table_has_prop(table, prop)) return false;
+        table->prop_bitmap[prop >> 5] &= ~((uint32_t)1 << (prop & 0x1F));
+        return true;
+    }
+
     LV_PROFILER_STYLE_BEGIN;
 
+    if(find_prop_index(style, prop) < 0) {
+        LV_PROFILER_STYLE_END;
+        return false;
+    }
+
     uint8_t * tmp = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
     uint8_t * old_props = (uint8_t *)tmp;
+    lv_style_value_t * old_values = (lv_style_value_t *)style->values_and_props;
+
+    size_t size = (style->prop_cnt - 1) * sizeof(lv_style_value_t) + PROPS_SIZE(style->prop_cnt - 1);
+    uint8_t * new_values_and_props = lv_malloc(size);
+    if(new_values_and_props == NULL) {
+        LV_PROFILER_STYLE_END;
+        return false;
+    }
+
+    style->values_and_props = new_values_and_props;
+    style->prop_cnt--;
+
+    tmp = new_values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+    uint8_t * new_props = (uint8_t *)tmp;
+    lv_style_value_t * new_values = (lv_style_value_t *)new_values_and_props;
+
+    /*Keep the order of the other properties as the large styles are sorted*/
     uint32_t i;
-    for(i = 0; i < style->prop_cnt; i++) {
-        if(old_props[i] == prop) {
-            lv_style_value_t * old_values = (lv_style_value_t *)style->values_and_props;
-
-            size_t size = (style->prop_cnt - 1) * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
-            uint8_t * new_values_and_props = lv_malloc(size);
-            if(new_values_and_props == NULL) {
-                LV_PROFILER_STYLE_END;
-                return false;
-            }
-
-            style->values_and_props = new_values_and_props;
-            style->prop_cnt--;
-
-            tmp = new_values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-            uint8_t * new_props = (uint8_t *)tmp;
-            lv_style_value_t * new_values = (lv_style_value_t *)new_values_and_props;
-
-            uint32_t j;
-            for(i = j = 0; j <= style->prop_cnt;
-                j++) { /*<=: because prop_cnt already reduced but all the old props. needs to be checked.*/
-                if(old_props[j] != prop) {
-                    new_values[i] = old_values[j];
-                    new_props[i++] = old_props[j];
-                }
-            }
-
-            lv_free(old_values);
-            LV_PROFILER_STYLE_END;
-            return true;
+    uint32_t j;
+    for(i = j = 0; j <= style->prop_cnt;
+        j++) { /*<=: because prop_cnt already reduced but all the old props. needs to be checked.*/
+        if(old_props[j] != prop) {
+            new_values[i] = old_values[j];
+            new_props[i++] = old_props[j];
         }
     }
+    lv_memzero(new_props + style->prop_cnt, PROPS_SIZE(style->prop_cnt) - style->prop_cnt);
 
+    lv_free(old_values);
     LV_PROFILER_STYLE_END;
-    return false;
+    return true;
 }
 
 void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value)
@@ -352,23 +410,35 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
     }
 
     LV_ASSERT(prop != LV_STYLE_PROP_INV);
+
+    if(style->prop_cnt == LV_STYLE_PROP_TABLE) {
+        if(set_table_prop(style, prop, value)) return;
+
+        /*The property is not in the table, so store all properties in the normal way from now on*/
+        table_to_props(style);
+    }
+
     LV_PROFILER_STYLE_BEGIN;
     lv_style_prop_t * props;
     int32_t i;
 
     if(style->values_and_props) {
-        props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-        for(i = style->prop_cnt - 1; i >= 0; i--) {
-            if(props[i] == prop) {
-                lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
-                values[i] = value;
-                LV_PROFILER_STYLE_END;
-                return;
-            }
+        i = find_prop_index(style, prop);
+        if(i >= 0) {
+            lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
+            values[i] = value;
+            LV_PROFILER_STYLE_END;
+            return;
         }
     }
 
-    size_t size = (style->prop_cnt + 1) * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
+    if(style->prop_cnt >= LV_STYLE_PROP_CNT_MAX) {
+        LV_LOG_WARN("Too many properties in the style");
+        LV_PROFILER_STYLE_END;
+        return;
+    }
+
+    size_t size = (style->prop_cnt + 1) * sizeof(lv_style_value_t) + PROPS_SIZE(style->prop_cnt + 1);
     uint8_t * values_and_props = lv_realloc(style->values_and_props, size);
     if(values_and_props == NULL) {
         LV_PROFILER_STYLE_END;
@@ -387,10 +457,24 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
     /*Go to the new position with the props*/
     props = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
     lv_style_value_t * values = (lv_style_value_t *)values_and_props;
+    lv_memzero(props + style->prop_cnt, PROPS_SIZE(style->prop_cnt) - style->prop_cnt);
+
+    /*Large styles are kept sorted, so sort the style when it becomes large
+     *and insert the new property to its place*/
+    i = style->prop_cnt - 1;
+    if(style->prop_cnt > LV_STYLE_SORTED_PROP_CNT_MIN) {
+        if(style->prop_cnt == LV_STYLE_SORTED_PROP_CNT_MIN + 1) sort_props(props, values, (uint32_t)i);
+
+        while(i > 0 && props[i - 1] > prop) {
+            props[i] = props[i - 1];
+            values[i] = values[i - 1];
+            i--;
+        }
+    }
 
     /*Set the new property and value*/
-    props[style->prop_cnt - 1] = prop;
-    values[style->prop_cnt - 1] = value;
+    props[i] = prop;
+    values[i] = value;
 
     uint32_t group = lv_style_get_prop_group(prop);
     style->has_group |= (uint32_t)1 << group;
@@ -500,6 +584,15 @@ bool lv_style_is_empty(const lv_style_t * style)
 {
     LV_ASSERT_STYLE(style);
 
+    if(style->prop_cnt == LV_STYLE_PROP_TABLE) {
+        const lv_style_table_t * table = style->values_and_props;
+        uint32_t i;
+        for(i = 0; i < LV_STYLE_PROP_BITMAP_SIZE; i++) {
+            if(table->prop_bitmap[i]) return false;
+        }
+        return true;
+    }
+
     return style->prop_cnt == 0;
 }
 
@@ -516,6 +609,155 @@ uint8_t lv_style_prop_lookup_flags(lv_style_prop_t prop)
     return 0;
 }
 
+#if LV_USE_STYLE_SIMD
+int32_t lv_style_find_prop_index(const lv_style_t * style, lv_style_prop_t prop)
+{
+    return find_prop_index(style, prop);
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+/**
+ * Find the index of a property in a non-constant style.
+ * @param style     pointer to a non-constant style
+ * @param prop      the property to find
+ * @return          the index of the property or -1 if not found
+ */
+static int32_t find_prop_index(const lv_style_t * style, lv_style_prop_t prop)
+{
+    lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+#if PROPS_SIMD_WIDTH > 1
+    return find_prop_simd(props, style->prop_cnt, prop);
+#else
+    if(style->prop_cnt > LV_STYLE_SORTED_PROP_CNT_MIN) {
+        int32_t left = 0;
+        int32_t right = style->prop_cnt;
+        while(left < right) {
+            int32_t mid = (left + right) >> 1;
+            if(props[mid] < prop) left = mid + 1;
+            else right = mid;
+        }
+        return (left < style->prop_cnt && props[left] == prop) ? left : -1;
+    }
+
+    int32_t i;
+    for(i = style->prop_cnt - 1; i >= 0; i--) {
+        if(props[i] == prop) return i;
+    }
+
+    return -1;
+#endif
+}
+
+#if PROPS_SIMD_WIDTH > 1
+/**
+ * Find a property ID by comparing `PROPS_SIMD_WIDTH` IDs at once
+ * @param props     the property IDs of a non-constant style, padded to `PROPS_SIMD_WIDTH`
+ * @param cnt       number of property IDs
+ * @param prop      the property ID to find
+ * @return          the index of the property or -1 if not found
+ */
+static int32_t find_prop_simd(const lv_style_prop_t * props, uint32_t cnt, lv_style_prop_t prop)
+{
+#if defined(__AVX2__)
+    const __m256i needle = _mm256_set1_epi8((char)prop);
+#elif defined(__SSE2__)
+    const __m128i needle = _mm_set1_epi8((char)prop);
+#else
+    const uint8x16_t needle = vdupq_n_u8(prop);
+#endif
+
+    uint32_t i;
+    for(i = 0; i < cnt; i += PROPS_SIMD_WIDTH) {
+#if defined(__AVX2__)
+        __m256i ids = _mm256_loadu_si256((const __m256i *)(props + i));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(ids, needle));
+        uint32_t index = i + (mask ? (uint32_t)__builtin_ctz(mask) : PROPS_SIMD_WIDTH);
+#elif defined(__SSE2__)
+        __m128i ids = _mm_loadu_si128((const __m128i *)(props + i));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ids, needle));
+        uint32_t index = i + (mask ? (uint32_t)__builtin_ctz(mask) : PROPS_SIMD_WIDTH);
+#else
+        /*NEON has no movemask, so narrow the 0x00/0xFF bytes to 4 bit per ID*/
+        uint8x16_t eq = vceqq_u8(vld1q_u8(props + i), needle);
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+        uint32_t index = i + (mask ? (uint32_t)__builtin_ctzll(mask) / 4 : PROPS_SIMD_WIDTH);
+#endif
+        /*The first match can be in the padding only if the ID is not in the style*/
+        if(index < i + PROPS_SIMD_WIDTH) return index < cnt ? (int32_t)index : -1;
+    }
+
+    return -1;
+}
+#endif
+
+/**
+ * Sort the properties and the related values of a style by the property IDs.
+ * @param props     the property IDs
+ * @param values    the values
+ * @param cnt       number of properties. Should be small as insertion sort is used.
+ */
+static void sort_props(lv_style_prop_t * props, lv_style_value_t * values, uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 1; i < cnt; i++) {
+        lv_style_prop_t prop = props[i];
+        lv_style_value_t value = values[i];
+        uint32_t j = i;
+        while(j > 0 && props[j - 1] > prop) {
+            props[j] = props[j - 1];
+            values[j] = values[j - 1];
+            j--;
+        }
+        props[j] = prop;
+        values[j] = value;
+    }
+}
+
+/**
+ * Set a property in a style initialized by `lv_style_init_table`.
+ * @param style     pointer to a style with a property table
+ * @param prop      the property to set
+ * @param value     the new value
+ * @return          true: the property was set; false: the property is not in the property table of the style
+ */
+static bool set_table_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value)
+{
+    lv_style_table_t * table = style->values_and_props;
+    uint32_t index = prop < LV_STYLE_NUM_BUILT_IN_PROPS ? table->prop_table->prop_index[prop] : 0;
+    if(index == 0) return false;
+
+    lv_style_value_t * values = (lv_style_value_t *)(table + 1);
+    values[index - 1] = value;
+    table->prop_bitmap[prop >> 5] |= (uint32_t)1 << (prop & 0x1F);
+
+    uint32_t group = lv_style_get_prop_group(prop);
+    style->has_group |= (uint32_t)1 << group;
+    return true;
+}
+
+/**
+ * Convert a style initialized by `lv_style_init_table` to a normal style with the same properties
+ * @param style     pointer to a style with a property table
+ */
+static void table_to_props(lv_style_t * style)
+{
+    LV_LOG_INFO("Property not in the property table of the style, converting it to a normal style");
+
+    lv_style_table_t * table = style->values_and_props;
+    const lv_style_value_t * values = (const lv_style_value_t *)(table + 1);
+
+    style->values_and_props = NULL;
+    style->prop_cnt = 0;
+
+    uint32_t i;
+    for(i = 0; i < table->prop_table->prop_cnt; i++) {
+        lv_style_prop_t prop = table->prop_table->props[i];
+        if(lv_style_table_has_prop(table, prop)) lv_style_set_prop(style, prop, values[i]);
+    }
+
+    lv_free(table);
+}
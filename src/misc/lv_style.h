@@ -30,6 +30,12 @@ extern "C" {
 
 #define LV_STYLE_SENTINEL_VALUE     0xAABBCCDD
 
+/**
+ * Maximum number of properties in a non-constant style.
+ * The larger values of `lv_style_t::prop_cnt` mark the special styles.
+ */
+#define LV_STYLE_PROP_CNT_MAX       (LV_STYLE_PROP_TABLE - 1)
+
 /*
  * Flags for style behavior
  */
@@ -67,8 +73,35 @@ LV_EXPORT_CONST_INT(LV_SCALE_NONE);
 #endif
 // *INDENT-ON*
 
+/**
+ * Create a constant style whose properties are found by a precomputed property table.
+ * `prop_table` is a `lv_style_prop_table_t` generated from a `lv_style_const_prop_t` array
+ * by `scripts/style_table_gen.py`.
+ */
+// *INDENT-OFF*
+#if LV_USE_ASSERT_STYLE
+#define LV_STYLE_CONST_TABLE_INIT(var_name, prop_table)                 \
+    const lv_style_t var_name = {                                       \
+        .sentinel = LV_STYLE_SENTINEL_VALUE,                            \
+        .values_and_props = (void*)&prop_table,                         \
+        .has_group = 0xFFFFFFFF,                                        \
+        .prop_cnt = LV_STYLE_PROP_CONST_TABLE                           \
+    }
+#else
+#define LV_STYLE_CONST_TABLE_INIT(var_name, prop_table)                 \
+    const lv_style_t var_name = {                                       \
+        .values_and_props = (void*)&prop_table,                         \
+        .has_group = 0xFFFFFFFF,                                        \
+        .prop_cnt = LV_STYLE_PROP_CONST_TABLE,                          \
+    }
+#endif
+// *INDENT-ON*
+
 #define LV_STYLE_CONST_PROPS_END { .prop = LV_STYLE_PROP_INV, .value = { .num = 0 } }
 
+/** Number of 32-bit words in a bitmap having a bit for each built-in property*/
+#define LV_STYLE_PROP_BITMAP_SIZE   ((LV_STYLE_NUM_BUILT_IN_PROPS + 31) / 32)
+
 #if LV_GRADIENT_MAX_STOPS < 2
 #error LVGL needs at least 2 stops for gradients. Please increase the LV_GRADIENT_MAX_STOPS
 #endif
@@ -338,7 +371,9 @@ enum _lv_style_id_t {
     LV_STYLE_NUM_BUILT_IN_PROPS     = LV_STYLE_LAST_BUILT_IN_PROP + 1,
 
     LV_STYLE_PROP_ANY                = 0xFF,
-    LV_STYLE_PROP_CONST             = 0xFF /* magic value for const styles */
+    LV_STYLE_PROP_CONST             = 0xFF, /* magic value for const styles */
+    LV_STYLE_PROP_CONST_TABLE       = 0xFE, /* magic value for const styles with a property table */
+    LV_STYLE_PROP_TABLE             = 0xFD  /* magic value for styles with a property table */
 };
 
 typedef enum {
@@ -365,6 +400,26 @@ typedef struct {
     lv_style_value_t value;
 } lv_style_const_prop_t;
 
+/**
+ * Precomputed table of the properties a style can have. Generated by `scripts/style_table_gen.py`.
+ */
+typedef struct {
+    const lv_style_prop_t * props;              /**< The properties in the order of their values*/
+    const lv_style_const_prop_t * const_props;  /**< The properties and values of a constant style or NULL*/
+    uint8_t prop_cnt;                           /**< Number of properties in `props`*/
+    uint8_t prop_index[LV_STYLE_NUM_BUILT_IN_PROPS]; /**< 1 + the index of the value of each property,
+                                                      *   0 if the property is not in the table*/
+} lv_style_prop_table_t;
+
+/**
+ * Data of a style initialized by ::lv_style_init_table.
+ * The values of the properties in the order of `prop_table` follow this header.
+ */
+typedef struct {
+    const lv_style_prop_table_t * prop_table;
+    uint32_t prop_bitmap[LV_STYLE_PROP_BITMAP_SIZE];    /**< Bit `n` is set if the property with ID `n` is set*/
+} lv_style_table_t;
+
 /**
  * Descriptor of a style (a collection of properties and values).
  */
@@ -377,7 +432,8 @@ typedef struct {
     void * values_and_props;
 
     uint32_t has_group;
-    uint8_t prop_cnt;   /**< 255 means it's a constant style*/
+    uint8_t prop_cnt;   /**< `LV_STYLE_PROP_CONST`, `LV_STYLE_PROP_CONST_TABLE` and `LV_STYLE_PROP_TABLE`
+                         *   mean special styles, otherwise the number of properties*/
 } lv_style_t;
 
 /**********************
@@ -393,6 +449,17 @@ typedef struct {
  */
 void lv_style_init(lv_style_t * style);
 
+/**
+ * Initialize a style whose properties are found by a precomputed property table.
+ * Only the properties of the table can be set in the style. Looking up a property
+ * is a bit test if it's not set, and an index and value load if it's set.
+ * @param style         pointer to a style to initialize
+ * @param prop_table    table of the properties the style can have.
+ *                      Generated by `scripts/style_table_gen.py`. Only the pointer is saved.
+ * @note Use ::lv_style_reset to free the style
+ */
+void lv_style_init_table(lv_style_t * style, const lv_style_prop_table_t * prop_table);
+
 /**
  * Clear all properties from a style and free all allocated memories.
  * @param style pointer to a style
@@ -433,10 +500,35 @@ void lv_style_merge(lv_style_t * dst, const lv_style_t * src);
  */
 static inline bool lv_style_is_const(const lv_style_t * style)
 {
-    if(style->prop_cnt == 255) return true;
+    if(style->prop_cnt == LV_STYLE_PROP_CONST || style->prop_cnt == LV_STYLE_PROP_CONST_TABLE) return true;
     return false;
 }
 
+/**
+ * Get the properties of a constant style
+ * @param style     pointer to a constant style
+ * @return          the properties and values terminated by `LV_STYLE_CONST_PROPS_END`
+ */
+static inline const lv_style_const_prop_t * lv_style_get_const_props(const lv_style_t * style)
+{
+    if(style->prop_cnt == LV_STYLE_PROP_CONST_TABLE) {
+        return ((const lv_style_prop_table_t *)style->values_and_props)->const_props;
+    }
+    return (const lv_style_const_prop_t *)style->values_and_props;
+}
+
+/**
+ * Check if a property is set in a style initialized by ::lv_style_init_table
+ * @param table     the data of the style
+ * @param prop      a property ID
+ * @return          true: the property is set
+ */
+static inline bool lv_style_table_has_prop(const lv_style_table_t * table, lv_style_prop_t prop)
+{
+    if(prop >= LV_STYLE_NUM_BUILT_IN_PROPS) return false;
+    return (table->prop_bitmap[prop >> 5] & ((uint32_t)1 << (prop & 0x1F))) != 0;
+}
+
 
 /**
  * Register a new style property for custom usage
@@ -516,6 +608,17 @@ void lv_style_transition_dsc_init(lv_style_transition_dsc_t * tr, const lv_style
  */
 lv_style_value_t lv_style_prop_get_default(lv_style_prop_t prop);
 
+#if LV_USE_STYLE_SIMD
+/**
+ * Find the index of a property in a non-constant style.
+ * It's not inlined as the SIMD instructions it uses depend on how LVGL was compiled.
+ * @param style     pointer to a non-constant style
+ * @param prop      the ID of a property
+ * @return          the index of the property or -1 if not found
+ */
+int32_t lv_style_find_prop_index(const lv_style_t * style, lv_style_prop_t prop);
+#endif
+
 /**
  * Get the value of a property
  * @param style pointer to a style
@@ -529,7 +632,7 @@ lv_style_value_t lv_style_prop_get_default(lv_style_prop_t prop);
 static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style, lv_style_prop_t prop,
                                                        lv_style_value_t * value)
 {
-    if(lv_style_is_const(style)) {
+    if(style->prop_cnt == LV_STYLE_PROP_CONST) {
         lv_style_const_prop_t * props = (lv_style_const_prop_t *)style->values_and_props;
         uint32_t i;
         for(i = 0; props[i].prop != LV_STYLE_PROP_INV; i++) {
@@ -539,6 +642,48 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
             }
         }
     }
+    else if(style->prop_cnt == LV_STYLE_PROP_TABLE) {
+        const lv_style_table_t * table = (const lv_style_table_t *)style->values_and_props;
+        if(lv_style_table_has_prop(table, prop)) {
+            const lv_style_value_t * values = (const lv_style_value_t *)(table + 1);
+            *value = values[table->prop_table->prop_index[prop] - 1];
+            return LV_STYLE_RES_FOUND;
+        }
+    }
+    else if(style->prop_cnt == LV_STYLE_PROP_CONST_TABLE) {
+        const lv_style_prop_table_t * prop_table = (const lv_style_prop_table_t *)style->values_and_props;
+        uint32_t index = prop < LV_STYLE_NUM_BUILT_IN_PROPS ? prop_table->prop_index[prop] : 0;
+        if(index) {
+            *value = prop_table->const_props[index - 1].value;
+            return LV_STYLE_RES_FOUND;
+        }
+    }
+#if LV_USE_STYLE_SIMD
+    else {
+        int32_t i = lv_style_find_prop_index(style, prop);
+        if(i >= 0) {
+            lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
+            *value = values[i];
+            return LV_STYLE_RES_FOUND;
+        }
+    }
+#else
+    else if(style->prop_cnt > LV_STYLE_SORTED_PROP_CNT_MIN) {
+        /*Large styles are sorted so look for the first property not less than `prop`*/
+        lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+        uint32_t left = 0;
+        uint32_t right = style->prop_cnt;
+        while(left < right) {
+            uint32_t mid = (left + right) >> 1;
+            if(props[mid] < prop) left = mid + 1;
+            else right = mid;
+        }
+        if(left < style->prop_cnt && props[left] == prop) {
+            lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
+            *value = values[left];
+            return LV_STYLE_RES_FOUND;
+        }
+    }
     else {
         lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         uint32_t i;
@@ -550,6 +695,7 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
             }
         }
     }
+#endif
     return LV_STYLE_RES_NOT_FOUND;
 }
 
@@ -10,8 +10,9 @@
 #include "../tick/lv_tick.h"
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_sprintf.h"
+#include "../stdlib/lv_string.h"
 #include "lv_assert.h"
-#include "lv_ll.h"
+#include "lv_math.h"
 #include "lv_profiler.h"
 
 /*********************
@@ -22,7 +23,7 @@
 #define DEF_PERIOD 500
 
 #define state LV_GLOBAL_DEFAULT()->timer_state
-#define timer_ll_p &(state.timer_ll)
+#define timer_list_p &(state.timer_list)
 
 /**********************
  *      TYPEDEFS
@@ -34,6 +35,17 @@
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+static lv_timer_t * timer_mem_alloc(void);
+static void timer_mem_free(lv_timer_t * timer);
+static void collect_ready_timers(void);
+static bool heap_reserve(uint32_t cnt);
+static void heap_shrink(void);
+static void heap_insert(lv_timer_heap_t * heap, lv_timer_t * timer);
+static void heap_remove(lv_timer_t * timer);
+static void heap_update(lv_timer_t * timer);
+static void heap_sift_up(lv_timer_heap_t * heap, uint32_t i, uint32_t now);
+static void heap_sift_down(lv_timer_heap_t * heap, uint32_t i, uint32_t now);
+static bool heap_is_before(const lv_timer_heap_t * heap, const lv_timer_t * a, const lv_timer_t * b, uint32_t now);
 
 /**********************
  *  STATIC VARIABLES
@@ -54,7 +66,10 @@ static void lv_timer_handler_resume(void);
 
 void lv_timer_core_init(void)
 {
-    lv_ll_init(timer_ll_p, sizeof(lv_timer_t));
+    lv_ilist_init(timer_list_p, offsetof(lv_timer_t, link));
+#if LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    lv_slab_init(&state.timer_pool, sizeof(lv_timer_t), LV_TIMER_ANIM_POOL_CHUNK_SIZE);
+#endif
 
     /*Initially enable the lv_timer handling*/
     lv_timer_enable(true);
@@ -90,44 +105,42 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    lv_timer_t * timer_active;
-    lv_ll_t * timer_head = timer_ll_p;
-    do {
-        state_p->timer_deleted             = false;
-        state_p->timer_created             = false;
-
-        timer_active = lv_ll_get_head(timer_head);
-        while(timer_active) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = lv_ll_get_next(timer_head, timer_active);
-
-            if(lv_timer_exec(timer_active)) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(state_p->timer_created || state_p->timer_deleted) {
-                    LV_TRACE_TIMER("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            timer_active = next; /*Load the next timer*/
-        }
-    } while(timer_active);
-
-    uint32_t time_until_next = LV_NO_TIMER_READY;
-    next = lv_ll_get_head(timer_head);
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_until_next)
-                time_until_next = delay;
+    /*Run the ready timers in the order of the timer list (the last created first)*/
+    state_p->timer_deleted             = false;
+    state_p->timer_created             = false;
+    collect_ready_timers();
+
+    lv_timer_heap_t * ready_heap = &state_p->ready_heap;
+    lv_timer_heap_t * waiting_heap = &state_p->waiting_heap;
+    while(ready_heap->cnt > 0) {
+        lv_timer_t * timer_active = ready_heap->timers[0];
+        heap_remove(timer_active);
+
+        state_p->timer_running = timer_active;
+        bool exec = lv_timer_exec(timer_active);
+
+        /*Wait for the next period unless it was deleted or paused.
+         *The paused timers are added again when resumed.*/
+        if(state_p->timer_running && !timer_active->paused) heap_insert(waiting_heap, timer_active);
+        state_p->timer_running = NULL;
+
+        /*If a timer was created or deleted check all timers again, including the ones executed already*/
+        if(exec && (state_p->timer_created || state_p->timer_deleted)) {
+            LV_TRACE_TIMER("Collect the ready timers again because a timer was created or deleted");
+            state_p->timer_deleted = false;
+            state_p->timer_created = false;
+            collect_ready_timers();
         }
+    }
 
-        next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
+    /*The next timer to run is on the top of the heap. Remove the paused timers from there first.*/
+    while(waiting_heap->cnt > 0 && waiting_heap->timers[0]->paused) {
+        heap_remove(waiting_heap->timers[0]);
     }
 
+    uint32_t time_until_next = LV_NO_TIMER_READY;
+    if(waiting_heap->cnt > 0) time_until_next = lv_timer_time_remaining(waiting_heap->timers[0]);
+
     state_p->busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(state_p->idle_period_start);
     if(idle_period_time >= IDLE_MEAS_PERIOD) {
@@ -166,10 +179,18 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
 {
     lv_timer_t * new_timer = NULL;
 
-    new_timer = lv_ll_ins_head(timer_ll_p);
+    /*Make room in the heaps first to not fail later when a timer moves between them*/
+    if(!heap_reserve(state.timer_cnt + 1)) {
+        LV_LOG_WARN("Couldn't allocate the heap of the timers");
+        return NULL;
+    }
+
+    new_timer = timer_mem_alloc();
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
 
+    lv_ilist_ins_head(timer_list_p, new_timer);
+
     new_timer->period = period;
     new_timer->timer_cb = timer_xcb;
     new_timer->repeat_count = -1;
@@ -177,11 +198,17 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
+    new_timer->id = state.timer_id;
+    new_timer->heap_index = LV_TIMER_HEAP_INDEX_NONE;
 #if LV_USE_EXT_DATA
     new_timer->ext_data.free_cb = NULL;
     new_timer->ext_data.data = NULL;
 #endif
 
+    state.timer_id++;
+    state.timer_cnt++;
+    heap_insert(&state.waiting_heap, new_timer);
+
     state.timer_created = true;
 
     lv_timer_handler_resume();
@@ -197,8 +224,13 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
-    lv_ll_remove(timer_ll_p, timer);
+    heap_remove(timer);
+    if(state.timer_running == timer) state.timer_running = NULL;
+
+    lv_ilist_remove(timer_list_p, timer);
+    state.timer_cnt--;
     state.timer_deleted = true;
+    heap_shrink();
 
 #if LV_USE_EXT_DATA
     if(timer->ext_data.free_cb) {
@@ -207,7 +239,7 @@ void lv_timer_delete(lv_timer_t * timer)
     }
 #endif
 
-    lv_free(timer);
+    timer_mem_free(timer);
 }
 
 void lv_timer_pause(lv_timer_t * timer)
@@ -220,6 +252,12 @@ void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+
+    /*The running timer is added to the heap when its callback returns*/
+    if(timer->heap_index == LV_TIMER_HEAP_INDEX_NONE && timer != state.timer_running) {
+        heap_insert(&state.waiting_heap, timer);
+    }
+
     lv_timer_handler_resume();
 }
 
@@ -227,6 +265,7 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+    heap_update(timer);
     lv_timer_handler_resume();
 }
 
@@ -234,6 +273,7 @@ void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+    heap_update(timer);
     lv_timer_handler_resume();
 }
 
@@ -241,6 +281,7 @@ void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     LV_ASSERT_NULL(timer);
     timer->repeat_count = repeat_count;
+    heap_update(timer);
 }
 
 void lv_timer_set_auto_delete(lv_timer_t * timer, bool auto_delete)
@@ -259,6 +300,7 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+    heap_update(timer);
     lv_timer_handler_resume();
 }
 
@@ -272,7 +314,23 @@ void lv_timer_core_deinit(void)
 {
     lv_timer_enable(false);
 
-    lv_ll_clear(timer_ll_p);
+    lv_timer_t * timer = lv_ilist_get_head(timer_list_p);
+    while(timer) {
+        lv_ilist_remove(timer_list_p, timer);
+        timer_mem_free(timer);
+        timer = lv_ilist_get_head(timer_list_p);
+    }
+#if LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    lv_slab_deinit(&state.timer_pool);
+#endif
+
+    lv_free(state.waiting_heap.timers);
+    lv_free(state.ready_heap.timers);
+    lv_memzero(&state.waiting_heap, sizeof(lv_timer_heap_t));
+    lv_memzero(&state.ready_heap, sizeof(lv_timer_heap_t));
+    state.heap_size = 0;
+    state.timer_cnt = 0;
+    state.timer_running = NULL;
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -287,8 +345,8 @@ uint32_t lv_timer_get_time_until_next(void)
 
 lv_timer_t * lv_timer_get_next(lv_timer_t * timer)
 {
-    if(timer == NULL) return lv_ll_get_head(timer_ll_p);
-    else return lv_ll_get_next(timer_ll_p, timer);
+    if(timer == NULL) return lv_ilist_get_head(timer_list_p);
+    else return lv_ilist_get_next(timer_list_p, timer);
 }
 
 LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler_run_in_period(uint32_t period)
@@ -407,8 +465,209 @@ static void lv_timer_handler_resume(void)
     }
 }
 
+static lv_timer_t * timer_mem_alloc(void)
+{
+#if LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    return lv_slab_alloc(&state.timer_pool);
+#else
+    return lv_malloc(sizeof(lv_timer_t));
+#endif
+}
+
+static void timer_mem_free(lv_timer_t * timer)
+{
+#if LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    lv_slab_free(timer);
+#else
+    lv_free(timer);
+#endif
+}
+
 void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data)
 {
     state.resume_cb = cb;
     state.resume_data = data;
 }
+
+/**
+ * Move the ready timers from the heap of the waiting timers to the heap of the ready ones
+ */
+static void collect_ready_timers(void)
+{
+    lv_timer_heap_t * waiting_heap = &state.waiting_heap;
+    while(waiting_heap->cnt > 0) {
+        lv_timer_t * timer = waiting_heap->timers[0];
+        bool paused = timer->paused;
+
+        /*Timers with no repeats left are handled immediately to delete or pause them*/
+        if(!paused && timer->repeat_count != 0 && lv_timer_time_remaining(timer) > 0) break;
+
+        heap_remove(timer);
+        if(!paused) heap_insert(&state.ready_heap, timer);
+    }
+}
+
+/**
+ * Make sure that both heaps can store a given number of timers
+ * @param cnt   the number of timers
+ * @return      true: success; false: out of memory
+ */
+static bool heap_reserve(uint32_t cnt)
+{
+    if(cnt <= state.heap_size) return true;
+
+    uint32_t size = LV_MAX(cnt, state.heap_size * 2);
+    lv_timer_t ** timers = lv_realloc(state.waiting_heap.timers, size * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(timers);
+    if(timers == NULL) return false;
+    state.waiting_heap.timers = timers;
+
+    timers = lv_realloc(state.ready_heap.timers, size * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(timers);
+    if(timers == NULL) return false;
+    state.ready_heap.timers = timers;
+
+    state.heap_size = size;
+    return true;
+}
+
+/**
+ * Halve the size of the heaps if at most a quarter of it is used,
+ * e.g. after many timers were created for async calls
+ */
+static void heap_shrink(void)
+{
+    if(state.timer_cnt > state.heap_size / 4) return;
+
+    uint32_t size = state.heap_size / 2;
+    if(size == 0) {
+        lv_free(state.waiting_heap.timers);
+        lv_free(state.ready_heap.timers);
+        state.waiting_heap.timers = NULL;
+        state.ready_heap.timers = NULL;
+        state.heap_size = 0;
+        return;
+    }
+
+    /*If shrinking fails, the larger array is kept which is still large enough*/
+    lv_timer_t ** timers = lv_realloc(state.waiting_heap.timers, size * sizeof(lv_timer_t *));
+    if(timers == NULL) return;
+    state.waiting_heap.timers = timers;
+    state.heap_size = size;
+
+    timers = lv_realloc(state.ready_heap.timers, size * sizeof(lv_timer_t *));
+    if(timers) state.ready_heap.timers = timers;
+}
+
+/**
+ * Add a timer to a heap
+ * @param heap      pointer to `waiting_heap` or `ready_heap`
+ * @param timer     pointer to a timer which is not in any heap
+ */
+static void heap_insert(lv_timer_heap_t * heap, lv_timer_t * timer)
+{
+    LV_ASSERT(heap->cnt < state.heap_size);
+
+    timer->ready = heap == &state.ready_heap;
+    heap->timers[heap->cnt] = timer;
+    timer->heap_index = heap->cnt;
+    heap->cnt++;
+    heap_sift_up(heap, timer->heap_index, lv_tick_get());
+}
+
+/**
+ * Remove a timer from its heap
+ * @param timer     pointer to a timer. Nothing happens if it's not in any heap.
+ */
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t i = timer->heap_index;
+    if(i == LV_TIMER_HEAP_INDEX_NONE) return;
+
+    lv_timer_heap_t * heap = timer->ready ? &state.ready_heap : &state.waiting_heap;
+    timer->heap_index = LV_TIMER_HEAP_INDEX_NONE;
+    heap->cnt--;
+    if(i == heap->cnt) return;
+
+    /*Fill the gap with the last timer and move it to its place*/
+    lv_timer_t * last = heap->timers[heap->cnt];
+    heap->timers[i] = last;
+    last->heap_index = i;
+
+    uint32_t now = lv_tick_get();
+    heap_sift_up(heap, i, now);
+    heap_sift_down(heap, last->heap_index, now);
+}
+
+/**
+ * Move a timer to its place in the heap of the waiting timers after its period, last run or repeat count has changed
+ * @param timer     pointer to a timer
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    /*The order of the ready timers doesn't depend on time*/
+    if(timer->heap_index == LV_TIMER_HEAP_INDEX_NONE || timer->ready) return;
+
+    uint32_t now = lv_tick_get();
+    heap_sift_up(&state.waiting_heap, timer->heap_index, now);
+    heap_sift_down(&state.waiting_heap, timer->heap_index, now);
+}
+
+static void heap_sift_up(lv_timer_heap_t * heap, uint32_t i, uint32_t now)
+{
+    lv_timer_t * timer = heap->timers[i];
+    while(i > 0) {
+        uint32_t parent = (i - 1) / 2;
+        if(!heap_is_before(heap, timer, heap->timers[parent], now)) break;
+
+        heap->timers[i] = heap->timers[parent];
+        heap->timers[i]->heap_index = i;
+        i = parent;
+    }
+
+    heap->timers[i] = timer;
+    timer->heap_index = i;
+}
+
+static void heap_sift_down(lv_timer_heap_t * heap, uint32_t i, uint32_t now)
+{
+    lv_timer_t * timer = heap->timers[i];
+    while(true) {
+        uint32_t child = 2 * i + 1;
+        if(child >= heap->cnt) break;
+        if(child + 1 < heap->cnt && heap_is_before(heap, heap->timers[child + 1], heap->timers[child], now)) child++;
+        if(!heap_is_before(heap, heap->timers[child], timer, now)) break;
+
+        heap->timers[i] = heap->timers[child];
+        heap->timers[i]->heap_index = i;
+        i = child;
+    }
+
+    heap->timers[i] = timer;
+    timer->heap_index = i;
+}
+
+/**
+ * Check if a timer should be above an other one in a heap
+ * @param heap      pointer to `waiting_heap` or `ready_heap`
+ * @param a         pointer to a timer
+ * @param b         pointer to an other timer
+ * @param now       the current tick. Must be the same during a heap operation.
+ * @return          true: `a` should run earlier than `b`
+ */
+static bool heap_is_before(const lv_timer_heap_t * heap, const lv_timer_t * a, const lv_timer_t * b, uint32_t now)
+{
+    /*Ready timers run in the order of the timer list where new timers are added to the head*/
+    bool newer = (int32_t)(a->id - b->id) > 0;
+    if(heap == &state.ready_heap) return newer;
+
+    if((a->repeat_count == 0) != (b->repeat_count == 0)) return a->repeat_count == 0;
+
+    /*The remaining times can be negative. As they change by the same amount as time passes
+     *their order stays the same for any `now`.*/
+    int64_t a_remaining = (int64_t)a->period - (int32_t)(now - a->last_run);
+    int64_t b_remaining = (int64_t)b->period - (int32_t)(now - b->last_run);
+    if(a_remaining != b_remaining) return a_remaining < b_remaining;
+
+    return newer;
+}
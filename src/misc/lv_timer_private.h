@@ -15,6 +15,8 @@ extern "C" {
  *********************/
 
 #include "lv_timer.h"
+#include "lv_ilist.h"
+#include "lv_slab.h"
 
 #if LV_USE_EXT_DATA
 #include "../lvgl_private.h"
@@ -24,6 +26,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** `heap_index` of timers which are not in any heap*/
+#define LV_TIMER_HEAP_INDEX_NONE    UINT32_MAX
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,17 +40,38 @@ struct _lv_timer_t {
 #if LV_USE_EXT_DATA
     lv_ext_data_t ext_data;
 #endif
+    lv_ilist_link_t link;      /**< Links of the timer list */
     uint32_t period;           /**< How often the timer should run */
     uint32_t last_run;         /**< Last time the timer ran */
     lv_timer_cb_t timer_cb;    /**< Timer function */
     void * user_data;          /**< Custom user data */
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
     volatile int paused;
+    uint32_t id;               /**< Increasing with the creation to run the ready timers in the order of the list */
+    uint32_t heap_index;       /**< Position in the heap of the waiting or the ready timers */
     uint32_t auto_delete : 1;
+    uint32_t ready : 1;        /**< 1: it's in the heap of the ready timers; 0: in the heap of the waiting timers */
 };
 
+/**
+ * A binary heap of timers
+ */
+typedef struct {
+    lv_timer_t ** timers;
+    uint32_t cnt;
+} lv_timer_heap_t;
+
 typedef struct {
-    lv_ll_t timer_ll;          /**< Linked list to store the lv_timers */
+    lv_ilist_t timer_list;     /**< The timers, linked by their `link` field */
+#if LV_TIMER_ANIM_POOL_CHUNK_SIZE
+    lv_slab_t timer_pool;      /**< The timers are allocated from here */
+#endif
+    lv_timer_heap_t waiting_heap;   /**< The timers by the time they will be ready, the first on top */
+    lv_timer_heap_t ready_heap;     /**< The timers to run in this `lv_timer_handler` call, the last created on top */
+    uint32_t heap_size;        /**< Allocated length of both heaps. It's at least the number of timers. */
+    uint32_t timer_cnt;
+    uint32_t timer_id;         /**< The ID of the next created timer */
+    lv_timer_t * timer_running; /**< The timer being executed. Set to NULL if it's deleted. */
 
     bool lv_timer_run;
     uint8_t idle_last;
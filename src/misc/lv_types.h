@@ -119,6 +119,8 @@ typedef struct _lv_display_t lv_display_t;
 typedef struct _lv_layer_t lv_layer_t;
 typedef struct _lv_draw_unit_t lv_draw_unit_t;
 typedef struct _lv_draw_task_t lv_draw_task_t;
+typedef struct _lv_draw_task_grid_t lv_draw_task_grid_t;
+typedef struct _lv_draw_display_list_t lv_draw_display_list_t;
 
 typedef struct _lv_indev_t lv_indev_t;
 
@@ -184,12 +186,20 @@ typedef struct _lv_obj_style_t lv_obj_style_t;
 
 typedef struct _lv_obj_style_transition_dsc_t lv_obj_style_transition_dsc_t;
 
+typedef struct _lv_obj_style_value_cache_t lv_obj_style_value_cache_t;
+
 typedef struct _lv_hit_test_info_t lv_hit_test_info_t;
 
 typedef struct _lv_cover_check_info_t lv_cover_check_info_t;
 
 typedef struct _lv_obj_spec_attr_t lv_obj_spec_attr_t;
 
+typedef struct _lv_obj_bulk_delete_t lv_obj_bulk_delete_t;
+
+typedef struct _lv_obj_inv_batch_t lv_obj_inv_batch_t;
+
+typedef struct _lv_obj_hit_index_t lv_obj_hit_index_t;
+
 typedef struct _lv_image_t lv_image_t;
 
 typedef struct _lv_animimg_t lv_animimg_t;
@@ -244,6 +254,8 @@ typedef struct _lv_menu_page_t lv_menu_page_t;
 
 typedef struct _lv_msgbox_t lv_msgbox_t;
 
+typedef struct _lv_recyclerview_t lv_recyclerview_t;
+
 typedef struct _lv_roller_t lv_roller_t;
 
 typedef struct _lv_scale_section_t lv_scale_section_t;
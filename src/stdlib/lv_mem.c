@@ -10,6 +10,7 @@
 #include "../misc/lv_assert.h"
 #include "../misc/lv_log.h"
 #include "../core/lv_global.h"
+#include "../core/lv_obj_pool_private.h"
 
 #if LV_USE_OS == LV_OS_PTHREAD
     #include <pthread.h>
@@ -181,6 +182,7 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 {
     lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
     lv_mem_monitor_core(mon_p);
+    lv_obj_pool_monitor(mon_p);
 }
 
 /**********************
@@ -41,6 +41,8 @@ typedef struct {
     size_t max_used;    /**< Max size of Heap memory used */
     uint8_t used_pct;   /**< Percentage used */
     uint8_t frag_pct;   /**< Amount of fragmentation */
+    size_t obj_pool_size;       /**< Memory allocated for the widget pools. Part of the used heap. */
+    size_t obj_pool_used_size;  /**< Memory of the pools used by widgets, their attributes and style arrays */
 } lv_mem_monitor_t;
 
 /**********************
@@ -13,6 +13,9 @@
 #include "../lv_theme_private.h"
 #include "../../misc/lv_color.h"
 #include "../../core/lv_global.h"
+#if LV_USE_THEME_STYLE_TABLES
+#include "lv_theme_default_style_tables.h"
+#endif
 
 /*********************
  *      DEFINES
@@ -179,7 +182,7 @@ struct _my_theme_t {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static void style_init_reset(lv_style_t * style);
+static void style_init_reset(lv_style_t * style, const lv_style_prop_table_t * prop_table);
 static void theme_apply(lv_theme_t * th, lv_obj_t * obj);
 static void resolution_change_event_cb(lv_event_t * e);
 
@@ -214,8 +217,8 @@ static void style_init(my_theme_t * theme)
     theme->color_card = theme->base.flags & MODE_DARK ? DARK_COLOR_CARD : LIGHT_COLOR_CARD;
     theme->color_grey = theme->base.flags & MODE_DARK ? DARK_COLOR_GREY : LIGHT_COLOR_GREY;
 
-    style_init_reset(&theme->styles.transition_delayed);
-    style_init_reset(&theme->styles.transition_normal);
+    style_init_reset(&theme->styles.transition_delayed, LV_THEME_STYLE_PROP_TABLE(transition_delayed));
+    style_init_reset(&theme->styles.transition_normal, LV_THEME_STYLE_PROP_TABLE(transition_normal));
 #if TRANSITION_TIME
     lv_style_transition_dsc_init(&theme->trans_delayed, trans_props, lv_anim_path_linear, TRANSITION_TIME, 70, NULL);
     lv_style_transition_dsc_init(&theme->trans_normal, trans_props, lv_anim_path_linear, TRANSITION_TIME, 0, NULL);
@@ -226,7 +229,7 @@ static void style_init(my_theme_t * theme)
     lv_style_set_transition(&theme->styles.transition_normal, &theme->trans_normal); /*Go back to default state with delay*/
 #endif
 
-    style_init_reset(&theme->styles.scrollbar);
+    style_init_reset(&theme->styles.scrollbar, LV_THEME_STYLE_PROP_TABLE(scrollbar));
     lv_color_t sb_color = (theme->base.flags & MODE_DARK) ? lv_palette_darken(LV_PALETTE_GREY,
                                                                               2) : lv_palette_main(LV_PALETTE_GREY);
     lv_style_set_bg_color(&theme->styles.scrollbar, sb_color);
@@ -239,10 +242,10 @@ static void style_init(my_theme_t * theme)
     lv_style_set_transition(&theme->styles.scrollbar, &theme->trans_normal);
 #endif
 
-    style_init_reset(&theme->styles.scrollbar_scrolled);
+    style_init_reset(&theme->styles.scrollbar_scrolled, LV_THEME_STYLE_PROP_TABLE(scrollbar_scrolled));
     lv_style_set_bg_opa(&theme->styles.scrollbar_scrolled,  LV_OPA_COVER);
 
-    style_init_reset(&theme->styles.scr);
+    style_init_reset(&theme->styles.scr, LV_THEME_STYLE_PROP_TABLE(scr));
     lv_style_set_bg_opa(&theme->styles.scr, LV_OPA_COVER);
     lv_style_set_bg_color(&theme->styles.scr, theme->color_scr);
     lv_style_set_text_color(&theme->styles.scr, theme->color_text);
@@ -251,7 +254,7 @@ static void style_init(my_theme_t * theme)
     lv_style_set_pad_column(&theme->styles.scr, PAD_SMALL);
     lv_style_set_rotary_sensitivity(&theme->styles.scr, theme->disp_dpi / 4 * 256);
 
-    style_init_reset(&theme->styles.card);
+    style_init_reset(&theme->styles.card, LV_THEME_STYLE_PROP_TABLE(card));
     lv_style_set_radius(&theme->styles.card, RADIUS_DEFAULT);
     lv_style_set_bg_opa(&theme->styles.card, LV_OPA_COVER);
     lv_style_set_bg_color(&theme->styles.card, theme->color_card);
@@ -265,18 +268,18 @@ static void style_init(my_theme_t * theme)
     lv_style_set_line_color(&theme->styles.card, lv_palette_main(LV_PALETTE_GREY));
     lv_style_set_line_width(&theme->styles.card, LV_DPX_CALC(theme->disp_dpi, 1));
 
-    style_init_reset(&theme->styles.outline_primary);
+    style_init_reset(&theme->styles.outline_primary, LV_THEME_STYLE_PROP_TABLE(outline_primary));
     lv_style_set_outline_color(&theme->styles.outline_primary, theme->base.color_primary);
     lv_style_set_outline_width(&theme->styles.outline_primary, OUTLINE_WIDTH);
     lv_style_set_outline_pad(&theme->styles.outline_primary, OUTLINE_WIDTH);
     lv_style_set_outline_opa(&theme->styles.outline_primary, LV_OPA_50);
 
-    style_init_reset(&theme->styles.outline_secondary);
+    style_init_reset(&theme->styles.outline_secondary, LV_THEME_STYLE_PROP_TABLE(outline_secondary));
     lv_style_set_outline_color(&theme->styles.outline_secondary, theme->base.color_secondary);
     lv_style_set_outline_width(&theme->styles.outline_secondary, OUTLINE_WIDTH);
     lv_style_set_outline_opa(&theme->styles.outline_secondary, LV_OPA_50);
 
-    style_init_reset(&theme->styles.btn);
+    style_init_reset(&theme->styles.btn, LV_THEME_STYLE_PROP_TABLE(btn));
     lv_style_set_radius(&theme->styles.btn,
                         LV_DPX_CALC(theme->disp_dpi, theme->disp_size == DISP_LARGE ? 16 : theme->disp_size == DISP_MEDIUM ? 12 : 8));
     lv_style_set_bg_opa(&theme->styles.btn, LV_OPA_COVER);
@@ -293,123 +296,123 @@ static void style_init(my_theme_t * theme)
     lv_style_set_pad_column(&theme->styles.btn, LV_DPX_CALC(theme->disp_dpi, 5));
     lv_style_set_pad_row(&theme->styles.btn, LV_DPX_CALC(theme->disp_dpi, 5));
 
-    style_init_reset(&theme->styles.pressed);
+    style_init_reset(&theme->styles.pressed, LV_THEME_STYLE_PROP_TABLE(pressed));
     lv_style_set_recolor(&theme->styles.pressed, lv_color_black());
     lv_style_set_recolor_opa(&theme->styles.pressed, 35);
 
-    style_init_reset(&theme->styles.disabled);
+    style_init_reset(&theme->styles.disabled, LV_THEME_STYLE_PROP_TABLE(disabled));
     if(theme_def->base.flags & MODE_DARK)
         lv_style_set_recolor(&theme->styles.disabled, lv_palette_darken(LV_PALETTE_GREY, 2));
     else
         lv_style_set_recolor(&theme->styles.disabled, lv_palette_lighten(LV_PALETTE_GREY, 2));
     lv_style_set_recolor_opa(&theme->styles.disabled, LV_OPA_50);
 
-    style_init_reset(&theme->styles.clip_corner);
+    style_init_reset(&theme->styles.clip_corner, LV_THEME_STYLE_PROP_TABLE(clip_corner));
     lv_style_set_clip_corner(&theme->styles.clip_corner, true);
     lv_style_set_border_post(&theme->styles.clip_corner, true);
 
-    style_init_reset(&theme->styles.pad_normal);
+    style_init_reset(&theme->styles.pad_normal, LV_THEME_STYLE_PROP_TABLE(pad_normal));
     lv_style_set_pad_all(&theme->styles.pad_normal, PAD_DEF);
     lv_style_set_pad_row(&theme->styles.pad_normal, PAD_DEF);
     lv_style_set_pad_column(&theme->styles.pad_normal, PAD_DEF);
 
-    style_init_reset(&theme->styles.pad_small);
+    style_init_reset(&theme->styles.pad_small, LV_THEME_STYLE_PROP_TABLE(pad_small));
     lv_style_set_pad_all(&theme->styles.pad_small, PAD_SMALL);
     lv_style_set_pad_gap(&theme->styles.pad_small, PAD_SMALL);
 
-    style_init_reset(&theme->styles.pad_gap);
+    style_init_reset(&theme->styles.pad_gap, LV_THEME_STYLE_PROP_TABLE(pad_gap));
     lv_style_set_pad_row(&theme->styles.pad_gap, LV_DPX_CALC(theme->disp_dpi, 10));
     lv_style_set_pad_column(&theme->styles.pad_gap, LV_DPX_CALC(theme->disp_dpi, 10));
 
-    style_init_reset(&theme->styles.line_space_large);
+    style_init_reset(&theme->styles.line_space_large, LV_THEME_STYLE_PROP_TABLE(line_space_large));
     lv_style_set_text_line_space(&theme->styles.line_space_large, LV_DPX_CALC(theme->disp_dpi, 20));
 
-    style_init_reset(&theme->styles.text_align_center);
+    style_init_reset(&theme->styles.text_align_center, LV_THEME_STYLE_PROP_TABLE(text_align_center));
     lv_style_set_text_align(&theme->styles.text_align_center, LV_TEXT_ALIGN_CENTER);
 
-    style_init_reset(&theme->styles.pad_zero);
+    style_init_reset(&theme->styles.pad_zero, LV_THEME_STYLE_PROP_TABLE(pad_zero));
     lv_style_set_pad_all(&theme->styles.pad_zero, 0);
     lv_style_set_pad_row(&theme->styles.pad_zero, 0);
     lv_style_set_pad_column(&theme->styles.pad_zero, 0);
 
-    style_init_reset(&theme->styles.pad_tiny);
+    style_init_reset(&theme->styles.pad_tiny, LV_THEME_STYLE_PROP_TABLE(pad_tiny));
     lv_style_set_pad_all(&theme->styles.pad_tiny, PAD_TINY);
     lv_style_set_pad_row(&theme->styles.pad_tiny, PAD_TINY);
     lv_style_set_pad_column(&theme->styles.pad_tiny, PAD_TINY);
 
-    style_init_reset(&theme->styles.bg_color_primary);
+    style_init_reset(&theme->styles.bg_color_primary, LV_THEME_STYLE_PROP_TABLE(bg_color_primary));
     lv_style_set_bg_color(&theme->styles.bg_color_primary, theme->base.color_primary);
     lv_style_set_text_color(&theme->styles.bg_color_primary, lv_color_white());
     lv_style_set_bg_opa(&theme->styles.bg_color_primary, LV_OPA_COVER);
 
-    style_init_reset(&theme->styles.bg_color_primary_muted);
+    style_init_reset(&theme->styles.bg_color_primary_muted, LV_THEME_STYLE_PROP_TABLE(bg_color_primary_muted));
     lv_style_set_bg_color(&theme->styles.bg_color_primary_muted, theme->base.color_primary);
     lv_style_set_text_color(&theme->styles.bg_color_primary_muted, theme->base.color_primary);
     lv_style_set_bg_opa(&theme->styles.bg_color_primary_muted, LV_OPA_20);
 
-    style_init_reset(&theme->styles.bg_color_secondary);
+    style_init_reset(&theme->styles.bg_color_secondary, LV_THEME_STYLE_PROP_TABLE(bg_color_secondary));
     lv_style_set_bg_color(&theme->styles.bg_color_secondary, theme->base.color_secondary);
     lv_style_set_text_color(&theme->styles.bg_color_secondary, lv_color_white());
     lv_style_set_bg_opa(&theme->styles.bg_color_secondary, LV_OPA_COVER);
 
-    style_init_reset(&theme->styles.bg_color_secondary_muted);
+    style_init_reset(&theme->styles.bg_color_secondary_muted, LV_THEME_STYLE_PROP_TABLE(bg_color_secondary_muted));
     lv_style_set_bg_color(&theme->styles.bg_color_secondary_muted, theme->base.color_secondary);
     lv_style_set_text_color(&theme->styles.bg_color_secondary_muted, theme->base.color_secondary);
     lv_style_set_bg_opa(&theme->styles.bg_color_secondary_muted, LV_OPA_20);
 
-    style_init_reset(&theme->styles.bg_color_grey);
+    style_init_reset(&theme->styles.bg_color_grey, LV_THEME_STYLE_PROP_TABLE(bg_color_grey));
     lv_style_set_bg_color(&theme->styles.bg_color_grey, theme->color_grey);
     lv_style_set_bg_opa(&theme->styles.bg_color_grey, LV_OPA_COVER);
     lv_style_set_text_color(&theme->styles.bg_color_grey, theme->color_text);
 
-    style_init_reset(&theme->styles.bg_color_white);
+    style_init_reset(&theme->styles.bg_color_white, LV_THEME_STYLE_PROP_TABLE(bg_color_white));
     lv_style_set_bg_color(&theme->styles.bg_color_white, theme->color_card);
     lv_style_set_bg_opa(&theme->styles.bg_color_white, LV_OPA_COVER);
     lv_style_set_text_color(&theme->styles.bg_color_white, theme->color_text);
 
-    style_init_reset(&theme->styles.circle);
+    style_init_reset(&theme->styles.circle, LV_THEME_STYLE_PROP_TABLE(circle));
     lv_style_set_radius(&theme->styles.circle, LV_RADIUS_CIRCLE);
 
-    style_init_reset(&theme->styles.no_radius);
+    style_init_reset(&theme->styles.no_radius, LV_THEME_STYLE_PROP_TABLE(no_radius));
     lv_style_set_radius(&theme->styles.no_radius, 0);
 
-    style_init_reset(&theme->styles.rotary_scroll);
+    style_init_reset(&theme->styles.rotary_scroll, LV_THEME_STYLE_PROP_TABLE(rotary_scroll));
     lv_style_set_rotary_sensitivity(&theme->styles.rotary_scroll, theme->disp_dpi / 4 * 256);
 
 #if LV_THEME_DEFAULT_GROW
-    style_init_reset(&theme->styles.grow);
+    style_init_reset(&theme->styles.grow, LV_THEME_STYLE_PROP_TABLE(grow));
     lv_style_set_transform_width(&theme->styles.grow, LV_DPX_CALC(theme->disp_dpi, 3));
     lv_style_set_transform_height(&theme->styles.grow, LV_DPX_CALC(theme->disp_dpi, 3));
 #endif
 
-    style_init_reset(&theme->styles.knob);
+    style_init_reset(&theme->styles.knob, LV_THEME_STYLE_PROP_TABLE(knob));
     lv_style_set_bg_color(&theme->styles.knob, theme->base.color_primary);
     lv_style_set_bg_opa(&theme->styles.knob, LV_OPA_COVER);
     lv_style_set_pad_all(&theme->styles.knob, LV_DPX_CALC(theme->disp_dpi, 6));
     lv_style_set_radius(&theme->styles.knob, LV_RADIUS_CIRCLE);
 
-    style_init_reset(&theme->styles.anim);
+    style_init_reset(&theme->styles.anim, LV_THEME_STYLE_PROP_TABLE(anim));
     lv_style_set_anim_duration(&theme->styles.anim, 200);
 
-    style_init_reset(&theme->styles.anim_fast);
+    style_init_reset(&theme->styles.anim_fast, LV_THEME_STYLE_PROP_TABLE(anim_fast));
     lv_style_set_anim_duration(&theme->styles.anim_fast, 120);
 
 #if LV_USE_ARC
-    style_init_reset(&theme->styles.arc_indic);
+    style_init_reset(&theme->styles.arc_indic, LV_THEME_STYLE_PROP_TABLE(arc_indic));
     lv_style_set_arc_color(&theme->styles.arc_indic, theme->color_grey);
     lv_style_set_arc_width(&theme->styles.arc_indic, LV_DPX_CALC(theme->disp_dpi, 15));
     lv_style_set_arc_rounded(&theme->styles.arc_indic, true);
 
-    style_init_reset(&theme->styles.arc_indic_primary);
+    style_init_reset(&theme->styles.arc_indic_primary, LV_THEME_STYLE_PROP_TABLE(arc_indic_primary));
     lv_style_set_arc_color(&theme->styles.arc_indic_primary, theme->base.color_primary);
 #endif
 
 #if LV_USE_DROPDOWN
-    style_init_reset(&theme->styles.dropdown_list);
+    style_init_reset(&theme->styles.dropdown_list, LV_THEME_STYLE_PROP_TABLE(dropdown_list));
     lv_style_set_max_height(&theme->styles.dropdown_list, LV_DPI_DEF * 2);
 #endif
 #if LV_USE_CHECKBOX
-    style_init_reset(&theme->styles.cb_marker);
+    style_init_reset(&theme->styles.cb_marker, LV_THEME_STYLE_PROP_TABLE(cb_marker));
     lv_style_set_pad_all(&theme->styles.cb_marker, LV_DPX_CALC(theme->disp_dpi, 3));
     lv_style_set_border_width(&theme->styles.cb_marker, BORDER_WIDTH);
     lv_style_set_border_color(&theme->styles.cb_marker, theme->base.color_primary);
@@ -419,29 +422,29 @@ static void style_init(my_theme_t * theme)
     lv_style_set_text_font(&theme->styles.cb_marker, theme->base.font_small);
     lv_style_set_text_color(&theme->styles.cb_marker, lv_color_white());
 
-    style_init_reset(&theme->styles.cb_marker_checked);
+    style_init_reset(&theme->styles.cb_marker_checked, LV_THEME_STYLE_PROP_TABLE(cb_marker_checked));
     lv_style_set_bg_image_src(&theme->styles.cb_marker_checked, LV_SYMBOL_OK);
 #endif
 
 #if LV_USE_SWITCH
-    style_init_reset(&theme->styles.switch_knob);
+    style_init_reset(&theme->styles.switch_knob, LV_THEME_STYLE_PROP_TABLE(switch_knob));
     lv_style_set_pad_all(&theme->styles.switch_knob, - LV_DPX_CALC(theme->disp_dpi, 4));
     lv_style_set_bg_color(&theme->styles.switch_knob, lv_color_white());
 #endif
 
 #if LV_USE_LINE
-    style_init_reset(&theme->styles.line);
+    style_init_reset(&theme->styles.line, LV_THEME_STYLE_PROP_TABLE(line));
     lv_style_set_line_width(&theme->styles.line, 1);
     lv_style_set_line_color(&theme->styles.line, theme->color_text);
 #endif
 
 #if LV_USE_CHART
-    style_init_reset(&theme->styles.chart_bg);
+    style_init_reset(&theme->styles.chart_bg, LV_THEME_STYLE_PROP_TABLE(chart_bg));
     lv_style_set_border_post(&theme->styles.chart_bg, false);
     lv_style_set_pad_column(&theme->styles.chart_bg, LV_DPX_CALC(theme->disp_dpi, 10));
     lv_style_set_line_color(&theme->styles.chart_bg, theme->color_grey);
 
-    style_init_reset(&theme->styles.chart_series);
+    style_init_reset(&theme->styles.chart_series, LV_THEME_STYLE_PROP_TABLE(chart_series));
     lv_style_set_line_width(&theme->styles.chart_series, LV_DPX_CALC(theme->disp_dpi, 3));
     lv_style_set_radius(&theme->styles.chart_series, LV_DPX_CALC(theme->disp_dpi, 3));
 
@@ -449,7 +452,7 @@ static void style_init(my_theme_t * theme)
     lv_style_set_size(&theme->styles.chart_series, chart_size, chart_size);
     lv_style_set_pad_column(&theme->styles.chart_series, LV_DPX_CALC(theme->disp_dpi, 2));
 
-    style_init_reset(&theme->styles.chart_indic);
+    style_init_reset(&theme->styles.chart_indic, LV_THEME_STYLE_PROP_TABLE(chart_indic));
     lv_style_set_radius(&theme->styles.chart_indic, LV_RADIUS_CIRCLE);
     lv_style_set_size(&theme->styles.chart_indic, chart_size, chart_size);
     lv_style_set_bg_color(&theme->styles.chart_indic, theme->base.color_primary);
@@ -457,21 +460,21 @@ static void style_init(my_theme_t * theme)
 #endif
 
 #if LV_USE_MENU
-    style_init_reset(&theme->styles.menu_bg);
+    style_init_reset(&theme->styles.menu_bg, LV_THEME_STYLE_PROP_TABLE(menu_bg));
     lv_style_set_pad_all(&theme->styles.menu_bg, 0);
     lv_style_set_pad_gap(&theme->styles.menu_bg, 0);
     lv_style_set_radius(&theme->styles.menu_bg, 0);
     lv_style_set_clip_corner(&theme->styles.menu_bg, true);
     lv_style_set_border_side(&theme->styles.menu_bg, LV_BORDER_SIDE_NONE);
 
-    style_init_reset(&theme->styles.menu_section);
+    style_init_reset(&theme->styles.menu_section, LV_THEME_STYLE_PROP_TABLE(menu_section));
     lv_style_set_radius(&theme->styles.menu_section, RADIUS_DEFAULT);
     lv_style_set_clip_corner(&theme->styles.menu_section, true);
     lv_style_set_bg_opa(&theme->styles.menu_section, LV_OPA_COVER);
     lv_style_set_bg_color(&theme->styles.menu_section, theme->color_card);
     lv_style_set_text_color(&theme->styles.menu_section, theme->color_text);
 
-    style_init_reset(&theme->styles.menu_cont);
+    style_init_reset(&theme->styles.menu_cont, LV_THEME_STYLE_PROP_TABLE(menu_cont));
     lv_style_set_pad_hor(&theme->styles.menu_cont, PAD_SMALL);
     lv_style_set_pad_ver(&theme->styles.menu_cont, PAD_SMALL);
     lv_style_set_pad_gap(&theme->styles.menu_cont, PAD_SMALL);
@@ -480,7 +483,7 @@ static void style_init(my_theme_t * theme)
     lv_style_set_border_color(&theme->styles.menu_cont, theme->color_text);
     lv_style_set_border_side(&theme->styles.menu_cont, LV_BORDER_SIDE_NONE);
 
-    style_init_reset(&theme->styles.menu_sidebar_cont);
+    style_init_reset(&theme->styles.menu_sidebar_cont, LV_THEME_STYLE_PROP_TABLE(menu_sidebar_cont));
     lv_style_set_pad_all(&theme->styles.menu_sidebar_cont, 0);
     lv_style_set_pad_gap(&theme->styles.menu_sidebar_cont, 0);
     lv_style_set_border_width(&theme->styles.menu_sidebar_cont, LV_DPX_CALC(theme->disp_dpi, 1));
@@ -488,68 +491,68 @@ static void style_init(my_theme_t * theme)
     lv_style_set_border_color(&theme->styles.menu_sidebar_cont, theme->color_text);
     lv_style_set_border_side(&theme->styles.menu_sidebar_cont, LV_BORDER_SIDE_RIGHT);
 
-    style_init_reset(&theme->styles.menu_main_cont);
+    style_init_reset(&theme->styles.menu_main_cont, LV_THEME_STYLE_PROP_TABLE(menu_main_cont));
     lv_style_set_pad_all(&theme->styles.menu_main_cont, 0);
     lv_style_set_pad_gap(&theme->styles.menu_main_cont, 0);
 
-    style_init_reset(&theme->styles.menu_header_cont);
+    style_init_reset(&theme->styles.menu_header_cont, LV_THEME_STYLE_PROP_TABLE(menu_header_cont));
     lv_style_set_pad_hor(&theme->styles.menu_header_cont, PAD_SMALL);
     lv_style_set_pad_ver(&theme->styles.menu_header_cont, PAD_TINY);
     lv_style_set_pad_gap(&theme->styles.menu_header_cont, PAD_SMALL);
 
-    style_init_reset(&theme->styles.menu_header_btn);
+    style_init_reset(&theme->styles.menu_header_btn, LV_THEME_STYLE_PROP_TABLE(menu_header_btn));
     lv_style_set_pad_hor(&theme->styles.menu_header_btn, PAD_TINY);
     lv_style_set_pad_ver(&theme->styles.menu_header_btn, PAD_TINY);
     lv_style_set_shadow_opa(&theme->styles.menu_header_btn, LV_OPA_TRANSP);
     lv_style_set_bg_opa(&theme->styles.menu_header_btn, LV_OPA_TRANSP);
     lv_style_set_text_color(&theme->styles.menu_header_btn, theme->color_text);
 
-    style_init_reset(&theme->styles.menu_page);
+    style_init_reset(&theme->styles.menu_page, LV_THEME_STYLE_PROP_TABLE(menu_page));
     lv_style_set_pad_hor(&theme->styles.menu_page, 0);
     lv_style_set_pad_gap(&theme->styles.menu_page, 0);
 
-    style_init_reset(&theme->styles.menu_pressed);
+    style_init_reset(&theme->styles.menu_pressed, LV_THEME_STYLE_PROP_TABLE(menu_pressed));
     lv_style_set_bg_opa(&theme->styles.menu_pressed, LV_OPA_20);
     lv_style_set_bg_color(&theme->styles.menu_pressed, lv_palette_main(LV_PALETTE_GREY));
 
-    style_init_reset(&theme->styles.menu_separator);
+    style_init_reset(&theme->styles.menu_separator, LV_THEME_STYLE_PROP_TABLE(menu_separator));
     lv_style_set_bg_opa(&theme->styles.menu_separator, LV_OPA_TRANSP);
     lv_style_set_pad_ver(&theme->styles.menu_separator, PAD_TINY);
 #endif
 
 #if LV_USE_TABLE
-    style_init_reset(&theme->styles.table_cell);
+    style_init_reset(&theme->styles.table_cell, LV_THEME_STYLE_PROP_TABLE(table_cell));
     lv_style_set_border_width(&theme->styles.table_cell, LV_DPX_CALC(theme->disp_dpi, 1));
     lv_style_set_border_color(&theme->styles.table_cell, theme->color_grey);
     lv_style_set_border_side(&theme->styles.table_cell, LV_BORDER_SIDE_TOP | LV_BORDER_SIDE_BOTTOM);
 #endif
 
 #if LV_USE_TEXTAREA
-    style_init_reset(&theme->styles.ta_cursor);
+    style_init_reset(&theme->styles.ta_cursor, LV_THEME_STYLE_PROP_TABLE(ta_cursor));
     lv_style_set_border_color(&theme->styles.ta_cursor, theme->color_text);
     lv_style_set_border_width(&theme->styles.ta_cursor, LV_DPX_CALC(theme->disp_dpi, 2));
     lv_style_set_pad_left(&theme->styles.ta_cursor, - LV_DPX_CALC(theme->disp_dpi, 1));
     lv_style_set_border_side(&theme->styles.ta_cursor, LV_BORDER_SIDE_LEFT);
     lv_style_set_anim_duration(&theme->styles.ta_cursor, 400);
 
-    style_init_reset(&theme->styles.ta_placeholder);
+    style_init_reset(&theme->styles.ta_placeholder, LV_THEME_STYLE_PROP_TABLE(ta_placeholder));
     lv_style_set_text_color(&theme->styles.ta_placeholder,
                             (theme->base.flags & MODE_DARK) ? lv_palette_darken(LV_PALETTE_GREY,
                                                                                 2) : lv_palette_lighten(LV_PALETTE_GREY, 1));
 #endif
 
 #if LV_USE_CALENDAR
-    style_init_reset(&theme->styles.calendar_btnm_bg);
+    style_init_reset(&theme->styles.calendar_btnm_bg, LV_THEME_STYLE_PROP_TABLE(calendar_btnm_bg));
     lv_style_set_pad_all(&theme->styles.calendar_btnm_bg, PAD_SMALL);
     lv_style_set_pad_gap(&theme->styles.calendar_btnm_bg, PAD_SMALL / 2);
 
-    style_init_reset(&theme->styles.calendar_btnm_day);
+    style_init_reset(&theme->styles.calendar_btnm_day, LV_THEME_STYLE_PROP_TABLE(calendar_btnm_day));
     lv_style_set_border_width(&theme->styles.calendar_btnm_day, LV_DPX_CALC(theme->disp_dpi, 1));
     lv_style_set_border_color(&theme->styles.calendar_btnm_day, theme->color_grey);
     lv_style_set_bg_color(&theme->styles.calendar_btnm_day, theme->color_card);
     lv_style_set_bg_opa(&theme->styles.calendar_btnm_day, LV_OPA_20);
 
-    style_init_reset(&theme->styles.calendar_header);
+    style_init_reset(&theme->styles.calendar_header, LV_THEME_STYLE_PROP_TABLE(calendar_header));
     lv_style_set_pad_hor(&theme->styles.calendar_header, PAD_SMALL);
     lv_style_set_pad_top(&theme->styles.calendar_header, PAD_SMALL);
     lv_style_set_pad_bottom(&theme->styles.calendar_header, PAD_TINY);
@@ -557,48 +560,48 @@ static void style_init(my_theme_t * theme)
 #endif
 
 #if LV_USE_MSGBOX
-    style_init_reset(&theme->styles.msgbox_backdrop_bg);
+    style_init_reset(&theme->styles.msgbox_backdrop_bg, LV_THEME_STYLE_PROP_TABLE(msgbox_backdrop_bg));
     lv_style_set_bg_color(&theme->styles.msgbox_backdrop_bg, lv_palette_main(LV_PALETTE_GREY));
     lv_style_set_bg_opa(&theme->styles.msgbox_backdrop_bg, LV_OPA_50);
 #endif
 #if LV_USE_KEYBOARD
-    style_init_reset(&theme->styles.keyboard_button_bg);
+    style_init_reset(&theme->styles.keyboard_button_bg, LV_THEME_STYLE_PROP_TABLE(keyboard_button_bg));
     lv_style_set_shadow_width(&theme->styles.keyboard_button_bg, 0);
     lv_style_set_radius(&theme->styles.keyboard_button_bg,
                         theme->disp_size == DISP_SMALL ? RADIUS_DEFAULT / 2 : RADIUS_DEFAULT);
 #endif
 
 #if LV_USE_TABVIEW
-    style_init_reset(&theme->styles.tab_btn);
+    style_init_reset(&theme->styles.tab_btn, LV_THEME_STYLE_PROP_TABLE(tab_btn));
     lv_style_set_border_color(&theme->styles.tab_btn, theme->base.color_primary);
     lv_style_set_border_width(&theme->styles.tab_btn, BORDER_WIDTH * 2);
     lv_style_set_border_side(&theme->styles.tab_btn, LV_BORDER_SIDE_BOTTOM);
     lv_style_set_pad_top(&theme->styles.tab_btn, BORDER_WIDTH * 2);
 
-    style_init_reset(&theme->styles.tab_bg_focus);
+    style_init_reset(&theme->styles.tab_bg_focus, LV_THEME_STYLE_PROP_TABLE(tab_bg_focus));
     lv_style_set_outline_pad(&theme->styles.tab_bg_focus, -BORDER_WIDTH);
 #endif
 
 #if LV_USE_LIST
-    style_init_reset(&theme->styles.list_bg);
+    style_init_reset(&theme->styles.list_bg, LV_THEME_STYLE_PROP_TABLE(list_bg));
     lv_style_set_pad_hor(&theme->styles.list_bg, PAD_DEF);
     lv_style_set_pad_ver(&theme->styles.list_bg, 0);
     lv_style_set_pad_gap(&theme->styles.list_bg, 0);
     lv_style_set_clip_corner(&theme->styles.list_bg, true);
 
-    style_init_reset(&theme->styles.list_btn);
+    style_init_reset(&theme->styles.list_btn, LV_THEME_STYLE_PROP_TABLE(list_btn));
     lv_style_set_border_width(&theme->styles.list_btn, LV_DPX_CALC(theme->disp_dpi, 1));
     lv_style_set_border_color(&theme->styles.list_btn, theme->color_grey);
     lv_style_set_border_side(&theme->styles.list_btn, LV_BORDER_SIDE_BOTTOM);
     lv_style_set_pad_all(&theme->styles.list_btn, PAD_SMALL);
     lv_style_set_pad_column(&theme->styles.list_btn, PAD_SMALL);
 
-    style_init_reset(&theme->styles.list_item_grow);
+    style_init_reset(&theme->styles.list_item_grow, LV_THEME_STYLE_PROP_TABLE(list_item_grow));
     lv_style_set_transform_width(&theme->styles.list_item_grow, PAD_DEF);
 #endif
 
 #if LV_USE_LED
-    style_init_reset(&theme->styles.led);
+    style_init_reset(&theme->styles.led, LV_THEME_STYLE_PROP_TABLE(led));
     lv_style_set_bg_opa(&theme->styles.led, LV_OPA_COVER);
     lv_style_set_bg_color(&theme->styles.led, lv_color_white());
     lv_style_set_bg_grad_color(&theme->styles.led, lv_palette_main(LV_PALETTE_GREY));
@@ -609,7 +612,7 @@ static void style_init(my_theme_t * theme)
 #endif
 
 #if LV_USE_SCALE
-    style_init_reset(&theme->styles.scale);
+    style_init_reset(&theme->styles.scale, LV_THEME_STYLE_PROP_TABLE(scale));
     lv_style_set_line_color(&theme->styles.scale, theme->color_text);
     lv_style_set_line_width(&theme->styles.scale, LV_DPX(2));
     lv_style_set_arc_color(&theme->styles.scale, theme->color_text);
@@ -1092,6 +1095,13 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
         lv_obj_add_style(obj, &theme->styles.pressed, LV_STATE_PRESSED);
     }
 #endif
+#if LV_USE_RECYCLERVIEW
+    else if(lv_obj_check_type(obj, &lv_recyclerview_class)) {
+        lv_obj_add_style(obj, &theme->styles.card, 0);
+        lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+        lv_obj_add_style(obj, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+    }
+#endif
 #if LV_USE_MENU
     else if(lv_obj_check_type(obj, &lv_menu_class)) {
         lv_obj_add_style(obj, &theme->styles.card, 0);
@@ -1219,14 +1229,18 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
 #endif
 }
 
-static void style_init_reset(lv_style_t * style)
+static void style_init_reset(lv_style_t * style, const lv_style_prop_table_t * prop_table)
 {
     if(lv_theme_default_is_inited()) {
         lv_style_reset(style);
     }
-    else {
-        lv_style_init(style);
-    }
+
+#if LV_USE_THEME_STYLE_TABLES
+    lv_style_init_table(style, prop_table);
+#else
+    LV_UNUSED(prop_table);
+    lv_style_init(style);
+#endif
 }
 
 
@@ -0,0 +1,1134 @@
+/*
+ **********************************************************************
+ *                            DO NOT EDIT
+ * This file is automatically generated by "style_table_gen.py"
+ * from "lv_theme_default.c"
+ **********************************************************************
+ */
+
+#ifndef LV_THEME_DEFAULT_STYLE_TABLES_H
+#define LV_THEME_DEFAULT_STYLE_TABLES_H
+
+static const lv_style_prop_t transition_delayed_props[] = {
+    LV_STYLE_TRANSITION,
+};
+
+static const lv_style_prop_table_t transition_delayed_prop_table = {
+    .props = transition_delayed_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_TRANSITION] = 1,
+    },
+};
+
+static const lv_style_prop_t transition_normal_props[] = {
+    LV_STYLE_TRANSITION,
+};
+
+static const lv_style_prop_table_t transition_normal_prop_table = {
+    .props = transition_normal_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_TRANSITION] = 1,
+    },
+};
+
+static const lv_style_prop_t scrollbar_props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_RADIUS, LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT,
+    LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM, LV_STYLE_WIDTH, LV_STYLE_BG_OPA,
+    LV_STYLE_TRANSITION,
+};
+
+static const lv_style_prop_table_t scrollbar_prop_table = {
+    .props = scrollbar_props,
+    .const_props = NULL,
+    .prop_cnt = 9,
+    .prop_index = {
+        [LV_STYLE_BG_COLOR] = 1,
+        [LV_STYLE_RADIUS] = 2,
+        [LV_STYLE_PAD_LEFT] = 3,
+        [LV_STYLE_PAD_RIGHT] = 4,
+        [LV_STYLE_PAD_TOP] = 5,
+        [LV_STYLE_PAD_BOTTOM] = 6,
+        [LV_STYLE_WIDTH] = 7,
+        [LV_STYLE_BG_OPA] = 8,
+        [LV_STYLE_TRANSITION] = 9,
+    },
+};
+
+static const lv_style_prop_t scrollbar_scrolled_props[] = {
+    LV_STYLE_BG_OPA,
+};
+
+static const lv_style_prop_table_t scrollbar_scrolled_prop_table = {
+    .props = scrollbar_scrolled_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_BG_OPA] = 1,
+    },
+};
+
+static const lv_style_prop_t scr_props[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR, LV_STYLE_TEXT_COLOR, LV_STYLE_TEXT_FONT,
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN, LV_STYLE_ROTARY_SENSITIVITY,
+};
+
+static const lv_style_prop_table_t scr_prop_table = {
+    .props = scr_props,
+    .const_props = NULL,
+    .prop_cnt = 7,
+    .prop_index = {
+        [LV_STYLE_BG_OPA] = 1,
+        [LV_STYLE_BG_COLOR] = 2,
+        [LV_STYLE_TEXT_COLOR] = 3,
+        [LV_STYLE_TEXT_FONT] = 4,
+        [LV_STYLE_PAD_ROW] = 5,
+        [LV_STYLE_PAD_COLUMN] = 6,
+        [LV_STYLE_ROTARY_SENSITIVITY] = 7,
+    },
+};
+
+static const lv_style_prop_t card_props[] = {
+    LV_STYLE_RADIUS, LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR, LV_STYLE_BORDER_COLOR,
+    LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_POST, LV_STYLE_TEXT_COLOR, LV_STYLE_PAD_LEFT,
+    LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM, LV_STYLE_PAD_ROW,
+    LV_STYLE_PAD_COLUMN, LV_STYLE_LINE_COLOR, LV_STYLE_LINE_WIDTH,
+};
+
+static const lv_style_prop_table_t card_prop_table = {
+    .props = card_props,
+    .const_props = NULL,
+    .prop_cnt = 15,
+    .prop_index = {
+        [LV_STYLE_RADIUS] = 1,
+        [LV_STYLE_BG_OPA] = 2,
+        [LV_STYLE_BG_COLOR] = 3,
+        [LV_STYLE_BORDER_COLOR] = 4,
+        [LV_STYLE_BORDER_WIDTH] = 5,
+        [LV_STYLE_BORDER_POST] = 6,
+        [LV_STYLE_TEXT_COLOR] = 7,
+        [LV_STYLE_PAD_LEFT] = 8,
+        [LV_STYLE_PAD_RIGHT] = 9,
+        [LV_STYLE_PAD_TOP] = 10,
+        [LV_STYLE_PAD_BOTTOM] = 11,
+        [LV_STYLE_PAD_ROW] = 12,
+        [LV_STYLE_PAD_COLUMN] = 13,
+        [LV_STYLE_LINE_COLOR] = 14,
+        [LV_STYLE_LINE_WIDTH] = 15,
+    },
+};
+
+static const lv_style_prop_t outline_primary_props[] = {
+    LV_STYLE_OUTLINE_COLOR, LV_STYLE_OUTLINE_WIDTH, LV_STYLE_OUTLINE_PAD, LV_STYLE_OUTLINE_OPA,
+};
+
+static const lv_style_prop_table_t outline_primary_prop_table = {
+    .props = outline_primary_props,
+    .const_props = NULL,
+    .prop_cnt = 4,
+    .prop_index = {
+        [LV_STYLE_OUTLINE_COLOR] = 1,
+        [LV_STYLE_OUTLINE_WIDTH] = 2,
+        [LV_STYLE_OUTLINE_PAD] = 3,
+        [LV_STYLE_OUTLINE_OPA] = 4,
+    },
+};
+
+static const lv_style_prop_t outline_secondary_props[] = {
+    LV_STYLE_OUTLINE_COLOR, LV_STYLE_OUTLINE_WIDTH, LV_STYLE_OUTLINE_OPA,
+};
+
+static const lv_style_prop_table_t outline_secondary_prop_table = {
+    .props = outline_secondary_props,
+    .const_props = NULL,
+    .prop_cnt = 3,
+    .prop_index = {
+        [LV_STYLE_OUTLINE_COLOR] = 1,
+        [LV_STYLE_OUTLINE_WIDTH] = 2,
+        [LV_STYLE_OUTLINE_OPA] = 3,
+    },
+};
+
+static const lv_style_prop_t btn_props[] = {
+    LV_STYLE_RADIUS, LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR, LV_STYLE_SHADOW_COLOR,
+    LV_STYLE_SHADOW_WIDTH, LV_STYLE_SHADOW_OPA, LV_STYLE_SHADOW_OFFSET_Y, LV_STYLE_TEXT_COLOR,
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_PAD_COLUMN, LV_STYLE_PAD_ROW,
+};
+
+static const lv_style_prop_table_t btn_prop_table = {
+    .props = btn_props,
+    .const_props = NULL,
+    .prop_cnt = 14,
+    .prop_index = {
+        [LV_STYLE_RADIUS] = 1,
+        [LV_STYLE_BG_OPA] = 2,
+        [LV_STYLE_BG_COLOR] = 3,
+        [LV_STYLE_SHADOW_COLOR] = 4,
+        [LV_STYLE_SHADOW_WIDTH] = 5,
+        [LV_STYLE_SHADOW_OPA] = 6,
+        [LV_STYLE_SHADOW_OFFSET_Y] = 7,
+        [LV_STYLE_TEXT_COLOR] = 8,
+        [LV_STYLE_PAD_LEFT] = 9,
+        [LV_STYLE_PAD_RIGHT] = 10,
+        [LV_STYLE_PAD_TOP] = 11,
+        [LV_STYLE_PAD_BOTTOM] = 12,
+        [LV_STYLE_PAD_COLUMN] = 13,
+        [LV_STYLE_PAD_ROW] = 14,
+    },
+};
+
+static const lv_style_prop_t pressed_props[] = {
+    LV_STYLE_RECOLOR, LV_STYLE_RECOLOR_OPA,
+};
+
+static const lv_style_prop_table_t pressed_prop_table = {
+    .props = pressed_props,
+    .const_props = NULL,
+    .prop_cnt = 2,
+    .prop_index = {
+        [LV_STYLE_RECOLOR] = 1,
+        [LV_STYLE_RECOLOR_OPA] = 2,
+    },
+};
+
+static const lv_style_prop_t disabled_props[] = {
+    LV_STYLE_RECOLOR, LV_STYLE_RECOLOR_OPA,
+};
+
+static const lv_style_prop_table_t disabled_prop_table = {
+    .props = disabled_props,
+    .const_props = NULL,
+    .prop_cnt = 2,
+    .prop_index = {
+        [LV_STYLE_RECOLOR] = 1,
+        [LV_STYLE_RECOLOR_OPA] = 2,
+    },
+};
+
+static const lv_style_prop_t clip_corner_props[] = {
+    LV_STYLE_CLIP_CORNER, LV_STYLE_BORDER_POST,
+};
+
+static const lv_style_prop_table_t clip_corner_prop_table = {
+    .props = clip_corner_props,
+    .const_props = NULL,
+    .prop_cnt = 2,
+    .prop_index = {
+        [LV_STYLE_CLIP_CORNER] = 1,
+        [LV_STYLE_BORDER_POST] = 2,
+    },
+};
+
+static const lv_style_prop_t pad_normal_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN,
+};
+
+static const lv_style_prop_table_t pad_normal_prop_table = {
+    .props = pad_normal_props,
+    .const_props = NULL,
+    .prop_cnt = 6,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_PAD_ROW] = 5,
+        [LV_STYLE_PAD_COLUMN] = 6,
+    },
+};
+
+static const lv_style_prop_t pad_small_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN,
+};
+
+static const lv_style_prop_table_t pad_small_prop_table = {
+    .props = pad_small_props,
+    .const_props = NULL,
+    .prop_cnt = 6,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_PAD_ROW] = 5,
+        [LV_STYLE_PAD_COLUMN] = 6,
+    },
+};
+
+static const lv_style_prop_t pad_gap_props[] = {
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN,
+};
+
+static const lv_style_prop_table_t pad_gap_prop_table = {
+    .props = pad_gap_props,
+    .const_props = NULL,
+    .prop_cnt = 2,
+    .prop_index = {
+        [LV_STYLE_PAD_ROW] = 1,
+        [LV_STYLE_PAD_COLUMN] = 2,
+    },
+};
+
+static const lv_style_prop_t line_space_large_props[] = {
+    LV_STYLE_TEXT_LINE_SPACE,
+};
+
+static const lv_style_prop_table_t line_space_large_prop_table = {
+    .props = line_space_large_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_TEXT_LINE_SPACE] = 1,
+    },
+};
+
+static const lv_style_prop_t text_align_center_props[] = {
+    LV_STYLE_TEXT_ALIGN,
+};
+
+static const lv_style_prop_table_t text_align_center_prop_table = {
+    .props = text_align_center_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_TEXT_ALIGN] = 1,
+    },
+};
+
+static const lv_style_prop_t pad_zero_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN,
+};
+
+static const lv_style_prop_table_t pad_zero_prop_table = {
+    .props = pad_zero_props,
+    .const_props = NULL,
+    .prop_cnt = 6,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_PAD_ROW] = 5,
+        [LV_STYLE_PAD_COLUMN] = 6,
+    },
+};
+
+static const lv_style_prop_t pad_tiny_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN,
+};
+
+static const lv_style_prop_table_t pad_tiny_prop_table = {
+    .props = pad_tiny_props,
+    .const_props = NULL,
+    .prop_cnt = 6,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_PAD_ROW] = 5,
+        [LV_STYLE_PAD_COLUMN] = 6,
+    },
+};
+
+static const lv_style_prop_t bg_color_primary_props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_TEXT_COLOR, LV_STYLE_BG_OPA,
+};
+
+static const lv_style_prop_table_t bg_color_primary_prop_table = {
+    .props = bg_color_primary_props,
+    .const_props = NULL,
+    .prop_cnt = 3,
+    .prop_index = {
+        [LV_STYLE_BG_COLOR] = 1,
+        [LV_STYLE_TEXT_COLOR] = 2,
+        [LV_STYLE_BG_OPA] = 3,
+    },
+};
+
+static const lv_style_prop_t bg_color_primary_muted_props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_TEXT_COLOR, LV_STYLE_BG_OPA,
+};
+
+static const lv_style_prop_table_t bg_color_primary_muted_prop_table = {
+    .props = bg_color_primary_muted_props,
+    .const_props = NULL,
+    .prop_cnt = 3,
+    .prop_index = {
+        [LV_STYLE_BG_COLOR] = 1,
+        [LV_STYLE_TEXT_COLOR] = 2,
+        [LV_STYLE_BG_OPA] = 3,
+    },
+};
+
+static const lv_style_prop_t bg_color_secondary_props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_TEXT_COLOR, LV_STYLE_BG_OPA,
+};
+
+static const lv_style_prop_table_t bg_color_secondary_prop_table = {
+    .props = bg_color_secondary_props,
+    .const_props = NULL,
+    .prop_cnt = 3,
+    .prop_index = {
+        [LV_STYLE_BG_COLOR] = 1,
+        [LV_STYLE_TEXT_COLOR] = 2,
+        [LV_STYLE_BG_OPA] = 3,
+    },
+};
+
+static const lv_style_prop_t bg_color_secondary_muted_props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_TEXT_COLOR, LV_STYLE_BG_OPA,
+};
+
+static const lv_style_prop_table_t bg_color_secondary_muted_prop_table = {
+    .props = bg_color_secondary_muted_props,
+    .const_props = NULL,
+    .prop_cnt = 3,
+    .prop_index = {
+        [LV_STYLE_BG_COLOR] = 1,
+        [LV_STYLE_TEXT_COLOR] = 2,
+        [LV_STYLE_BG_OPA] = 3,
+    },
+};
+
+static const lv_style_prop_t bg_color_grey_props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_BG_OPA, LV_STYLE_TEXT_COLOR,
+};
+
+static const lv_style_prop_table_t bg_color_grey_prop_table = {
+    .props = bg_color_grey_props,
+    .const_props = NULL,
+    .prop_cnt = 3,
+    .prop_index = {
+        [LV_STYLE_BG_COLOR] = 1,
+        [LV_STYLE_BG_OPA] = 2,
+        [LV_STYLE_TEXT_COLOR] = 3,
+    },
+};
+
+static const lv_style_prop_t bg_color_white_props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_BG_OPA, LV_STYLE_TEXT_COLOR,
+};
+
+static const lv_style_prop_table_t bg_color_white_prop_table = {
+    .props = bg_color_white_props,
+    .const_props = NULL,
+    .prop_cnt = 3,
+    .prop_index = {
+        [LV_STYLE_BG_COLOR] = 1,
+        [LV_STYLE_BG_OPA] = 2,
+        [LV_STYLE_TEXT_COLOR] = 3,
+    },
+};
+
+static const lv_style_prop_t circle_props[] = {
+    LV_STYLE_RADIUS,
+};
+
+static const lv_style_prop_table_t circle_prop_table = {
+    .props = circle_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_RADIUS] = 1,
+    },
+};
+
+static const lv_style_prop_t no_radius_props[] = {
+    LV_STYLE_RADIUS,
+};
+
+static const lv_style_prop_table_t no_radius_prop_table = {
+    .props = no_radius_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_RADIUS] = 1,
+    },
+};
+
+static const lv_style_prop_t rotary_scroll_props[] = {
+    LV_STYLE_ROTARY_SENSITIVITY,
+};
+
+static const lv_style_prop_table_t rotary_scroll_prop_table = {
+    .props = rotary_scroll_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_ROTARY_SENSITIVITY] = 1,
+    },
+};
+
+static const lv_style_prop_t grow_props[] = {
+    LV_STYLE_TRANSFORM_WIDTH, LV_STYLE_TRANSFORM_HEIGHT,
+};
+
+static const lv_style_prop_table_t grow_prop_table = {
+    .props = grow_props,
+    .const_props = NULL,
+    .prop_cnt = 2,
+    .prop_index = {
+        [LV_STYLE_TRANSFORM_WIDTH] = 1,
+        [LV_STYLE_TRANSFORM_HEIGHT] = 2,
+    },
+};
+
+static const lv_style_prop_t knob_props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_BG_OPA, LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT,
+    LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM, LV_STYLE_RADIUS,
+};
+
+static const lv_style_prop_table_t knob_prop_table = {
+    .props = knob_props,
+    .const_props = NULL,
+    .prop_cnt = 7,
+    .prop_index = {
+        [LV_STYLE_BG_COLOR] = 1,
+        [LV_STYLE_BG_OPA] = 2,
+        [LV_STYLE_PAD_LEFT] = 3,
+        [LV_STYLE_PAD_RIGHT] = 4,
+        [LV_STYLE_PAD_TOP] = 5,
+        [LV_STYLE_PAD_BOTTOM] = 6,
+        [LV_STYLE_RADIUS] = 7,
+    },
+};
+
+static const lv_style_prop_t anim_props[] = {
+    LV_STYLE_ANIM_DURATION,
+};
+
+static const lv_style_prop_table_t anim_prop_table = {
+    .props = anim_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_ANIM_DURATION] = 1,
+    },
+};
+
+static const lv_style_prop_t anim_fast_props[] = {
+    LV_STYLE_ANIM_DURATION,
+};
+
+static const lv_style_prop_table_t anim_fast_prop_table = {
+    .props = anim_fast_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_ANIM_DURATION] = 1,
+    },
+};
+
+static const lv_style_prop_t arc_indic_props[] = {
+    LV_STYLE_ARC_COLOR, LV_STYLE_ARC_WIDTH, LV_STYLE_ARC_ROUNDED,
+};
+
+static const lv_style_prop_table_t arc_indic_prop_table = {
+    .props = arc_indic_props,
+    .const_props = NULL,
+    .prop_cnt = 3,
+    .prop_index = {
+        [LV_STYLE_ARC_COLOR] = 1,
+        [LV_STYLE_ARC_WIDTH] = 2,
+        [LV_STYLE_ARC_ROUNDED] = 3,
+    },
+};
+
+static const lv_style_prop_t arc_indic_primary_props[] = {
+    LV_STYLE_ARC_COLOR,
+};
+
+static const lv_style_prop_table_t arc_indic_primary_prop_table = {
+    .props = arc_indic_primary_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_ARC_COLOR] = 1,
+    },
+};
+
+static const lv_style_prop_t dropdown_list_props[] = {
+    LV_STYLE_MAX_HEIGHT,
+};
+
+static const lv_style_prop_table_t dropdown_list_prop_table = {
+    .props = dropdown_list_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_MAX_HEIGHT] = 1,
+    },
+};
+
+static const lv_style_prop_t cb_marker_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_COLOR, LV_STYLE_BG_COLOR, LV_STYLE_BG_OPA,
+    LV_STYLE_RADIUS, LV_STYLE_TEXT_FONT, LV_STYLE_TEXT_COLOR,
+};
+
+static const lv_style_prop_table_t cb_marker_prop_table = {
+    .props = cb_marker_props,
+    .const_props = NULL,
+    .prop_cnt = 11,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_BORDER_WIDTH] = 5,
+        [LV_STYLE_BORDER_COLOR] = 6,
+        [LV_STYLE_BG_COLOR] = 7,
+        [LV_STYLE_BG_OPA] = 8,
+        [LV_STYLE_RADIUS] = 9,
+        [LV_STYLE_TEXT_FONT] = 10,
+        [LV_STYLE_TEXT_COLOR] = 11,
+    },
+};
+
+static const lv_style_prop_t cb_marker_checked_props[] = {
+    LV_STYLE_BG_IMAGE_SRC,
+};
+
+static const lv_style_prop_table_t cb_marker_checked_prop_table = {
+    .props = cb_marker_checked_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_BG_IMAGE_SRC] = 1,
+    },
+};
+
+static const lv_style_prop_t switch_knob_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_BG_COLOR,
+};
+
+static const lv_style_prop_table_t switch_knob_prop_table = {
+    .props = switch_knob_props,
+    .const_props = NULL,
+    .prop_cnt = 5,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_BG_COLOR] = 5,
+    },
+};
+
+static const lv_style_prop_t line_props[] = {
+    LV_STYLE_LINE_WIDTH, LV_STYLE_LINE_COLOR,
+};
+
+static const lv_style_prop_table_t line_prop_table = {
+    .props = line_props,
+    .const_props = NULL,
+    .prop_cnt = 2,
+    .prop_index = {
+        [LV_STYLE_LINE_WIDTH] = 1,
+        [LV_STYLE_LINE_COLOR] = 2,
+    },
+};
+
+static const lv_style_prop_t chart_bg_props[] = {
+    LV_STYLE_BORDER_POST, LV_STYLE_PAD_COLUMN, LV_STYLE_LINE_COLOR,
+};
+
+static const lv_style_prop_table_t chart_bg_prop_table = {
+    .props = chart_bg_props,
+    .const_props = NULL,
+    .prop_cnt = 3,
+    .prop_index = {
+        [LV_STYLE_BORDER_POST] = 1,
+        [LV_STYLE_PAD_COLUMN] = 2,
+        [LV_STYLE_LINE_COLOR] = 3,
+    },
+};
+
+static const lv_style_prop_t chart_series_props[] = {
+    LV_STYLE_LINE_WIDTH, LV_STYLE_RADIUS, LV_STYLE_WIDTH, LV_STYLE_HEIGHT,
+    LV_STYLE_PAD_COLUMN,
+};
+
+static const lv_style_prop_table_t chart_series_prop_table = {
+    .props = chart_series_props,
+    .const_props = NULL,
+    .prop_cnt = 5,
+    .prop_index = {
+        [LV_STYLE_LINE_WIDTH] = 1,
+        [LV_STYLE_RADIUS] = 2,
+        [LV_STYLE_WIDTH] = 3,
+        [LV_STYLE_HEIGHT] = 4,
+        [LV_STYLE_PAD_COLUMN] = 5,
+    },
+};
+
+static const lv_style_prop_t chart_indic_props[] = {
+    LV_STYLE_RADIUS, LV_STYLE_WIDTH, LV_STYLE_HEIGHT, LV_STYLE_BG_COLOR,
+    LV_STYLE_BG_OPA,
+};
+
+static const lv_style_prop_table_t chart_indic_prop_table = {
+    .props = chart_indic_props,
+    .const_props = NULL,
+    .prop_cnt = 5,
+    .prop_index = {
+        [LV_STYLE_RADIUS] = 1,
+        [LV_STYLE_WIDTH] = 2,
+        [LV_STYLE_HEIGHT] = 3,
+        [LV_STYLE_BG_COLOR] = 4,
+        [LV_STYLE_BG_OPA] = 5,
+    },
+};
+
+static const lv_style_prop_t menu_bg_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN, LV_STYLE_RADIUS, LV_STYLE_CLIP_CORNER,
+    LV_STYLE_BORDER_SIDE,
+};
+
+static const lv_style_prop_table_t menu_bg_prop_table = {
+    .props = menu_bg_props,
+    .const_props = NULL,
+    .prop_cnt = 9,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_PAD_ROW] = 5,
+        [LV_STYLE_PAD_COLUMN] = 6,
+        [LV_STYLE_RADIUS] = 7,
+        [LV_STYLE_CLIP_CORNER] = 8,
+        [LV_STYLE_BORDER_SIDE] = 9,
+    },
+};
+
+static const lv_style_prop_t menu_section_props[] = {
+    LV_STYLE_RADIUS, LV_STYLE_CLIP_CORNER, LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR,
+    LV_STYLE_TEXT_COLOR,
+};
+
+static const lv_style_prop_table_t menu_section_prop_table = {
+    .props = menu_section_props,
+    .const_props = NULL,
+    .prop_cnt = 5,
+    .prop_index = {
+        [LV_STYLE_RADIUS] = 1,
+        [LV_STYLE_CLIP_CORNER] = 2,
+        [LV_STYLE_BG_OPA] = 3,
+        [LV_STYLE_BG_COLOR] = 4,
+        [LV_STYLE_TEXT_COLOR] = 5,
+    },
+};
+
+static const lv_style_prop_t menu_cont_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN, LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_OPA,
+    LV_STYLE_BORDER_COLOR, LV_STYLE_BORDER_SIDE,
+};
+
+static const lv_style_prop_table_t menu_cont_prop_table = {
+    .props = menu_cont_props,
+    .const_props = NULL,
+    .prop_cnt = 10,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_PAD_ROW] = 5,
+        [LV_STYLE_PAD_COLUMN] = 6,
+        [LV_STYLE_BORDER_WIDTH] = 7,
+        [LV_STYLE_BORDER_OPA] = 8,
+        [LV_STYLE_BORDER_COLOR] = 9,
+        [LV_STYLE_BORDER_SIDE] = 10,
+    },
+};
+
+static const lv_style_prop_t menu_sidebar_cont_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN, LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_OPA,
+    LV_STYLE_BORDER_COLOR, LV_STYLE_BORDER_SIDE,
+};
+
+static const lv_style_prop_table_t menu_sidebar_cont_prop_table = {
+    .props = menu_sidebar_cont_props,
+    .const_props = NULL,
+    .prop_cnt = 10,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_PAD_ROW] = 5,
+        [LV_STYLE_PAD_COLUMN] = 6,
+        [LV_STYLE_BORDER_WIDTH] = 7,
+        [LV_STYLE_BORDER_OPA] = 8,
+        [LV_STYLE_BORDER_COLOR] = 9,
+        [LV_STYLE_BORDER_SIDE] = 10,
+    },
+};
+
+static const lv_style_prop_t menu_main_cont_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN,
+};
+
+static const lv_style_prop_table_t menu_main_cont_prop_table = {
+    .props = menu_main_cont_props,
+    .const_props = NULL,
+    .prop_cnt = 6,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_PAD_ROW] = 5,
+        [LV_STYLE_PAD_COLUMN] = 6,
+    },
+};
+
+static const lv_style_prop_t menu_header_cont_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN,
+};
+
+static const lv_style_prop_table_t menu_header_cont_prop_table = {
+    .props = menu_header_cont_props,
+    .const_props = NULL,
+    .prop_cnt = 6,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_PAD_ROW] = 5,
+        [LV_STYLE_PAD_COLUMN] = 6,
+    },
+};
+
+static const lv_style_prop_t menu_header_btn_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_SHADOW_OPA, LV_STYLE_BG_OPA, LV_STYLE_TEXT_COLOR,
+};
+
+static const lv_style_prop_table_t menu_header_btn_prop_table = {
+    .props = menu_header_btn_props,
+    .const_props = NULL,
+    .prop_cnt = 7,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_SHADOW_OPA] = 5,
+        [LV_STYLE_BG_OPA] = 6,
+        [LV_STYLE_TEXT_COLOR] = 7,
+    },
+};
+
+static const lv_style_prop_t menu_page_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN,
+};
+
+static const lv_style_prop_table_t menu_page_prop_table = {
+    .props = menu_page_props,
+    .const_props = NULL,
+    .prop_cnt = 4,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_ROW] = 3,
+        [LV_STYLE_PAD_COLUMN] = 4,
+    },
+};
+
+static const lv_style_prop_t menu_pressed_props[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR,
+};
+
+static const lv_style_prop_table_t menu_pressed_prop_table = {
+    .props = menu_pressed_props,
+    .const_props = NULL,
+    .prop_cnt = 2,
+    .prop_index = {
+        [LV_STYLE_BG_OPA] = 1,
+        [LV_STYLE_BG_COLOR] = 2,
+    },
+};
+
+static const lv_style_prop_t menu_separator_props[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+};
+
+static const lv_style_prop_table_t menu_separator_prop_table = {
+    .props = menu_separator_props,
+    .const_props = NULL,
+    .prop_cnt = 3,
+    .prop_index = {
+        [LV_STYLE_BG_OPA] = 1,
+        [LV_STYLE_PAD_TOP] = 2,
+        [LV_STYLE_PAD_BOTTOM] = 3,
+    },
+};
+
+static const lv_style_prop_t table_cell_props[] = {
+    LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_COLOR, LV_STYLE_BORDER_SIDE,
+};
+
+static const lv_style_prop_table_t table_cell_prop_table = {
+    .props = table_cell_props,
+    .const_props = NULL,
+    .prop_cnt = 3,
+    .prop_index = {
+        [LV_STYLE_BORDER_WIDTH] = 1,
+        [LV_STYLE_BORDER_COLOR] = 2,
+        [LV_STYLE_BORDER_SIDE] = 3,
+    },
+};
+
+static const lv_style_prop_t ta_cursor_props[] = {
+    LV_STYLE_BORDER_COLOR, LV_STYLE_BORDER_WIDTH, LV_STYLE_PAD_LEFT, LV_STYLE_BORDER_SIDE,
+    LV_STYLE_ANIM_DURATION,
+};
+
+static const lv_style_prop_table_t ta_cursor_prop_table = {
+    .props = ta_cursor_props,
+    .const_props = NULL,
+    .prop_cnt = 5,
+    .prop_index = {
+        [LV_STYLE_BORDER_COLOR] = 1,
+        [LV_STYLE_BORDER_WIDTH] = 2,
+        [LV_STYLE_PAD_LEFT] = 3,
+        [LV_STYLE_BORDER_SIDE] = 4,
+        [LV_STYLE_ANIM_DURATION] = 5,
+    },
+};
+
+static const lv_style_prop_t ta_placeholder_props[] = {
+    LV_STYLE_TEXT_COLOR,
+};
+
+static const lv_style_prop_table_t ta_placeholder_prop_table = {
+    .props = ta_placeholder_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_TEXT_COLOR] = 1,
+    },
+};
+
+static const lv_style_prop_t calendar_btnm_bg_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN,
+};
+
+static const lv_style_prop_table_t calendar_btnm_bg_prop_table = {
+    .props = calendar_btnm_bg_props,
+    .const_props = NULL,
+    .prop_cnt = 6,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_PAD_ROW] = 5,
+        [LV_STYLE_PAD_COLUMN] = 6,
+    },
+};
+
+static const lv_style_prop_t calendar_btnm_day_props[] = {
+    LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_COLOR, LV_STYLE_BG_COLOR, LV_STYLE_BG_OPA,
+};
+
+static const lv_style_prop_table_t calendar_btnm_day_prop_table = {
+    .props = calendar_btnm_day_props,
+    .const_props = NULL,
+    .prop_cnt = 4,
+    .prop_index = {
+        [LV_STYLE_BORDER_WIDTH] = 1,
+        [LV_STYLE_BORDER_COLOR] = 2,
+        [LV_STYLE_BG_COLOR] = 3,
+        [LV_STYLE_BG_OPA] = 4,
+    },
+};
+
+static const lv_style_prop_t calendar_header_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN,
+};
+
+static const lv_style_prop_table_t calendar_header_prop_table = {
+    .props = calendar_header_props,
+    .const_props = NULL,
+    .prop_cnt = 6,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_PAD_ROW] = 5,
+        [LV_STYLE_PAD_COLUMN] = 6,
+    },
+};
+
+static const lv_style_prop_t msgbox_backdrop_bg_props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_BG_OPA,
+};
+
+static const lv_style_prop_table_t msgbox_backdrop_bg_prop_table = {
+    .props = msgbox_backdrop_bg_props,
+    .const_props = NULL,
+    .prop_cnt = 2,
+    .prop_index = {
+        [LV_STYLE_BG_COLOR] = 1,
+        [LV_STYLE_BG_OPA] = 2,
+    },
+};
+
+static const lv_style_prop_t keyboard_button_bg_props[] = {
+    LV_STYLE_SHADOW_WIDTH, LV_STYLE_RADIUS,
+};
+
+static const lv_style_prop_table_t keyboard_button_bg_prop_table = {
+    .props = keyboard_button_bg_props,
+    .const_props = NULL,
+    .prop_cnt = 2,
+    .prop_index = {
+        [LV_STYLE_SHADOW_WIDTH] = 1,
+        [LV_STYLE_RADIUS] = 2,
+    },
+};
+
+static const lv_style_prop_t tab_btn_props[] = {
+    LV_STYLE_BORDER_COLOR, LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_SIDE, LV_STYLE_PAD_TOP,
+};
+
+static const lv_style_prop_table_t tab_btn_prop_table = {
+    .props = tab_btn_props,
+    .const_props = NULL,
+    .prop_cnt = 4,
+    .prop_index = {
+        [LV_STYLE_BORDER_COLOR] = 1,
+        [LV_STYLE_BORDER_WIDTH] = 2,
+        [LV_STYLE_BORDER_SIDE] = 3,
+        [LV_STYLE_PAD_TOP] = 4,
+    },
+};
+
+static const lv_style_prop_t tab_bg_focus_props[] = {
+    LV_STYLE_OUTLINE_PAD,
+};
+
+static const lv_style_prop_table_t tab_bg_focus_prop_table = {
+    .props = tab_bg_focus_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_OUTLINE_PAD] = 1,
+    },
+};
+
+static const lv_style_prop_t list_bg_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN, LV_STYLE_CLIP_CORNER,
+};
+
+static const lv_style_prop_table_t list_bg_prop_table = {
+    .props = list_bg_props,
+    .const_props = NULL,
+    .prop_cnt = 7,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_PAD_ROW] = 5,
+        [LV_STYLE_PAD_COLUMN] = 6,
+        [LV_STYLE_CLIP_CORNER] = 7,
+    },
+};
+
+static const lv_style_prop_t list_btn_props[] = {
+    LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_COLOR, LV_STYLE_BORDER_SIDE, LV_STYLE_PAD_LEFT,
+    LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM, LV_STYLE_PAD_COLUMN,
+};
+
+static const lv_style_prop_table_t list_btn_prop_table = {
+    .props = list_btn_props,
+    .const_props = NULL,
+    .prop_cnt = 8,
+    .prop_index = {
+        [LV_STYLE_BORDER_WIDTH] = 1,
+        [LV_STYLE_BORDER_COLOR] = 2,
+        [LV_STYLE_BORDER_SIDE] = 3,
+        [LV_STYLE_PAD_LEFT] = 4,
+        [LV_STYLE_PAD_RIGHT] = 5,
+        [LV_STYLE_PAD_TOP] = 6,
+        [LV_STYLE_PAD_BOTTOM] = 7,
+        [LV_STYLE_PAD_COLUMN] = 8,
+    },
+};
+
+static const lv_style_prop_t list_item_grow_props[] = {
+    LV_STYLE_TRANSFORM_WIDTH,
+};
+
+static const lv_style_prop_table_t list_item_grow_prop_table = {
+    .props = list_item_grow_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_TRANSFORM_WIDTH] = 1,
+    },
+};
+
+static const lv_style_prop_t led_props[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR, LV_STYLE_BG_GRAD_COLOR, LV_STYLE_RADIUS,
+    LV_STYLE_SHADOW_WIDTH, LV_STYLE_SHADOW_COLOR, LV_STYLE_SHADOW_SPREAD,
+};
+
+static const lv_style_prop_table_t led_prop_table = {
+    .props = led_props,
+    .const_props = NULL,
+    .prop_cnt = 7,
+    .prop_index = {
+        [LV_STYLE_BG_OPA] = 1,
+        [LV_STYLE_BG_COLOR] = 2,
+        [LV_STYLE_BG_GRAD_COLOR] = 3,
+        [LV_STYLE_RADIUS] = 4,
+        [LV_STYLE_SHADOW_WIDTH] = 5,
+        [LV_STYLE_SHADOW_COLOR] = 6,
+        [LV_STYLE_SHADOW_SPREAD] = 7,
+    },
+};
+
+static const lv_style_prop_t scale_props[] = {
+    LV_STYLE_LINE_COLOR, LV_STYLE_LINE_WIDTH, LV_STYLE_ARC_COLOR, LV_STYLE_ARC_WIDTH,
+    LV_STYLE_LENGTH,
+};
+
+static const lv_style_prop_table_t scale_prop_table = {
+    .props = scale_props,
+    .const_props = NULL,
+    .prop_cnt = 5,
+    .prop_index = {
+        [LV_STYLE_LINE_COLOR] = 1,
+        [LV_STYLE_LINE_WIDTH] = 2,
+        [LV_STYLE_ARC_COLOR] = 3,
+        [LV_STYLE_ARC_WIDTH] = 4,
+        [LV_STYLE_LENGTH] = 5,
+    },
+};
+
+#endif /*LV_THEME_DEFAULT_STYLE_TABLES_H*/
@@ -24,6 +24,16 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/**
+ * The property table of a theme style generated by `scripts/style_table_gen.py`
+ * or NULL if `LV_USE_THEME_STYLE_TABLES` is disabled.
+ */
+#if LV_USE_THEME_STYLE_TABLES
+#define LV_THEME_STYLE_PROP_TABLE(name) (&name##_prop_table)
+#else
+#define LV_THEME_STYLE_PROP_TABLE(name) NULL
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -13,6 +13,9 @@
 
 #include "lv_theme_mono.h"
 #include "../../core/lv_global.h"
+#if LV_USE_THEME_STYLE_TABLES
+#include "lv_theme_mono_style_tables.h"
+#endif
 
 /*********************
  *      DEFINES
@@ -69,7 +72,7 @@ struct _my_theme_t {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static void style_init_reset(lv_style_t * style);
+static void style_init_reset(lv_style_t * style, const lv_style_prop_table_t * prop_table);
 static void theme_apply(lv_theme_t * th, lv_obj_t * obj);
 
 /**********************
@@ -86,12 +89,12 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj);
 
 static void style_init(my_theme_t * theme, bool dark_bg, const lv_font_t * font)
 {
-    style_init_reset(&theme->styles.scrollbar);
+    style_init_reset(&theme->styles.scrollbar, LV_THEME_STYLE_PROP_TABLE(scrollbar));
     lv_style_set_bg_opa(&theme->styles.scrollbar, LV_OPA_COVER);
     lv_style_set_bg_color(&theme->styles.scrollbar, COLOR_FG);
     lv_style_set_width(&theme->styles.scrollbar, PAD_DEF);
 
-    style_init_reset(&theme->styles.scr);
+    style_init_reset(&theme->styles.scr, LV_THEME_STYLE_PROP_TABLE(scr));
     lv_style_set_bg_opa(&theme->styles.scr, LV_OPA_COVER);
     lv_style_set_bg_color(&theme->styles.scr, COLOR_BG);
     lv_style_set_text_color(&theme->styles.scr, COLOR_FG);
@@ -99,7 +102,7 @@ static void style_init(my_theme_t * theme, bool dark_bg, const lv_font_t * font)
     lv_style_set_pad_column(&theme->styles.scr, PAD_DEF);
     lv_style_set_text_font(&theme->styles.scr, font);
 
-    style_init_reset(&theme->styles.card);
+    style_init_reset(&theme->styles.card, LV_THEME_STYLE_PROP_TABLE(card));
     lv_style_set_bg_opa(&theme->styles.card, LV_OPA_COVER);
     lv_style_set_bg_color(&theme->styles.card, COLOR_BG);
     lv_style_set_border_color(&theme->styles.card, COLOR_FG);
@@ -115,10 +118,10 @@ static void style_init(my_theme_t * theme, bool dark_bg, const lv_font_t * font)
     lv_style_set_outline_color(&theme->styles.card, COLOR_FG);
     lv_style_set_anim_duration(&theme->styles.card, 300);
 
-    style_init_reset(&theme->styles.pr);
+    style_init_reset(&theme->styles.pr, LV_THEME_STYLE_PROP_TABLE(pr));
     lv_style_set_border_width(&theme->styles.pr, BORDER_W_PR);
 
-    style_init_reset(&theme->styles.inv);
+    style_init_reset(&theme->styles.inv, LV_THEME_STYLE_PROP_TABLE(inv));
     lv_style_set_bg_opa(&theme->styles.inv, LV_OPA_COVER);
     lv_style_set_bg_color(&theme->styles.inv, COLOR_FG);
     lv_style_set_border_color(&theme->styles.inv, COLOR_BG);
@@ -127,40 +130,40 @@ static void style_init(my_theme_t * theme, bool dark_bg, const lv_font_t * font)
     lv_style_set_text_color(&theme->styles.inv, COLOR_BG);
     lv_style_set_outline_color(&theme->styles.inv, COLOR_BG);
 
-    style_init_reset(&theme->styles.disabled);
+    style_init_reset(&theme->styles.disabled, LV_THEME_STYLE_PROP_TABLE(disabled));
     lv_style_set_border_width(&theme->styles.disabled, BORDER_W_DIS);
 
-    style_init_reset(&theme->styles.focus);
+    style_init_reset(&theme->styles.focus, LV_THEME_STYLE_PROP_TABLE(focus));
     lv_style_set_outline_width(&theme->styles.focus, 1);
     lv_style_set_outline_pad(&theme->styles.focus, BORDER_W_FOCUS);
 
-    style_init_reset(&theme->styles.edit);
+    style_init_reset(&theme->styles.edit, LV_THEME_STYLE_PROP_TABLE(edit));
     lv_style_set_outline_width(&theme->styles.edit, BORDER_W_EDIT);
 
-    style_init_reset(&theme->styles.large_border);
+    style_init_reset(&theme->styles.large_border, LV_THEME_STYLE_PROP_TABLE(large_border));
     lv_style_set_border_width(&theme->styles.large_border, BORDER_W_EDIT);
 
-    style_init_reset(&theme->styles.pad_gap);
+    style_init_reset(&theme->styles.pad_gap, LV_THEME_STYLE_PROP_TABLE(pad_gap));
     lv_style_set_pad_gap(&theme->styles.pad_gap, PAD_DEF);
 
-    style_init_reset(&theme->styles.pad_zero);
+    style_init_reset(&theme->styles.pad_zero, LV_THEME_STYLE_PROP_TABLE(pad_zero));
     lv_style_set_pad_all(&theme->styles.pad_zero, 0);
     lv_style_set_pad_gap(&theme->styles.pad_zero, 0);
 
-    style_init_reset(&theme->styles.no_radius);
+    style_init_reset(&theme->styles.no_radius, LV_THEME_STYLE_PROP_TABLE(no_radius));
     lv_style_set_radius(&theme->styles.no_radius, 0);
 
-    style_init_reset(&theme->styles.radius_circle);
+    style_init_reset(&theme->styles.radius_circle, LV_THEME_STYLE_PROP_TABLE(radius_circle));
     lv_style_set_radius(&theme->styles.radius_circle, LV_RADIUS_CIRCLE);
 
-    style_init_reset(&theme->styles.large_line_space);
+    style_init_reset(&theme->styles.large_line_space, LV_THEME_STYLE_PROP_TABLE(large_line_space));
     lv_style_set_text_line_space(&theme->styles.large_line_space, 6);
 
-    style_init_reset(&theme->styles.underline);
+    style_init_reset(&theme->styles.underline, LV_THEME_STYLE_PROP_TABLE(underline));
     lv_style_set_text_decor(&theme->styles.underline, LV_TEXT_DECOR_UNDERLINE);
 
 #if LV_USE_TEXTAREA
-    style_init_reset(&theme->styles.ta_cursor);
+    style_init_reset(&theme->styles.ta_cursor, LV_THEME_STYLE_PROP_TABLE(ta_cursor));
     lv_style_set_border_side(&theme->styles.ta_cursor, LV_BORDER_SIDE_LEFT);
     lv_style_set_border_color(&theme->styles.ta_cursor, COLOR_FG);
     lv_style_set_border_width(&theme->styles.ta_cursor, 2);
@@ -169,7 +172,7 @@ static void style_init(my_theme_t * theme, bool dark_bg, const lv_font_t * font)
 #endif
 
 #if LV_USE_CHART
-    style_init_reset(&theme->styles.chart_indic);
+    style_init_reset(&theme->styles.chart_indic, LV_THEME_STYLE_PROP_TABLE(chart_indic));
     lv_style_set_radius(&theme->styles.chart_indic, LV_RADIUS_CIRCLE);
     lv_style_set_size(&theme->styles.chart_indic, lv_display_dpx(theme->base.disp, 8), lv_display_dpx(theme->base.disp, 8));
     lv_style_set_bg_color(&theme->styles.chart_indic, COLOR_FG);
@@ -517,6 +520,12 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
         return;
     }
 #endif
+#if LV_USE_RECYCLERVIEW
+    else if(lv_obj_check_type(obj, &lv_recyclerview_class)) {
+        lv_obj_add_style(obj, &theme->styles.card, 0);
+        lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    }
+#endif
 
 #if LV_USE_SPINBOX
     else if(lv_obj_check_type(obj, &lv_spinbox_class)) {
@@ -543,14 +552,18 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
 #endif
 }
 
-static void style_init_reset(lv_style_t * style)
+static void style_init_reset(lv_style_t * style, const lv_style_prop_table_t * prop_table)
 {
     if(lv_theme_mono_is_inited()) {
         lv_style_reset(style);
     }
-    else {
-        lv_style_init(style);
-    }
+
+#if LV_USE_THEME_STYLE_TABLES
+    lv_style_init_table(style, prop_table);
+#else
+    LV_UNUSED(prop_table);
+    lv_style_init(style);
+#endif
 }
 
 #endif
@@ -0,0 +1,287 @@
+/*
+ **********************************************************************
+ *                            DO NOT EDIT
+ * This file is automatically generated by "style_table_gen.py"
+ * from "lv_theme_mono.c"
+ **********************************************************************
+ */
+
+#ifndef LV_THEME_MONO_STYLE_TABLES_H
+#define LV_THEME_MONO_STYLE_TABLES_H
+
+static const lv_style_prop_t scrollbar_props[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR, LV_STYLE_WIDTH,
+};
+
+static const lv_style_prop_table_t scrollbar_prop_table = {
+    .props = scrollbar_props,
+    .const_props = NULL,
+    .prop_cnt = 3,
+    .prop_index = {
+        [LV_STYLE_BG_OPA] = 1,
+        [LV_STYLE_BG_COLOR] = 2,
+        [LV_STYLE_WIDTH] = 3,
+    },
+};
+
+static const lv_style_prop_t scr_props[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR, LV_STYLE_TEXT_COLOR, LV_STYLE_PAD_ROW,
+    LV_STYLE_PAD_COLUMN, LV_STYLE_TEXT_FONT,
+};
+
+static const lv_style_prop_table_t scr_prop_table = {
+    .props = scr_props,
+    .const_props = NULL,
+    .prop_cnt = 6,
+    .prop_index = {
+        [LV_STYLE_BG_OPA] = 1,
+        [LV_STYLE_BG_COLOR] = 2,
+        [LV_STYLE_TEXT_COLOR] = 3,
+        [LV_STYLE_PAD_ROW] = 4,
+        [LV_STYLE_PAD_COLUMN] = 5,
+        [LV_STYLE_TEXT_FONT] = 6,
+    },
+};
+
+static const lv_style_prop_t card_props[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR, LV_STYLE_BORDER_COLOR, LV_STYLE_RADIUS,
+    LV_STYLE_BORDER_WIDTH, LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP,
+    LV_STYLE_PAD_BOTTOM, LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN, LV_STYLE_TEXT_COLOR,
+    LV_STYLE_LINE_WIDTH, LV_STYLE_LINE_COLOR, LV_STYLE_ARC_WIDTH, LV_STYLE_ARC_COLOR,
+    LV_STYLE_OUTLINE_COLOR, LV_STYLE_ANIM_DURATION,
+};
+
+static const lv_style_prop_table_t card_prop_table = {
+    .props = card_props,
+    .const_props = NULL,
+    .prop_cnt = 18,
+    .prop_index = {
+        [LV_STYLE_BG_OPA] = 1,
+        [LV_STYLE_BG_COLOR] = 2,
+        [LV_STYLE_BORDER_COLOR] = 3,
+        [LV_STYLE_RADIUS] = 4,
+        [LV_STYLE_BORDER_WIDTH] = 5,
+        [LV_STYLE_PAD_LEFT] = 6,
+        [LV_STYLE_PAD_RIGHT] = 7,
+        [LV_STYLE_PAD_TOP] = 8,
+        [LV_STYLE_PAD_BOTTOM] = 9,
+        [LV_STYLE_PAD_ROW] = 10,
+        [LV_STYLE_PAD_COLUMN] = 11,
+        [LV_STYLE_TEXT_COLOR] = 12,
+        [LV_STYLE_LINE_WIDTH] = 13,
+        [LV_STYLE_LINE_COLOR] = 14,
+        [LV_STYLE_ARC_WIDTH] = 15,
+        [LV_STYLE_ARC_COLOR] = 16,
+        [LV_STYLE_OUTLINE_COLOR] = 17,
+        [LV_STYLE_ANIM_DURATION] = 18,
+    },
+};
+
+static const lv_style_prop_t pr_props[] = {
+    LV_STYLE_BORDER_WIDTH,
+};
+
+static const lv_style_prop_table_t pr_prop_table = {
+    .props = pr_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_BORDER_WIDTH] = 1,
+    },
+};
+
+static const lv_style_prop_t inv_props[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR, LV_STYLE_BORDER_COLOR, LV_STYLE_LINE_COLOR,
+    LV_STYLE_ARC_COLOR, LV_STYLE_TEXT_COLOR, LV_STYLE_OUTLINE_COLOR,
+};
+
+static const lv_style_prop_table_t inv_prop_table = {
+    .props = inv_props,
+    .const_props = NULL,
+    .prop_cnt = 7,
+    .prop_index = {
+        [LV_STYLE_BG_OPA] = 1,
+        [LV_STYLE_BG_COLOR] = 2,
+        [LV_STYLE_BORDER_COLOR] = 3,
+        [LV_STYLE_LINE_COLOR] = 4,
+        [LV_STYLE_ARC_COLOR] = 5,
+        [LV_STYLE_TEXT_COLOR] = 6,
+        [LV_STYLE_OUTLINE_COLOR] = 7,
+    },
+};
+
+static const lv_style_prop_t disabled_props[] = {
+    LV_STYLE_BORDER_WIDTH,
+};
+
+static const lv_style_prop_table_t disabled_prop_table = {
+    .props = disabled_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_BORDER_WIDTH] = 1,
+    },
+};
+
+static const lv_style_prop_t focus_props[] = {
+    LV_STYLE_OUTLINE_WIDTH, LV_STYLE_OUTLINE_PAD,
+};
+
+static const lv_style_prop_table_t focus_prop_table = {
+    .props = focus_props,
+    .const_props = NULL,
+    .prop_cnt = 2,
+    .prop_index = {
+        [LV_STYLE_OUTLINE_WIDTH] = 1,
+        [LV_STYLE_OUTLINE_PAD] = 2,
+    },
+};
+
+static const lv_style_prop_t edit_props[] = {
+    LV_STYLE_OUTLINE_WIDTH,
+};
+
+static const lv_style_prop_table_t edit_prop_table = {
+    .props = edit_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_OUTLINE_WIDTH] = 1,
+    },
+};
+
+static const lv_style_prop_t large_border_props[] = {
+    LV_STYLE_BORDER_WIDTH,
+};
+
+static const lv_style_prop_table_t large_border_prop_table = {
+    .props = large_border_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_BORDER_WIDTH] = 1,
+    },
+};
+
+static const lv_style_prop_t pad_gap_props[] = {
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN,
+};
+
+static const lv_style_prop_table_t pad_gap_prop_table = {
+    .props = pad_gap_props,
+    .const_props = NULL,
+    .prop_cnt = 2,
+    .prop_index = {
+        [LV_STYLE_PAD_ROW] = 1,
+        [LV_STYLE_PAD_COLUMN] = 2,
+    },
+};
+
+static const lv_style_prop_t pad_zero_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN,
+};
+
+static const lv_style_prop_table_t pad_zero_prop_table = {
+    .props = pad_zero_props,
+    .const_props = NULL,
+    .prop_cnt = 6,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_PAD_ROW] = 5,
+        [LV_STYLE_PAD_COLUMN] = 6,
+    },
+};
+
+static const lv_style_prop_t no_radius_props[] = {
+    LV_STYLE_RADIUS,
+};
+
+static const lv_style_prop_table_t no_radius_prop_table = {
+    .props = no_radius_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_RADIUS] = 1,
+    },
+};
+
+static const lv_style_prop_t radius_circle_props[] = {
+    LV_STYLE_RADIUS,
+};
+
+static const lv_style_prop_table_t radius_circle_prop_table = {
+    .props = radius_circle_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_RADIUS] = 1,
+    },
+};
+
+static const lv_style_prop_t large_line_space_props[] = {
+    LV_STYLE_TEXT_LINE_SPACE,
+};
+
+static const lv_style_prop_table_t large_line_space_prop_table = {
+    .props = large_line_space_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_TEXT_LINE_SPACE] = 1,
+    },
+};
+
+static const lv_style_prop_t underline_props[] = {
+    LV_STYLE_TEXT_DECOR,
+};
+
+static const lv_style_prop_table_t underline_prop_table = {
+    .props = underline_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_TEXT_DECOR] = 1,
+    },
+};
+
+static const lv_style_prop_t ta_cursor_props[] = {
+    LV_STYLE_BORDER_SIDE, LV_STYLE_BORDER_COLOR, LV_STYLE_BORDER_WIDTH, LV_STYLE_BG_OPA,
+    LV_STYLE_ANIM_DURATION,
+};
+
+static const lv_style_prop_table_t ta_cursor_prop_table = {
+    .props = ta_cursor_props,
+    .const_props = NULL,
+    .prop_cnt = 5,
+    .prop_index = {
+        [LV_STYLE_BORDER_SIDE] = 1,
+        [LV_STYLE_BORDER_COLOR] = 2,
+        [LV_STYLE_BORDER_WIDTH] = 3,
+        [LV_STYLE_BG_OPA] = 4,
+        [LV_STYLE_ANIM_DURATION] = 5,
+    },
+};
+
+static const lv_style_prop_t chart_indic_props[] = {
+    LV_STYLE_RADIUS, LV_STYLE_WIDTH, LV_STYLE_HEIGHT, LV_STYLE_BG_COLOR,
+    LV_STYLE_BG_OPA,
+};
+
+static const lv_style_prop_table_t chart_indic_prop_table = {
+    .props = chart_indic_props,
+    .const_props = NULL,
+    .prop_cnt = 5,
+    .prop_index = {
+        [LV_STYLE_RADIUS] = 1,
+        [LV_STYLE_WIDTH] = 2,
+        [LV_STYLE_HEIGHT] = 3,
+        [LV_STYLE_BG_COLOR] = 4,
+        [LV_STYLE_BG_OPA] = 5,
+    },
+};
+
+#endif /*LV_THEME_MONO_STYLE_TABLES_H*/
@@ -13,6 +13,9 @@
 
 #include "lv_theme_simple.h"
 #include "../../core/lv_global.h"
+#if LV_USE_THEME_STYLE_TABLES
+#include "lv_theme_simple_style_tables.h"
+#endif
 
 /*********************
  *      DEFINES
@@ -59,7 +62,7 @@ struct _my_theme_t {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static void style_init_reset(lv_style_t * style);
+static void style_init_reset(lv_style_t * style, const lv_style_prop_table_t * prop_table);
 static void theme_apply(lv_theme_t * th, lv_obj_t * obj);
 
 /**********************
@@ -76,20 +79,20 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj);
 
 static void style_init(my_theme_t * theme)
 {
-    style_init_reset(&theme->styles.scrollbar);
+    style_init_reset(&theme->styles.scrollbar, LV_THEME_STYLE_PROP_TABLE(scrollbar));
     lv_style_set_bg_opa(&theme->styles.scrollbar, LV_OPA_COVER);
     lv_style_set_bg_color(&theme->styles.scrollbar, COLOR_DARK);
     lv_style_set_width(&theme->styles.scrollbar, SCROLLBAR_WIDTH);
 
-    style_init_reset(&theme->styles.scr);
+    style_init_reset(&theme->styles.scr, LV_THEME_STYLE_PROP_TABLE(scr));
     lv_style_set_bg_opa(&theme->styles.scr, LV_OPA_COVER);
     lv_style_set_bg_color(&theme->styles.scr, COLOR_SCR);
     lv_style_set_text_color(&theme->styles.scr, COLOR_DIM);
 
-    style_init_reset(&theme->styles.transp);
+    style_init_reset(&theme->styles.transp, LV_THEME_STYLE_PROP_TABLE(transp));
     lv_style_set_bg_opa(&theme->styles.transp, LV_OPA_TRANSP);
 
-    style_init_reset(&theme->styles.white);
+    style_init_reset(&theme->styles.white, LV_THEME_STYLE_PROP_TABLE(white));
     lv_style_set_bg_opa(&theme->styles.white, LV_OPA_COVER);
     lv_style_set_bg_color(&theme->styles.white, COLOR_WHITE);
     lv_style_set_line_width(&theme->styles.white, 1);
@@ -97,7 +100,7 @@ static void style_init(my_theme_t * theme)
     lv_style_set_arc_width(&theme->styles.white, 2);
     lv_style_set_arc_color(&theme->styles.white, COLOR_WHITE);
 
-    style_init_reset(&theme->styles.light);
+    style_init_reset(&theme->styles.light, LV_THEME_STYLE_PROP_TABLE(light));
     lv_style_set_bg_opa(&theme->styles.light, LV_OPA_COVER);
     lv_style_set_bg_color(&theme->styles.light, COLOR_LIGHT);
     lv_style_set_line_width(&theme->styles.light, 1);
@@ -105,7 +108,7 @@ static void style_init(my_theme_t * theme)
     lv_style_set_arc_width(&theme->styles.light, 2);
     lv_style_set_arc_color(&theme->styles.light, COLOR_LIGHT);
 
-    style_init_reset(&theme->styles.dark);
+    style_init_reset(&theme->styles.dark, LV_THEME_STYLE_PROP_TABLE(dark));
     lv_style_set_bg_opa(&theme->styles.dark, LV_OPA_COVER);
     lv_style_set_bg_color(&theme->styles.dark, COLOR_DARK);
     lv_style_set_line_width(&theme->styles.dark, 1);
@@ -113,7 +116,7 @@ static void style_init(my_theme_t * theme)
     lv_style_set_arc_width(&theme->styles.dark, 2);
     lv_style_set_arc_color(&theme->styles.dark, COLOR_DARK);
 
-    style_init_reset(&theme->styles.dim);
+    style_init_reset(&theme->styles.dim, LV_THEME_STYLE_PROP_TABLE(dim));
     lv_style_set_bg_opa(&theme->styles.dim, LV_OPA_COVER);
     lv_style_set_bg_color(&theme->styles.dim, COLOR_DIM);
     lv_style_set_line_width(&theme->styles.dim, 1);
@@ -122,14 +125,14 @@ static void style_init(my_theme_t * theme)
     lv_style_set_arc_color(&theme->styles.dim, COLOR_DIM);
 
 #if LV_USE_ARC
-    style_init_reset(&theme->styles.arc_line);
+    style_init_reset(&theme->styles.arc_line, LV_THEME_STYLE_PROP_TABLE(arc_line));
     lv_style_set_arc_width(&theme->styles.arc_line, 6);
-    style_init_reset(&theme->styles.arc_knob);
+    style_init_reset(&theme->styles.arc_knob, LV_THEME_STYLE_PROP_TABLE(arc_knob));
     lv_style_set_pad_all(&theme->styles.arc_knob, 5);
 #endif
 
 #if LV_USE_TEXTAREA
-    style_init_reset(&theme->styles.ta_cursor);
+    style_init_reset(&theme->styles.ta_cursor, LV_THEME_STYLE_PROP_TABLE(ta_cursor));
     lv_style_set_border_side(&theme->styles.ta_cursor, LV_BORDER_SIDE_LEFT);
     lv_style_set_border_color(&theme->styles.ta_cursor, COLOR_DIM);
     lv_style_set_border_width(&theme->styles.ta_cursor, 2);
@@ -413,6 +416,12 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
         return;
     }
 #endif
+#if LV_USE_RECYCLERVIEW
+    else if(lv_obj_check_type(obj, &lv_recyclerview_class)) {
+        lv_obj_add_style(obj, &theme->styles.light, 0);
+        lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    }
+#endif
 
 #if LV_USE_SPINBOX
     else if(lv_obj_check_type(obj, &lv_spinbox_class)) {
@@ -437,14 +446,18 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
 #endif
 }
 
-static void style_init_reset(lv_style_t * style)
+static void style_init_reset(lv_style_t * style, const lv_style_prop_table_t * prop_table)
 {
     if(lv_theme_simple_is_inited()) {
         lv_style_reset(style);
     }
-    else {
-        lv_style_init(style);
-    }
+
+#if LV_USE_THEME_STYLE_TABLES
+    lv_style_init_table(style, prop_table);
+#else
+    LV_UNUSED(prop_table);
+    lv_style_init(style);
+#endif
 }
 
 #endif
@@ -0,0 +1,178 @@
+/*
+ **********************************************************************
+ *                            DO NOT EDIT
+ * This file is automatically generated by "style_table_gen.py"
+ * from "lv_theme_simple.c"
+ **********************************************************************
+ */
+
+#ifndef LV_THEME_SIMPLE_STYLE_TABLES_H
+#define LV_THEME_SIMPLE_STYLE_TABLES_H
+
+static const lv_style_prop_t scrollbar_props[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR, LV_STYLE_WIDTH,
+};
+
+static const lv_style_prop_table_t scrollbar_prop_table = {
+    .props = scrollbar_props,
+    .const_props = NULL,
+    .prop_cnt = 3,
+    .prop_index = {
+        [LV_STYLE_BG_OPA] = 1,
+        [LV_STYLE_BG_COLOR] = 2,
+        [LV_STYLE_WIDTH] = 3,
+    },
+};
+
+static const lv_style_prop_t scr_props[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR, LV_STYLE_TEXT_COLOR,
+};
+
+static const lv_style_prop_table_t scr_prop_table = {
+    .props = scr_props,
+    .const_props = NULL,
+    .prop_cnt = 3,
+    .prop_index = {
+        [LV_STYLE_BG_OPA] = 1,
+        [LV_STYLE_BG_COLOR] = 2,
+        [LV_STYLE_TEXT_COLOR] = 3,
+    },
+};
+
+static const lv_style_prop_t transp_props[] = {
+    LV_STYLE_BG_OPA,
+};
+
+static const lv_style_prop_table_t transp_prop_table = {
+    .props = transp_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_BG_OPA] = 1,
+    },
+};
+
+static const lv_style_prop_t white_props[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR, LV_STYLE_LINE_WIDTH, LV_STYLE_LINE_COLOR,
+    LV_STYLE_ARC_WIDTH, LV_STYLE_ARC_COLOR,
+};
+
+static const lv_style_prop_table_t white_prop_table = {
+    .props = white_props,
+    .const_props = NULL,
+    .prop_cnt = 6,
+    .prop_index = {
+        [LV_STYLE_BG_OPA] = 1,
+        [LV_STYLE_BG_COLOR] = 2,
+        [LV_STYLE_LINE_WIDTH] = 3,
+        [LV_STYLE_LINE_COLOR] = 4,
+        [LV_STYLE_ARC_WIDTH] = 5,
+        [LV_STYLE_ARC_COLOR] = 6,
+    },
+};
+
+static const lv_style_prop_t light_props[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR, LV_STYLE_LINE_WIDTH, LV_STYLE_LINE_COLOR,
+    LV_STYLE_ARC_WIDTH, LV_STYLE_ARC_COLOR,
+};
+
+static const lv_style_prop_table_t light_prop_table = {
+    .props = light_props,
+    .const_props = NULL,
+    .prop_cnt = 6,
+    .prop_index = {
+        [LV_STYLE_BG_OPA] = 1,
+        [LV_STYLE_BG_COLOR] = 2,
+        [LV_STYLE_LINE_WIDTH] = 3,
+        [LV_STYLE_LINE_COLOR] = 4,
+        [LV_STYLE_ARC_WIDTH] = 5,
+        [LV_STYLE_ARC_COLOR] = 6,
+    },
+};
+
+static const lv_style_prop_t dark_props[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR, LV_STYLE_LINE_WIDTH, LV_STYLE_LINE_COLOR,
+    LV_STYLE_ARC_WIDTH, LV_STYLE_ARC_COLOR,
+};
+
+static const lv_style_prop_table_t dark_prop_table = {
+    .props = dark_props,
+    .const_props = NULL,
+    .prop_cnt = 6,
+    .prop_index = {
+        [LV_STYLE_BG_OPA] = 1,
+        [LV_STYLE_BG_COLOR] = 2,
+        [LV_STYLE_LINE_WIDTH] = 3,
+        [LV_STYLE_LINE_COLOR] = 4,
+        [LV_STYLE_ARC_WIDTH] = 5,
+        [LV_STYLE_ARC_COLOR] = 6,
+    },
+};
+
+static const lv_style_prop_t dim_props[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR, LV_STYLE_LINE_WIDTH, LV_STYLE_LINE_COLOR,
+    LV_STYLE_ARC_WIDTH, LV_STYLE_ARC_COLOR,
+};
+
+static const lv_style_prop_table_t dim_prop_table = {
+    .props = dim_props,
+    .const_props = NULL,
+    .prop_cnt = 6,
+    .prop_index = {
+        [LV_STYLE_BG_OPA] = 1,
+        [LV_STYLE_BG_COLOR] = 2,
+        [LV_STYLE_LINE_WIDTH] = 3,
+        [LV_STYLE_LINE_COLOR] = 4,
+        [LV_STYLE_ARC_WIDTH] = 5,
+        [LV_STYLE_ARC_COLOR] = 6,
+    },
+};
+
+static const lv_style_prop_t arc_line_props[] = {
+    LV_STYLE_ARC_WIDTH,
+};
+
+static const lv_style_prop_table_t arc_line_prop_table = {
+    .props = arc_line_props,
+    .const_props = NULL,
+    .prop_cnt = 1,
+    .prop_index = {
+        [LV_STYLE_ARC_WIDTH] = 1,
+    },
+};
+
+static const lv_style_prop_t arc_knob_props[] = {
+    LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM,
+};
+
+static const lv_style_prop_table_t arc_knob_prop_table = {
+    .props = arc_knob_props,
+    .const_props = NULL,
+    .prop_cnt = 4,
+    .prop_index = {
+        [LV_STYLE_PAD_LEFT] = 1,
+        [LV_STYLE_PAD_RIGHT] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+    },
+};
+
+static const lv_style_prop_t ta_cursor_props[] = {
+    LV_STYLE_BORDER_SIDE, LV_STYLE_BORDER_COLOR, LV_STYLE_BORDER_WIDTH, LV_STYLE_BG_OPA,
+    LV_STYLE_ANIM_DURATION,
+};
+
+static const lv_style_prop_table_t ta_cursor_prop_table = {
+    .props = ta_cursor_props,
+    .const_props = NULL,
+    .prop_cnt = 5,
+    .prop_index = {
+        [LV_STYLE_BORDER_SIDE] = 1,
+        [LV_STYLE_BORDER_COLOR] = 2,
+        [LV_STYLE_BORDER_WIDTH] = 3,
+        [LV_STYLE_BG_OPA] = 4,
+        [LV_STYLE_ANIM_DURATION] = 5,
+    },
+};
+
+#endif /*LV_THEME_SIMPLE_STYLE_TABLES_H*/
@@ -418,6 +418,8 @@ void lv_canvas_finish_layer(lv_obj_t * canvas, lv_layer_t * layer)
         }
     }
 
+    lv_draw_task_pool_release();
+
     lv_draw_unit_send_event(NULL, LV_EVENT_SCREEN_LOAD_START, layer);
     lv_draw_unit_send_event(NULL, LV_EVENT_CHILD_DELETED, layer);
     lv_obj_invalidate(canvas);
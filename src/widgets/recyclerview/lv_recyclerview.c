@@ -0,0 +1,392 @@
+/**
+ * @file lv_recyclerview.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_recyclerview_private.h"
+#include "../../core/lv_obj_private.h"
+#include "../../core/lv_obj_class_private.h"
+
+#if LV_USE_RECYCLERVIEW
+
+#include "../label/lv_label.h"
+#include "../../misc/lv_assert.h"
+#include "../../stdlib/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MY_CLASS (&lv_recyclerview_class)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void lv_recyclerview_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_recyclerview_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_recyclerview_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static void update_rows(lv_obj_t * obj, bool rebind);
+static bool set_row_obj_count(lv_obj_t * obj, uint32_t cnt);
+static int32_t get_rows_height(lv_obj_t * obj);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+const lv_obj_class_t lv_recyclerview_class  = {
+    .base_class = &lv_obj_class,
+    .constructor_cb = lv_recyclerview_constructor,
+    .destructor_cb = lv_recyclerview_destructor,
+    .event_cb = lv_recyclerview_event,
+    .width_def = (LV_DPI_DEF * 3) / 2,
+    .height_def = LV_DPI_DEF * 2,
+    .instance_size = sizeof(lv_recyclerview_t),
+    .name = "lv_recyclerview",
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * lv_recyclerview_create(lv_obj_t * parent)
+{
+    LV_LOG_INFO("begin");
+    lv_obj_t * obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+void lv_recyclerview_set_get_count_cb(lv_obj_t * obj, lv_recyclerview_get_count_cb_t get_count_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recyclerview_t * rv = (lv_recyclerview_t *)obj;
+    rv->get_count_cb = get_count_cb;
+    lv_recyclerview_refresh(obj);
+}
+
+void lv_recyclerview_set_create_row_cb(lv_obj_t * obj, lv_recyclerview_create_row_cb_t create_row_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recyclerview_t * rv = (lv_recyclerview_t *)obj;
+    rv->create_row_cb = create_row_cb;
+
+    /*Create the row objects again with the new callback*/
+    set_row_obj_count(obj, 0);
+    update_rows(obj, true);
+}
+
+void lv_recyclerview_set_bind_row_cb(lv_obj_t * obj, lv_recyclerview_bind_row_cb_t bind_row_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recyclerview_t * rv = (lv_recyclerview_t *)obj;
+    rv->bind_row_cb = bind_row_cb;
+    update_rows(obj, true);
+}
+
+void lv_recyclerview_set_row_height(lv_obj_t * obj, int32_t height)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recyclerview_t * rv = (lv_recyclerview_t *)obj;
+    height = LV_MAX(height, 1);
+    if(rv->row_height == height) return;
+
+    rv->row_height = height;
+
+    uint32_t i;
+    for(i = 0; i < rv->row_obj_cnt; i++) {
+        lv_obj_set_height(rv->rows[i].obj, height);
+    }
+
+    update_rows(obj, true);
+    lv_obj_refresh_self_size(obj);
+    lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
+    lv_obj_invalidate(obj);
+}
+
+void lv_recyclerview_set_overscan(lv_obj_t * obj, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recyclerview_t * rv = (lv_recyclerview_t *)obj;
+    if(rv->overscan == cnt) return;
+
+    rv->overscan = cnt;
+    update_rows(obj, false);
+}
+
+void lv_recyclerview_refresh(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recyclerview_t * rv = (lv_recyclerview_t *)obj;
+    rv->row_cnt = rv->get_count_cb ? rv->get_count_cb(obj) : 0;
+
+    /*Move the row objects first as they are also considered when the scroll position is readjusted*/
+    update_rows(obj, true);
+    lv_obj_refresh_self_size(obj);
+    lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
+    lv_obj_invalidate(obj);
+}
+
+void lv_recyclerview_scroll_to_row(lv_obj_t * obj, uint32_t index, lv_anim_enable_t anim_en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_recyclerview_t * rv = (lv_recyclerview_t *)obj;
+    if(rv->row_cnt == 0) return;
+
+    index = LV_MIN(index, rv->row_cnt - 1);
+    int64_t y = (int64_t)index * (rv->row_height + rv->row_gap);
+    lv_obj_scroll_to_y(obj, (int32_t)LV_MIN(y, LV_COORD_MAX), anim_en);
+}
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+uint32_t lv_recyclerview_get_row_count(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    return ((const lv_recyclerview_t *)obj)->row_cnt;
+}
+
+int32_t lv_recyclerview_get_row_height(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    return ((const lv_recyclerview_t *)obj)->row_height;
+}
+
+uint32_t lv_recyclerview_get_overscan(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    return ((const lv_recyclerview_t *)obj)->overscan;
+}
+
+lv_obj_t * lv_recyclerview_get_row(const lv_obj_t * obj, uint32_t index)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    const lv_recyclerview_t * rv = (const lv_recyclerview_t *)obj;
+    if(rv->row_obj_cnt == 0) return NULL;
+
+    const lv_recyclerview_row_t * row = &rv->rows[index % rv->row_obj_cnt];
+    return row->index == index ? row->obj : NULL;
+}
+
+uint32_t lv_recyclerview_get_row_index(const lv_obj_t * obj, const lv_obj_t * row)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    const lv_recyclerview_t * rv = (const lv_recyclerview_t *)obj;
+    uint32_t i;
+    for(i = 0; i < rv->row_obj_cnt; i++) {
+        if(rv->rows[i].obj == row) return rv->rows[i].index;
+    }
+
+    return LV_RECYCLERVIEW_ROW_NONE;
+}
+
+uint32_t lv_recyclerview_get_row_obj_count(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    return ((const lv_recyclerview_t *)obj)->row_obj_cnt;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void lv_recyclerview_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    LV_TRACE_OBJ_CREATE("begin");
+
+    lv_recyclerview_t * rv = (lv_recyclerview_t *)obj;
+    rv->row_height = LV_DPX(40);
+    rv->overscan = 2;
+
+    lv_obj_set_scroll_dir(obj, LV_DIR_VER);
+
+    LV_TRACE_OBJ_CREATE("finished");
+}
+
+static void lv_recyclerview_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+
+    /*The row objects were deleted as children*/
+    lv_recyclerview_t * rv = (lv_recyclerview_t *)obj;
+    lv_free(rv->rows);
+    rv->rows = NULL;
+    rv->row_obj_cnt = 0;
+}
+
+static void lv_recyclerview_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    /*Call the ancestor's event handler*/
+    lv_result_t res = lv_obj_event_base(MY_CLASS, e);
+    if(res != LV_RESULT_OK) return;
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    lv_recyclerview_t * rv = (lv_recyclerview_t *)obj;
+
+    if(code == LV_EVENT_GET_SELF_SIZE) {
+        /*The rows define the scrollable area even if only a few of them exist*/
+        lv_point_t * p = lv_event_get_param(e);
+        p->y = LV_MAX(p->y, get_rows_height(obj));
+    }
+    else if(code == LV_EVENT_SCROLL || code == LV_EVENT_SIZE_CHANGED) {
+        update_rows(obj, false);
+    }
+    else if(code == LV_EVENT_STYLE_CHANGED) {
+        /*The rows can't overlap: a negative gap could make the row stride 0 or negative*/
+        int32_t row_gap = LV_MAX(lv_obj_get_style_pad_row(obj, LV_PART_MAIN), 0);
+        if(rv->row_gap != row_gap) {
+            rv->row_gap = row_gap;
+            lv_obj_refresh_self_size(obj);
+            update_rows(obj, true);
+        }
+        else {
+            /*The padding might have changed the number of visible rows*/
+            update_rows(obj, false);
+        }
+    }
+}
+
+/**
+ * Bind the row objects to the visible rows. Only the row objects whose rows scrolled out
+ * are bound again, the others keep their rows.
+ * @param obj       pointer to a recycler view
+ * @param rebind    true: bind all row objects, e.g. because the data has changed
+ */
+static void update_rows(lv_obj_t * obj, bool rebind)
+{
+    lv_recyclerview_t * rv = (lv_recyclerview_t *)obj;
+    int32_t row_stride = rv->row_height + rv->row_gap;
+
+    /*Enough row objects to cover the content area even if the first and last rows are partially visible*/
+    int32_t content_h = LV_MAX(lv_obj_get_content_height(obj), 0);
+    uint32_t visible_cnt = (uint32_t)(content_h / row_stride) + 2;
+    uint32_t needed_cnt = LV_MIN(visible_cnt + 2 * rv->overscan, rv->row_cnt);
+    if(needed_cnt != rv->row_obj_cnt) {
+        if(!set_row_obj_count(obj, needed_cnt)) return;
+        rebind = true;
+    }
+
+    if(needed_cnt == 0) return;
+
+    int32_t scroll_y = lv_obj_get_scroll_y(obj);
+    uint32_t first = scroll_y > 0 ? (uint32_t)(scroll_y / row_stride) : 0;
+    first = first > rv->overscan ? first - rv->overscan : 0;
+    first = LV_MIN(first, rv->row_cnt - needed_cnt);
+
+    /*Each row object shows the rows of the same residue so the rows which stay visible
+     *keep their objects and the ones which scrolled out are replaced by the new rows*/
+    uint32_t i;
+    for(i = first; i < first + needed_cnt; i++) {
+        lv_recyclerview_row_t * row = &rv->rows[i % needed_cnt];
+        if(row->index == i && !rebind) continue;
+
+        row->index = i;
+        int64_t y = (int64_t)i * row_stride;
+        lv_obj_set_y(row->obj, (int32_t)LV_MIN(y, LV_COORD_MAX));
+        /*Move it now instead of on the next layout update as it's already in the scrolled area*/
+        lv_obj_refr_pos(row->obj);
+        if(rv->bind_row_cb) rv->bind_row_cb(obj, row->obj, i);
+    }
+}
+
+/**
+ * Create or delete row objects
+ * @param obj       pointer to a recycler view
+ * @param cnt       the new number of row objects
+ * @return          true: success; false: out of memory
+ */
+static bool set_row_obj_count(lv_obj_t * obj, uint32_t cnt)
+{
+    lv_recyclerview_t * rv = (lv_recyclerview_t *)obj;
+
+    while(rv->row_obj_cnt > cnt) {
+        rv->row_obj_cnt--;
+        lv_obj_delete(rv->rows[rv->row_obj_cnt].obj);
+    }
+
+    if(cnt == 0) {
+        lv_free(rv->rows);
+        rv->rows = NULL;
+        return true;
+    }
+
+    lv_recyclerview_row_t * rows = lv_realloc(rv->rows, cnt * sizeof(lv_recyclerview_row_t));
+    LV_ASSERT_MALLOC(rows);
+    if(rows == NULL) return false;
+    rv->rows = rows;
+
+    while(rv->row_obj_cnt < cnt) {
+        lv_obj_t * row_obj;
+        if(rv->create_row_cb) {
+            row_obj = rv->create_row_cb(obj);
+        }
+        else {
+            row_obj = lv_label_create(obj);
+            lv_obj_set_width(row_obj, lv_pct(100));
+            lv_label_set_text_static(row_obj, "");
+        }
+        LV_ASSERT_NULL(row_obj);
+        if(row_obj == NULL) return false;
+
+        lv_obj_set_height(row_obj, rv->row_height);
+        rv->rows[rv->row_obj_cnt].obj = row_obj;
+        rv->rows[rv->row_obj_cnt].index = LV_RECYCLERVIEW_ROW_NONE;
+        rv->row_obj_cnt++;
+    }
+
+    /*The rows bound to the row objects depend on the number of row objects*/
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        rv->rows[i].index = LV_RECYCLERVIEW_ROW_NONE;
+    }
+
+    return true;
+}
+
+/**
+ * Get the height of all rows
+ * @param obj       pointer to a recycler view
+ * @return          the height of the rows and the gaps between them
+ */
+static int32_t get_rows_height(lv_obj_t * obj)
+{
+    lv_recyclerview_t * rv = (lv_recyclerview_t *)obj;
+    if(rv->row_cnt == 0) return 0;
+
+    int64_t h = (int64_t)rv->row_cnt * (rv->row_height + rv->row_gap) - rv->row_gap;
+    return (int32_t)LV_MIN(h, LV_COORD_MAX);
+}
+
+#endif /*LV_USE_RECYCLERVIEW*/
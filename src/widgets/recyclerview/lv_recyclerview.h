@@ -0,0 +1,183 @@
+/**
+ * @file lv_recyclerview.h
+ *
+ */
+
+#ifndef LV_RECYCLERVIEW_H
+#define LV_RECYCLERVIEW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../core/lv_obj.h"
+
+#if LV_USE_RECYCLERVIEW
+
+#if LV_USE_LABEL == 0
+#error "lv_recyclerview: lv_label is required. Enable it in lv_conf.h (LV_USE_LABEL 1)"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+/** Returned as row index if an object doesn't show any row */
+#define LV_RECYCLERVIEW_ROW_NONE    0xFFFFFFFF
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_recyclerview_class;
+
+/**
+ * Get the number of rows in the data set
+ * @param obj       pointer to a recycler view
+ * @return          number of rows
+ */
+typedef uint32_t (*lv_recyclerview_get_count_cb_t)(lv_obj_t * obj);
+
+/**
+ * Create an object which will show rows of the data set
+ * @param obj       pointer to a recycler view. The row object should be created on it.
+ * @return          pointer to the created row object
+ */
+typedef lv_obj_t * (*lv_recyclerview_create_row_cb_t)(lv_obj_t * obj);
+
+/**
+ * Update a row object to show a row of the data set
+ * @param obj       pointer to a recycler view
+ * @param row       pointer to a row object created by the recycler view
+ * @param index     index of the row to show
+ */
+typedef void (*lv_recyclerview_bind_row_cb_t)(lv_obj_t * obj, lv_obj_t * row, uint32_t index);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a recycler view object
+ * @param parent    pointer to an object, it will be the parent of the new recycler view
+ * @return          pointer to the created recycler view
+ */
+lv_obj_t * lv_recyclerview_create(lv_obj_t * parent);
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+/**
+ * Set the callback which returns the number of rows and read the number of rows with it
+ * @param obj       pointer to a recycler view object
+ * @param get_count_cb  the callback to get the number of rows
+ */
+void lv_recyclerview_set_get_count_cb(lv_obj_t * obj, lv_recyclerview_get_count_cb_t get_count_cb);
+
+/**
+ * Set the callback which creates the row objects. The existing row objects are deleted and
+ * created again with it.
+ * @param obj       pointer to a recycler view object
+ * @param create_row_cb the callback to create a row object, or NULL to create labels
+ */
+void lv_recyclerview_set_create_row_cb(lv_obj_t * obj, lv_recyclerview_create_row_cb_t create_row_cb);
+
+/**
+ * Set the callback which updates a row object to show a row of the data set
+ * @param obj       pointer to a recycler view object
+ * @param bind_row_cb   the callback to bind a row object to a row
+ */
+void lv_recyclerview_set_bind_row_cb(lv_obj_t * obj, lv_recyclerview_bind_row_cb_t bind_row_cb);
+
+/**
+ * Set the height of the rows. All rows have the same height and `pad_row` space between them.
+ * @param obj       pointer to a recycler view object
+ * @param height    height of a row in pixels
+ */
+void lv_recyclerview_set_row_height(lv_obj_t * obj, int32_t height);
+
+/**
+ * Set how many rows to keep bound above and below the visible rows
+ * @param obj       pointer to a recycler view object
+ * @param cnt       number of extra rows on each side
+ */
+void lv_recyclerview_set_overscan(lv_obj_t * obj, uint32_t cnt);
+
+/**
+ * Read the number of rows again and bind all row objects again.
+ * Call it when the data set has changed.
+ * @param obj       pointer to a recycler view object
+ */
+void lv_recyclerview_refresh(lv_obj_t * obj);
+
+/**
+ * Scroll to a row
+ * @param obj       pointer to a recycler view object
+ * @param index     index of the row to scroll to the top
+ * @param anim_en   LV_ANIM_ON: scroll with animation; LV_ANIM_OFF: scroll immediately
+ */
+void lv_recyclerview_scroll_to_row(lv_obj_t * obj, uint32_t index, lv_anim_enable_t anim_en);
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+/**
+ * Get the number of rows of the data set
+ * @param obj       pointer to a recycler view object
+ * @return          the number of rows returned by the `get_count_cb` when it was last called
+ */
+uint32_t lv_recyclerview_get_row_count(const lv_obj_t * obj);
+
+/**
+ * Get the height of the rows
+ * @param obj       pointer to a recycler view object
+ * @return          height of a row in pixels
+ */
+int32_t lv_recyclerview_get_row_height(const lv_obj_t * obj);
+
+/**
+ * Get how many rows are kept bound above and below the visible rows
+ * @param obj       pointer to a recycler view object
+ * @return          number of extra rows on each side
+ */
+uint32_t lv_recyclerview_get_overscan(const lv_obj_t * obj);
+
+/**
+ * Get the object which shows a row
+ * @param obj       pointer to a recycler view object
+ * @param index     index of a row
+ * @return          pointer to the row object or NULL if the row isn't bound to any object
+ */
+lv_obj_t * lv_recyclerview_get_row(const lv_obj_t * obj, uint32_t index);
+
+/**
+ * Get the index of the row shown by a row object. Useful in the event callbacks of the rows.
+ * @param obj       pointer to a recycler view object
+ * @param row       pointer to a row object
+ * @return          index of the row or `LV_RECYCLERVIEW_ROW_NONE`
+ */
+uint32_t lv_recyclerview_get_row_index(const lv_obj_t * obj, const lv_obj_t * row);
+
+/**
+ * Get the number of row objects
+ * @param obj       pointer to a recycler view object
+ * @return          the number of row objects. It depends only on the height of the
+ *                  recycler view, not on the number of rows.
+ */
+uint32_t lv_recyclerview_get_row_obj_count(const lv_obj_t * obj);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_RECYCLERVIEW*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_RECYCLERVIEW_H*/
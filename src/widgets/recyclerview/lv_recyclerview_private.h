@@ -0,0 +1,65 @@
+/**
+ * @file lv_recyclerview_private.h
+ *
+ */
+
+#ifndef LV_RECYCLERVIEW_PRIVATE_H
+#define LV_RECYCLERVIEW_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_recyclerview.h"
+
+#if LV_USE_RECYCLERVIEW
+#include "../../core/lv_obj_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** A row object and the row it shows */
+typedef struct {
+    lv_obj_t * obj;
+    uint32_t index;     /**< Index of the row or `LV_RECYCLERVIEW_ROW_NONE` if not bound yet*/
+} lv_recyclerview_row_t;
+
+/** Data of recycler view */
+struct _lv_recyclerview_t {
+    lv_obj_t obj;
+    lv_recyclerview_get_count_cb_t get_count_cb;
+    lv_recyclerview_create_row_cb_t create_row_cb;
+    lv_recyclerview_bind_row_cb_t bind_row_cb;
+    lv_recyclerview_row_t * rows;   /**< Row `i` is bound to the rows with `index % row_obj_cnt == i`*/
+    uint32_t row_obj_cnt;           /**< Number of row objects in `rows`*/
+    uint32_t row_cnt;               /**< Number of rows in the data set*/
+    uint32_t overscan;              /**< Number of extra rows bound above and below the visible ones*/
+    int32_t row_height;
+    int32_t row_gap;                /**< `pad_row` when the styles were last refreshed*/
+};
+
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_RECYCLERVIEW */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_RECYCLERVIEW_PRIVATE_H*/
@@ -143,6 +143,10 @@ void lv_xml_obj_apply(lv_xml_parser_state_t * state, const char ** attrs)
                                                                             lv_xml_to_bool(value));
         else if(lv_streq("radio_button", name))     lv_obj_set_flag(item, LV_OBJ_FLAG_RADIO_BUTTON,
                                                                         lv_xml_to_bool(value));
+        else if(lv_streq("display_list", name))         lv_obj_set_flag(item, LV_OBJ_FLAG_DISPLAY_LIST,
+                                                                            lv_xml_to_bool(value));
+        else if(lv_streq("cache_bitmap", name))         lv_obj_set_flag(item, LV_OBJ_FLAG_CACHE_BITMAP,
+                                                                            lv_xml_to_bool(value));
         else if(lv_streq("flex_in_new_track", name))    lv_obj_set_flag(item, LV_OBJ_FLAG_FLEX_IN_NEW_TRACK,
                                                                             lv_xml_to_bool(value));
 
@@ -822,6 +826,8 @@ static lv_obj_flag_t flag_to_enum(const char * txt)
     if(lv_streq("send_draw_task_events", txt)) return LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS;
     if(lv_streq("overflow_visible", txt)) return LV_OBJ_FLAG_OVERFLOW_VISIBLE;
     if(lv_streq("radio_button", txt)) return LV_OBJ_FLAG_RADIO_BUTTON;
+    if(lv_streq("display_list", txt)) return LV_OBJ_FLAG_DISPLAY_LIST;
+    if(lv_streq("cache_bitmap", txt)) return LV_OBJ_FLAG_CACHE_BITMAP;
     if(lv_streq("flex_in_new_track", txt)) return LV_OBJ_FLAG_FLEX_IN_NEW_TRACK;
     if(lv_streq("layout_1", txt)) return LV_OBJ_FLAG_LAYOUT_1;
     if(lv_streq("layout_2", txt)) return LV_OBJ_FLAG_LAYOUT_2;
@@ -22,16 +22,30 @@ extern "C" {
 #define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
 #define LV_USE_OS                   LV_OS_PTHREAD
 #define LV_OBJ_STYLE_CACHE          0
+#define LV_OBJ_STYLE_VALUE_CACHE_SIZE (64 * 1024) /* Lazily grown, so test it without the memory leak checks */
+#define LV_USE_STYLE_SIMD           1   /* The other builds test the scalar search of the style properties */
+#define LV_USE_ANIM_BATCH           1   /* The other builds test the animations one by one */
+#define LV_DRAW_OCCLUSION_CULLING   1   /* The other builds draw the covered draw tasks too */
 #define LV_BIN_DECODER_RAM_LOAD     1   /* Run test with bin image loaded to RAM */
 #define LV_DRAW_BUF_STRIDE_ALIGN    64  /* Use a large value to be sure any issues will cause crash */
 #endif
 
+#ifdef LVGL_CI_USING_SW_THREADS
+#define LV_DRAW_SW_DRAW_UNIT_CNT    4   /* Threads taking and stealing draw tasks from each other */
+#define LV_DRAW_SW_BIN_TILE_HEIGHT  32  /* Render the display tile by tile with all the threads */
+#define LV_DRAW_SW_SPLIT_THRESHOLD  10000 /* Split the large draw tasks between the threads when there are no tiles */
+#endif
+
 #ifdef LVGL_CI_USING_DEF_HEAP
 #define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
 #define LV_OBJ_STYLE_CACHE      1
 #define LV_BIN_DECODER_RAM_LOAD 0
+#define LV_USE_THEME_STYLE_TABLES 1 /* The other builds test the themes without property tables */
+#define LV_OBJ_POOL_CHUNK_SIZE  2048 /* Also tested with the memory leak checks of the builtin heap */
+#define LV_OBJ_HIT_INDEX_MIN_CHILDREN 8 /* Use it in the widget tests to check that the clicked widgets stay the same */
+#define LV_TIMER_ANIM_POOL_CHUNK_SIZE 1024 /* Small chunks to allocate and free them often in the tests */
 #endif
 
 #ifdef MICROPYTHON
@@ -85,6 +85,17 @@
             #endif
         #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+        /** Allocate the widgets, their attributes and small style arrays from chunks of this size
+         *  instead of allocating each of them from the heap. The chunks are grouped by 16 byte size classes
+         *  up to 512 bytes and freed when they become empty. It makes creating and deleting many widgets
+         *  faster and reduces fragmentation. 0: disable */
+        #define LV_OBJ_POOL_CHUNK_SIZE  4096    /**< [bytes] */
+
+        /** Allocate the timers, the animations and the style transitions from chunks of this size
+         *  instead of allocating each of them from the heap. It keeps the items iterated in every refresh
+         *  close to each other in the memory. 0: disable */
+        #define LV_TIMER_ANIM_POOL_CHUNK_SIZE  4096    /**< [bytes] */
+
         /*====================
         HAL SETTINGS
         *====================*/
@@ -444,6 +455,23 @@
         /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
         #define LV_OBJ_STYLE_CACHE      0
 
+        /** Memory budget in bytes of caching the resolved values of the style properties per widget
+         *  (e.g. the values used for drawing). Only non-inheritable properties are cached. 0: disable */
+        #define LV_OBJ_STYLE_VALUE_CACHE_SIZE   (256 * 1024)
+
+        /** Search the property IDs of the styles with SSE2, AVX2 or NEON instructions if the compiler enables them.
+         *  The property IDs of each style are padded to the vector width (16 or 32 bytes). */
+        #define LV_USE_STYLE_SIMD       1
+
+        /** Find the clicked widget among the children of widgets with at least this many children
+         *  by a grid of their click areas instead of hit testing all children.
+         *  The grid is built when the pointer is used and rebuilt when the children change. 0: disable */
+        #define LV_OBJ_HIT_INDEX_MIN_CHILDREN   64
+
+        /** Compute the values of the animations with the same built-in path in one pass and
+         *  coalesce the invalidations of the widgets while the animations are applied */
+        #define LV_USE_ANIM_BATCH       1
+
         /** Add `id` field to `lv_obj_t` */
         #define LV_USE_OBJ_ID           0
 
@@ -721,6 +749,8 @@
 
         #define LV_USE_MSGBOX     1
 
+        #define LV_USE_RECYCLERVIEW 1   /**< Requires: lv_label */
+
         #define LV_USE_ROLLER     1   /**< Requires: lv_label */
 
         #define LV_USE_SCALE      1
@@ -776,6 +806,10 @@
         /** A theme designed for monochrome displays */
         #define LV_USE_THEME_MONO 1
 
+        /** Find the properties in the styles of the built-in themes by precomputed property tables
+         *  instead of searching them. Needs about 200 bytes of ROM per style (~13 kB for the default theme). */
+        #define LV_USE_THEME_STYLE_TABLES 1
+
         /*==================
         * LAYOUTS
         *==================*/
@@ -0,0 +1,250 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/* The draw units run in threads only with an OS */
+#if LV_USE_OS == LV_OS_PTHREAD
+
+#define THREAD_CNT      8       /* Like 8 SW draw units, `LV_DRAW_SW_DRAW_UNIT_CNT 8` */
+#define ROUND_CNT       20000
+#define KEY_CNT         64
+#define CACHE_ENTRY_CNT 16
+#define MAGIC           0x5A5A5A5A
+
+typedef struct {
+    int32_t key;
+    uint32_t magic;
+    int32_t * data; /* malloced, contains `key`*/
+} test_data_t;
+
+typedef struct {
+    lv_thread_t thread;
+    lv_cache_t * cache;
+    uint32_t seed;
+    bool drop;
+    uint32_t error_cnt;
+} worker_t;
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static lv_cache_compare_res_t compare_cb(const test_data_t * lhs, const test_data_t * rhs)
+{
+    if(lhs->key != rhs->key) {
+        return lhs->key > rhs->key ? 1 : -1;
+    }
+    return 0;
+}
+
+static bool create_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    node->data = lv_malloc(sizeof(int32_t));
+    if(node->data == NULL) return false;
+    *node->data = node->key;
+    node->magic = MAGIC;
+    return true;
+}
+
+static void free_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    node->magic = 0;
+    lv_free(node->data);
+    node->data = NULL;
+}
+
+static uint32_t next_rand(uint32_t * seed)
+{
+    *seed = *seed * 1103515245 + 12345;
+    return *seed >> 16;
+}
+
+static void worker_cb(void * user_data)
+{
+    worker_t * w = user_data;
+
+    uint32_t i;
+    for(i = 0; i < ROUND_CNT; i++) {
+        test_data_t search_key = { .key = (int32_t)(next_rand(&w->seed) % KEY_CNT) };
+
+        lv_cache_entry_t * entry;
+        if(i % 2) entry = lv_cache_acquire_or_create(w->cache, &search_key, NULL);
+        else entry = lv_cache_acquire(w->cache, &search_key, NULL);
+        if(entry == NULL) continue;
+
+        /* The entry must stay valid while it's referenced, even if other threads drop or evict it */
+        test_data_t * data = lv_cache_entry_get_data(entry);
+        if(data->key != search_key.key || data->magic != MAGIC || *data->data != search_key.key) {
+            w->error_cnt++;
+        }
+
+        if(w->drop && i % 8 == 0) {
+            lv_cache_drop(w->cache, &search_key, NULL);
+            if(data->magic != MAGIC || *data->data != search_key.key) w->error_cnt++;
+        }
+
+        lv_cache_release(w->cache, entry, NULL);
+    }
+}
+
+static void run_workers(lv_cache_t * cache, bool drop)
+{
+    static worker_t workers[THREAD_CNT];
+    uint32_t i;
+    for(i = 0; i < THREAD_CNT; i++) {
+        lv_memzero(&workers[i], sizeof(worker_t));
+        workers[i].cache = cache;
+        workers[i].seed = i + 1;
+        workers[i].drop = drop && i % 2;
+        lv_result_t res = lv_thread_init(&workers[i].thread, "cache_worker", LV_THREAD_PRIO_MID, worker_cb, 0, &workers[i]);
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, res);
+    }
+
+    /* Wait for all of them before checking, else the remaining ones could run after the test */
+    uint32_t error_cnt = 0;
+    for(i = 0; i < THREAD_CNT; i++) {
+        lv_thread_delete(&workers[i].thread);
+        error_cnt += workers[i].error_cnt;
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, error_cnt);
+
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(CACHE_ENTRY_CNT, lv_cache_get_size(cache, NULL));
+
+    /* Only the entries without references can be evicted, so all of them were released */
+    while(lv_cache_get_size(cache, NULL) > 0 && lv_cache_evict_one(cache, NULL));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_cache_get_size(cache, NULL));
+}
+
+static lv_cache_t * create_cache(const lv_cache_class_t * cache_class)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)compare_cb,
+        .create_cb = (lv_cache_create_cb_t)create_cb,
+        .free_cb = (lv_cache_free_cb_t)free_cb,
+    };
+    return lv_cache_create(cache_class, sizeof(test_data_t), CACHE_ENTRY_CNT, ops);
+}
+
+void test_cache_threads_lru_rb(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_rb_count);
+    run_workers(cache, false);
+    TEST_PRINTF("lru_rb contention: %" LV_PRIu32, lv_cache_get_contention_cnt(cache));
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_threads_lru_rb_drop(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_rb_count);
+    run_workers(cache, true);
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_threads_lru_ll_drop(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_ll_count);
+    run_workers(cache, true);
+    lv_cache_destroy(cache, NULL);
+}
+
+static void image_worker_cb(void * user_data)
+{
+    /* Open the images like the SW draw units do when they draw them */
+    static const char * srcs[] = {
+        "A:src/test_files/binimages/cogwheel.ARGB8888.bin",
+        "A:src/test_files/binimages/cogwheel.RGB565.bin",
+        "A:src/test_files/binimages/cogwheel.I4.bin",
+        "A:src/test_files/binimages/cogwheel.A8.bin",
+    };
+
+    worker_t * w = user_data;
+
+    uint32_t i;
+    for(i = 0; i < ROUND_CNT / 100; i++) {
+        const char * src = srcs[next_rand(&w->seed) % 4];
+        lv_image_decoder_dsc_t dsc;
+        lv_result_t res = lv_image_decoder_open(&dsc, src, NULL);
+        if(res != LV_RESULT_OK || dsc.decoded == NULL || dsc.decoded->header.w == 0) {
+            w->error_cnt++;
+        }
+
+        /* Like `lv_image_cache_drop()` without notifying the draw units */
+        if(w->drop && i % 4 == 0) {
+            lv_image_cache_data_t search_key = { .src = src, .src_type = LV_IMAGE_SRC_FILE };
+            lv_cache_drop(w->cache, &search_key, NULL);
+        }
+
+        lv_image_decoder_close(&dsc);
+    }
+}
+
+void test_cache_threads_images(void)
+{
+    lv_cache_t * cache = LV_GLOBAL_DEFAULT()->img_cache;
+
+    static worker_t workers[THREAD_CNT];
+    uint32_t i;
+    for(i = 0; i < THREAD_CNT; i++) {
+        lv_memzero(&workers[i], sizeof(worker_t));
+        workers[i].cache = cache;
+        workers[i].seed = i + 1;
+        workers[i].drop = i % 2;
+        lv_result_t res = lv_thread_init(&workers[i].thread, "image_worker", LV_THREAD_PRIO_MID, image_worker_cb, 0,
+                                         &workers[i]);
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, res);
+    }
+
+    /* Wait for all of them before checking, else the remaining ones could run after the test */
+    uint32_t error_cnt = 0;
+    for(i = 0; i < THREAD_CNT; i++) {
+        lv_thread_delete(&workers[i].thread);
+        error_cnt += workers[i].error_cnt;
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, error_cnt);
+
+    TEST_ASSERT_GREATER_THAN_UINT32(0, lv_cache_get_size(cache, NULL));
+    TEST_PRINTF("image cache contention: %" LV_PRIu32, lv_cache_get_contention_cnt(cache));
+
+    while(lv_cache_get_size(cache, NULL) > 0 && lv_cache_evict_one(cache, NULL));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_cache_get_size(cache, NULL));
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_cache_threads_lru_rb(void)
+{
+}
+
+void test_cache_threads_lru_rb_drop(void)
+{
+}
+
+void test_cache_threads_lru_ll_drop(void)
+{
+}
+
+void test_cache_threads_images(void)
+{
+}
+
+#endif /*LV_USE_OS == LV_OS_PTHREAD*/
+
+#endif
@@ -0,0 +1,159 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * cont;
+static lv_obj_t * label;
+static uint32_t draw_cnt;
+
+static void draw_main_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    draw_cnt++;
+}
+
+void setUp(void)
+{
+    /*A scrollable parent with a complex widget which is recorded*/
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(parent, 300, 400);
+
+    lv_obj_t * spacer = lv_obj_create(parent);
+    lv_obj_set_pos(spacer, 0, 500);
+
+    cont = lv_obj_create(parent);
+    lv_obj_set_size(cont, 200, LV_SIZE_CONTENT);
+    lv_obj_set_pos(cont, 20, 50);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    lv_obj_add_flag(cont, LV_OBJ_FLAG_DISPLAY_LIST);
+
+    label = lv_label_create(cont);
+    lv_label_set_text(label, "Recorded label");
+    lv_obj_add_event_cb(label, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    lv_obj_t * btn = lv_button_create(cont);
+    lv_obj_t * btn_label = lv_label_create(btn);
+    lv_label_set_text(btn_label, "Button");
+
+    lv_obj_t * arc = lv_arc_create(cont);
+    lv_obj_set_size(arc, 80, 80);
+
+    lv_obj_t * slider = lv_slider_create(cont);
+    lv_obj_set_width(slider, 120);
+
+    draw_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Take a snapshot of the screen and compare it with the one taken without the display list*/
+static void assert_same_as_without_display_list(void)
+{
+    lv_draw_buf_t * snapshot = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot);
+
+    lv_obj_remove_flag(cont, LV_OBJ_FLAG_DISPLAY_LIST);
+    TEST_ASSERT_NULL(cont->spec_attr->display_list);
+
+    lv_draw_buf_t * snapshot_ref = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot_ref);
+    TEST_ASSERT_EQUAL_UINT32(snapshot_ref->data_size, snapshot->data_size);
+    TEST_ASSERT_EQUAL_MEMORY(snapshot_ref->data, snapshot->data, snapshot->data_size);
+
+    lv_obj_add_flag(cont, LV_OBJ_FLAG_DISPLAY_LIST);
+
+    lv_draw_buf_destroy(snapshot);
+    lv_draw_buf_destroy(snapshot_ref);
+}
+
+void test_display_list_is_replayed(void)
+{
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+    TEST_ASSERT_NOT_NULL(cont->spec_attr->display_list);
+    TEST_ASSERT_TRUE(cont->spec_attr->display_list->ready);
+
+    /*The widgets are not drawn again*/
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    assert_same_as_without_display_list();
+}
+
+void test_display_list_is_moved_on_scroll(void)
+{
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+    TEST_ASSERT_TRUE(cont->spec_attr->display_list->ready);
+
+    /*Scroll only the children as the animations and the input devices do.
+     *(`LV_EVENT_SCROLL_BEGIN` adds `LV_STATE_SCROLLED` which refreshes the styles of the children)*/
+    lv_obj_scroll_by_raw(lv_obj_get_parent(cont), 0, -30);
+    TEST_ASSERT_TRUE(cont->spec_attr->display_list->ready);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    assert_same_as_without_display_list();
+}
+
+void test_display_list_is_cleared_on_change(void)
+{
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    /*The list is cleared on any change and recorded again when the whole widget is redrawn*/
+    lv_label_set_text(label, "Changed label");
+    TEST_ASSERT_FALSE(cont->spec_attr->display_list->ready);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_cnt);
+    TEST_ASSERT_TRUE(cont->spec_attr->display_list->ready);
+
+    lv_obj_add_state(lv_obj_get_child(cont, 1), LV_STATE_CHECKED);
+    TEST_ASSERT_FALSE(cont->spec_attr->display_list->ready);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, draw_cnt);
+    TEST_ASSERT_TRUE(cont->spec_attr->display_list->ready);
+
+    lv_obj_t * new_label = lv_label_create(cont);
+    lv_label_set_text(new_label, "New label");
+    TEST_ASSERT_FALSE(cont->spec_attr->display_list->ready);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(4, draw_cnt);
+    TEST_ASSERT_TRUE(cont->spec_attr->display_list->ready);
+
+    assert_same_as_without_display_list();
+}
+
+void test_display_list_is_not_recorded_partially(void)
+{
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(cont->spec_attr->display_list->ready);
+    lv_draw_display_list_clear(cont->spec_attr->display_list);
+
+    /*Only a part of the widget is redrawn*/
+    lv_area_t part = cont->coords;
+    part.y2 = part.y1 + 20;
+    lv_obj_invalidate_area(lv_screen_active(), &part);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_cnt);
+    TEST_ASSERT_FALSE(cont->spec_attr->display_list->ready);
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, draw_cnt);
+    TEST_ASSERT_TRUE(cont->spec_attr->display_list->ready);
+
+    assert_same_as_without_display_list();
+}
+
+#endif
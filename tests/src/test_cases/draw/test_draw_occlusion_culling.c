@@ -0,0 +1,165 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define CANVAS_W    100
+#define CANVAS_H    100
+
+static lv_obj_t * canvas;
+static lv_draw_buf_t * draw_buf;
+static lv_layer_t layer;
+
+void setUp(void)
+{
+    draw_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_XRGB8888, LV_STRIDE_AUTO);
+    canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, draw_buf);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+    lv_canvas_init_layer(canvas, &layer);
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(canvas);
+    lv_draw_buf_destroy(draw_buf);
+}
+
+#if LV_DRAW_OCCLUSION_CULLING
+static void draw_fill(int32_t x1, int32_t y1, int32_t x2, int32_t y2, lv_color_t color, lv_opa_t opa, int32_t radius)
+{
+    lv_draw_fill_dsc_t fill_dsc;
+    lv_draw_fill_dsc_init(&fill_dsc);
+    fill_dsc.color = color;
+    fill_dsc.opa = opa;
+    fill_dsc.radius = radius;
+
+    lv_area_t a = {x1, y1, x2, y2};
+    lv_draw_fill(&layer, &fill_dsc, &a);
+}
+
+static void draw_label(void)
+{
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    label_dsc.color = lv_palette_main(LV_PALETTE_RED);
+    label_dsc.text = "Hidden";
+
+    lv_area_t a = {20, 20, 80, 40};
+    lv_draw_label(&layer, &label_dsc, &a);
+}
+
+static void assert_px(int32_t x, int32_t y, lv_color_t color)
+{
+    lv_color32_t px = lv_canvas_get_px(canvas, x, y);
+    TEST_ASSERT_EQUAL_UINT8(color.red, px.red);
+    TEST_ASSERT_EQUAL_UINT8(color.green, px.green);
+    TEST_ASSERT_EQUAL_UINT8(color.blue, px.blue);
+}
+#endif
+
+void test_covered_tasks_are_culled(void)
+{
+#if LV_DRAW_OCCLUSION_CULLING
+    uint32_t task_cnt = lv_draw_get_culled_task_count();
+    uint32_t px_cnt = lv_draw_get_culled_pixel_count();
+
+    draw_fill(10, 10, 49, 49, lv_palette_main(LV_PALETTE_RED), LV_OPA_COVER, 0);
+    draw_label();
+    draw_fill(0, 0, 99, 99, lv_palette_main(LV_PALETTE_BLUE), LV_OPA_COVER, 0);
+
+    TEST_ASSERT_EQUAL_UINT32(task_cnt + 2, lv_draw_get_culled_task_count());
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(px_cnt + 40 * 40, lv_draw_get_culled_pixel_count());
+
+    lv_canvas_finish_layer(canvas, &layer);
+    assert_px(30, 30, lv_palette_main(LV_PALETTE_BLUE));
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_covered_tasks_are_culled_with_grid(void)
+{
+#if LV_DRAW_OCCLUSION_CULLING
+    uint32_t task_cnt = lv_draw_get_culled_task_count();
+
+    /*Have enough draw tasks to sort them into a grid*/
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        int32_t x = (i * 7) % 90;
+        int32_t y = (i * 13) % 90;
+        draw_fill(x, y, x + 9, y + 9, lv_palette_main(i % LV_PALETTE_LAST), LV_OPA_50, 0);
+    }
+    draw_fill(0, 0, 99, 49, lv_palette_main(LV_PALETTE_BLUE), LV_OPA_COVER, 0);
+
+    uint32_t culled_cnt = lv_draw_get_culled_task_count() - task_cnt;
+    TEST_ASSERT_GREATER_THAN_UINT32(0, culled_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(200, culled_cnt);
+
+    lv_canvas_finish_layer(canvas, &layer);
+    assert_px(30, 30, lv_palette_main(LV_PALETTE_BLUE));
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_partially_covered_tasks_are_drawn(void)
+{
+#if LV_DRAW_OCCLUSION_CULLING
+    uint32_t task_cnt = lv_draw_get_culled_task_count();
+
+    draw_fill(10, 10, 59, 59, lv_palette_main(LV_PALETTE_RED), LV_OPA_COVER, 0);
+    draw_fill(0, 0, 49, 99, lv_palette_main(LV_PALETTE_BLUE), LV_OPA_COVER, 0);
+
+    TEST_ASSERT_EQUAL_UINT32(task_cnt, lv_draw_get_culled_task_count());
+
+    lv_canvas_finish_layer(canvas, &layer);
+    assert_px(30, 30, lv_palette_main(LV_PALETTE_BLUE));
+    assert_px(55, 30, lv_palette_main(LV_PALETTE_RED));
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_not_opaque_tasks_dont_cull(void)
+{
+#if LV_DRAW_OCCLUSION_CULLING
+    uint32_t task_cnt = lv_draw_get_culled_task_count();
+
+    draw_fill(10, 10, 49, 49, lv_palette_main(LV_PALETTE_RED), LV_OPA_COVER, 0);
+    draw_fill(0, 0, 99, 99, lv_palette_main(LV_PALETTE_BLUE), LV_OPA_50, 0);
+    draw_fill(0, 0, 99, 99, lv_palette_main(LV_PALETTE_BLUE), LV_OPA_COVER, 10);
+
+    TEST_ASSERT_EQUAL_UINT32(task_cnt, lv_draw_get_culled_task_count());
+
+    lv_canvas_finish_layer(canvas, &layer);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_tasks_below_blur_are_drawn(void)
+{
+#if LV_DRAW_OCCLUSION_CULLING
+    uint32_t task_cnt = lv_draw_get_culled_task_count();
+
+    draw_fill(10, 10, 49, 49, lv_palette_main(LV_PALETTE_RED), LV_OPA_COVER, 0);
+
+    lv_draw_blur_dsc_t blur_dsc;
+    lv_draw_blur_dsc_init(&blur_dsc);
+    blur_dsc.blur_radius = 10;
+    lv_area_t a = {0, 0, 99, 99};
+    lv_draw_blur(&layer, &blur_dsc, &a);
+
+    draw_fill(0, 0, 49, 49, lv_palette_main(LV_PALETTE_BLUE), LV_OPA_COVER, 0);
+
+    TEST_ASSERT_EQUAL_UINT32(task_cnt, lv_draw_get_culled_task_count());
+
+    lv_canvas_finish_layer(canvas, &layer);
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
@@ -0,0 +1,98 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/*The reference images of these tests are the same with any number of SW render threads.
+ *The OPTIONS_TEST_SW_THREADS build runs only these tests and renders them with several threads.*/
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_draw_sw_threads_many_independent_tasks(void)
+{
+    /*Many small draw tasks which don't overlap, so the threads can take and steal them in any order*/
+    uint32_t i;
+    for(i = 0; i < 300; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+        lv_obj_set_style_bg_color(obj, lv_palette_main((lv_palette_t)(i % LV_PALETTE_LAST)), 0);
+        lv_obj_set_style_radius(obj, (i % 4) * 3, 0);
+        lv_obj_set_size(obj, 28, 28);
+        lv_obj_set_pos(obj, (i % 25) * 32 + 2, (i / 25) * 32 + 2);
+    }
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_threads_many_tasks.png");
+}
+
+void test_draw_sw_threads_long_label_in_tiles(void)
+{
+    /*A label taller than the hint limit on a scrolled page. Its draw task is binned to many tiles,
+     *and each thread needs to draw its tiles without the shared hint.*/
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 500, 440);
+    lv_obj_center(cont);
+
+    lv_obj_t * label = lv_label_create(cont);
+    lv_obj_set_width(label, lv_pct(100));
+
+    lv_label_set_text(label, "");
+    uint32_t i;
+    for(i = 0; i < 80; i++) {
+        lv_label_ins_text(label, LV_LABEL_POS_LAST, "Lorem ipsum dolor sit amet, consectetur adipiscing elit, "
+                          "sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.\n");
+    }
+
+    lv_obj_scroll_to_y(cont, 1500, LV_ANIM_OFF);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_threads_long_label.png");
+}
+
+void test_draw_sw_threads_split_large_tasks(void)
+{
+    /*Large fills, shadows and images with a blurred widget on the top. The blur can't be rendered
+     *tile by tile, so the large draw tasks of the display are split between the threads instead.
+     *Render the display in one piece to split them while no other part is rendered by tiles.*/
+    lv_display_t * disp = lv_display_get_default();
+    uint32_t tile_cnt = lv_display_get_tile_cnt(disp);
+    lv_display_set_tile_cnt(disp, 1);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 600, 300);
+    lv_obj_set_pos(obj, 60, 60);
+    lv_obj_set_style_radius(obj, 40, 0);
+    lv_obj_set_style_bg_grad_color(obj, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, 0);
+    lv_obj_set_style_shadow_width(obj, 50, 0);
+    lv_obj_set_style_shadow_offset_y(obj, 20, 0);
+
+    LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, &test_image_cogwheel_argb8888);
+    lv_image_set_scale(img, 512);
+    lv_image_set_rotation(img, 300);
+    lv_obj_align(img, LV_ALIGN_BOTTOM_RIGHT, -120, -60);
+
+    lv_obj_t * blurred = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(blurred, 120, 80);
+    lv_obj_set_pos(blurred, 20, 320);
+    lv_obj_set_style_bg_opa(blurred, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_blur_radius(blurred, 10, 0);
+    lv_obj_set_style_blur_backdrop(blurred, true, 0);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_threads_split.png");
+
+    lv_display_set_tile_cnt(disp, tile_cnt);
+}
+
+#endif
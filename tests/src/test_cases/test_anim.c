@@ -263,4 +263,107 @@ void test_anim_vsync_mode(void)
     lv_anim_delete(&var, exec_cb);
 }
 
+static void check_path_cb(lv_anim_t * a, int32_t v)
+{
+    (*(uint32_t *)a->var)++;
+    TEST_ASSERT_EQUAL_INT32(a->path_cb(a), v);
+}
+
+void test_anim_builtin_path_values(void)
+{
+    static const lv_anim_path_cb_t paths[] = {
+        lv_anim_path_linear, lv_anim_path_ease_in, lv_anim_path_ease_out, lv_anim_path_ease_in_out,
+        lv_anim_path_overshoot, lv_anim_path_bounce, lv_anim_path_step
+    };
+
+    uint32_t exec_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < 7 * 8; i++) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, &exec_cnt);
+        lv_anim_set_custom_exec_cb(&a, check_path_cb);
+        lv_anim_set_path_cb(&a, paths[i % 7]);
+        lv_anim_set_values(&a, (int32_t)i * 37 - 1000, (int32_t)(i % 5) * 411 - 600);
+        lv_anim_set_duration(&a, 20 + i * 13);
+        lv_anim_set_delay(&a, i % 3 * 17);
+        lv_anim_set_reverse_duration(&a, i % 2 ? 0 : 100);
+        lv_anim_set_repeat_count(&a, 3);
+        lv_anim_start(&a);
+    }
+
+    lv_test_wait(3000);
+    TEST_ASSERT_GREATER_THAN_UINT32(1000, exec_cnt);
+    TEST_ASSERT_NULL(lv_anim_get(&exec_cnt, NULL));
+}
+
+static bool is_invalidated(const lv_area_t * area)
+{
+    lv_display_t * disp = lv_display_get_default();
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(lv_area_is_in(area, &disp->inv_areas[i], 0)) return true;
+    }
+    return false;
+}
+
+static void opa_exec_cb(void * var, int32_t v)
+{
+    lv_obj_set_style_opa(var, v, 0);
+}
+
+static void bg_color_exec_cb(void * var, int32_t v)
+{
+    lv_obj_set_style_bg_color(var, lv_color_make(v, 0, 0), 0);
+}
+
+static void start_invalidating_anims(lv_obj_t * obj)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, obj);
+    lv_anim_set_duration(&a, 100);
+    lv_anim_set_values(&a, LV_OPA_COVER, LV_OPA_TRANSP);
+    lv_anim_set_exec_cb(&a, opa_exec_cb);
+    lv_anim_start(&a);
+    lv_anim_set_values(&a, 0, 255);
+    lv_anim_set_exec_cb(&a, bg_color_exec_cb);
+    lv_anim_start(&a);
+}
+
+void test_anim_invalidation(void)
+{
+    lv_obj_t * obj1 = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj1, 50, 50);
+    lv_obj_set_pos(obj1, 0, 120);
+    start_invalidating_anims(obj1);
+
+    lv_obj_t * obj2 = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj2, 50, 50);
+    lv_obj_set_pos(obj2, 300, 300);
+    start_invalidating_anims(obj2);
+
+    lv_obj_t * blurred = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(blurred, 100, 100);
+    lv_obj_set_pos(blurred, 100, 100);
+    lv_obj_set_style_blur_radius(blurred, 10, 0);
+
+    lv_refr_now(NULL);
+    lv_tick_inc(10);
+    lv_anim_refr_now();
+    TEST_ASSERT_TRUE(is_invalidated(&obj1->coords));
+    TEST_ASSERT_TRUE(is_invalidated(&obj2->coords));
+    TEST_ASSERT_FALSE(is_invalidated(&blurred->coords));
+
+    /*Below the blurred widget*/
+    lv_obj_set_x(obj1, 60);
+    lv_obj_update_layout(obj1);
+    lv_refr_now(NULL);
+    lv_tick_inc(10);
+    lv_anim_refr_now();
+    TEST_ASSERT_TRUE(is_invalidated(&obj1->coords));
+    TEST_ASSERT_TRUE(is_invalidated(&obj2->coords));
+    TEST_ASSERT_TRUE(is_invalidated(&blurred->coords));
+}
+
 #endif
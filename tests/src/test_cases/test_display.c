@@ -622,4 +622,557 @@ void test_display_rotate_point(void)
     lv_display_delete(disp);
 }
 
+void test_display_many_invalidated_areas(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    lv_refr_now(disp);
+
+    /*More areas than LV_INV_BUF_SIZE, too far from each other to be joined,
+     *shouldn't invalidate the whole screen*/
+    uint32_t i;
+    for(i = 0; i < 60; i++) {
+        lv_area_t a;
+        a.x1 = (int32_t)(i % 10) * 80;
+        a.y1 = (int32_t)(i / 10) * 80;
+        a.x2 = a.x1 + 39;
+        a.y2 = a.y1 + 39;
+        lv_inv_area(disp, &a);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(60, disp->inv_p);
+    for(i = 0; i < disp->inv_p; i++) {
+        TEST_ASSERT_EQUAL_UINT32(40 * 40, lv_area_get_size(&disp->inv_areas[i]));
+    }
+
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(0, disp->inv_p);
+}
+
+static uint32_t render_area_cnt;
+static uint32_t render_area_size_sum;
+
+static void render_start_cb(lv_event_t * e)
+{
+    lv_display_t * disp = lv_event_get_target(e);
+    render_area_cnt = disp->inv_p;
+    render_area_size_sum = 0;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        render_area_size_sum += lv_area_get_size(&disp->inv_areas[i]);
+    }
+}
+
+void test_display_invalidated_areas_are_joined(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    lv_refr_now(disp);
+    lv_display_add_event_cb(disp, render_start_cb, LV_EVENT_RENDER_START, NULL);
+
+    /*Joined as 110x110 is smaller than 2x100x100*/
+    lv_area_t a1 = {0, 0, 99, 99};
+    lv_area_t a2 = {10, 10, 109, 109};
+    /*Not joined as 150x150 is larger than 2x100x100 + LV_INV_AREA_OVERHEAD*/
+    lv_area_t a3 = {200, 0, 299, 99};
+    lv_area_t a4 = {250, 50, 349, 149};
+    /*Joined as 100x190 is smaller than 100x110 (a5 joined with a7 first) + 100x100*/
+    lv_area_t a5 = {0, 200, 99, 299};
+    lv_area_t a6 = {0, 290, 99, 389};
+    lv_area_t a7 = {0, 210, 99, 309};
+    /*a10 is joined with neither a8 nor a9, but with their joined area in the second round*/
+    lv_area_t a8 = {400, 20, 449, 69};
+    lv_area_t a9 = {400, 60, 449, 109};
+    lv_area_t a10 = {420, 0, 429, 109};
+    /*Small areas close to each other are joined to save the overhead of refreshing an area*/
+    lv_area_t a11 = {600, 0, 609, 9};
+    lv_area_t a12 = {612, 0, 621, 9};
+
+    lv_inv_area(disp, &a1);
+    lv_inv_area(disp, &a2);
+    lv_inv_area(disp, &a3);
+    lv_inv_area(disp, &a4);
+    lv_inv_area(disp, &a5);
+    lv_inv_area(disp, &a6);
+    lv_inv_area(disp, &a7);
+    lv_inv_area(disp, &a8);
+    lv_inv_area(disp, &a9);
+    lv_inv_area(disp, &a10);
+    lv_inv_area(disp, &a11);
+    lv_inv_area(disp, &a12);
+    lv_refr_now(disp);
+
+    lv_display_remove_event_cb_with_user_data(disp, render_start_cb, NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(6, render_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(110 * 110 + 2 * 100 * 100 + 100 * 190 + 50 * 110 + 22 * 10, render_area_size_sum);
+}
+
+static void refr_display(lv_display_t * disp)
+{
+    lv_display_add_event_cb(disp, render_start_cb, LV_EVENT_RENDER_START, NULL);
+    render_area_cnt = 0;
+    render_area_size_sum = 0;
+    lv_display_refr_timer(lv_display_get_refr_timer(disp));
+    lv_display_remove_event_cb_with_user_data(disp, render_start_cb, NULL);
+}
+
+void test_display_buf_age_double_buffer(void)
+{
+    lv_display_t * disp = lv_display_create(480, 320);
+    lv_display_set_flush_cb(disp, dummy_flush_cb);
+    lv_draw_buf_t * buf1 = lv_draw_buf_create(480, 320, LV_COLOR_FORMAT_NATIVE, 0);
+    lv_draw_buf_t * buf2 = lv_draw_buf_create(480, 320, LV_COLOR_FORMAT_NATIVE, 0);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_display_set_draw_buffers(disp, buf1, buf2);
+
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_t * obj1 = lv_obj_create(scr);
+    lv_obj_set_size(obj1, 100, 100);
+    lv_obj_set_style_border_width(obj1, 0, 0);
+    lv_obj_set_style_shadow_width(obj1, 0, 0);
+    lv_obj_t * obj2 = lv_obj_create(scr);
+    lv_obj_set_size(obj2, 100, 100);
+    lv_obj_set_pos(obj2, 300, 200);
+    lv_obj_set_style_border_width(obj2, 0, 0);
+    lv_obj_set_style_shadow_width(obj2, 0, 0);
+
+    /*The content of the buffers is unknown, so both are fully redrawn*/
+    TEST_ASSERT_EQUAL_UINT32(0, lv_display_get_buf_age(disp));
+    refr_display(disp);
+    TEST_ASSERT_EQUAL_UINT32(480 * 320, render_area_size_sum);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_display_get_buf_age(disp));
+    lv_obj_invalidate(obj1);
+    refr_display(disp);
+    TEST_ASSERT_EQUAL_UINT32(480 * 320, render_area_size_sum);
+    TEST_ASSERT_EQUAL(buf1, lv_display_get_buf_active(disp));
+    TEST_ASSERT_EQUAL_UINT32(2, lv_display_get_buf_age(disp));
+
+    /*No change, nothing is rendered and the buffers are not swapped*/
+    refr_display(disp);
+    TEST_ASSERT_EQUAL_UINT32(0, render_area_cnt);
+    TEST_ASSERT_EQUAL(buf1, lv_display_get_buf_active(disp));
+
+    /*The previous frame's area is redrawn too, which is the same now*/
+    lv_obj_set_style_bg_color(obj1, lv_palette_main(LV_PALETTE_RED), 0);
+    refr_display(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, render_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(100 * 100, render_area_size_sum);
+
+    lv_obj_set_style_bg_color(obj2, lv_palette_main(LV_PALETTE_GREEN), 0);
+    refr_display(disp);
+    TEST_ASSERT_EQUAL_UINT32(2, render_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2 * 100 * 100, render_area_size_sum);
+
+    /*Both buffers are up to date after redrawing obj2 in buf1 too*/
+    lv_obj_invalidate(obj2);
+    refr_display(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, render_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(100 * 100, render_area_size_sum);
+    TEST_ASSERT_EQUAL_MEMORY(buf1->data, buf2->data, buf1->data_size);
+
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf1);
+    lv_draw_buf_destroy(buf2);
+}
+
+void test_display_buf_age_reported(void)
+{
+    lv_display_t * disp = lv_display_create(480, 320);
+    lv_display_set_flush_cb(disp, dummy_flush_cb);
+    lv_draw_buf_t * buf1 = lv_draw_buf_create(480, 320, LV_COLOR_FORMAT_NATIVE, 0);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_display_set_draw_buffers(disp, buf1, NULL);
+
+    lv_obj_t * obj = lv_obj_create(lv_display_get_screen_active(disp));
+    lv_obj_set_size(obj, 100, 100);
+    lv_obj_set_style_border_width(obj, 0, 0);
+    lv_obj_set_style_shadow_width(obj, 0, 0);
+    refr_display(disp);
+    TEST_ASSERT_EQUAL_UINT32(480 * 320, render_area_size_sum);
+
+    /*A single buffer always contains the last frame*/
+    TEST_ASSERT_EQUAL_UINT32(1, lv_display_get_buf_age(disp));
+    lv_obj_invalidate(obj);
+    refr_display(disp);
+    TEST_ASSERT_EQUAL_UINT32(100 * 100, render_area_size_sum);
+
+    /*The driver reports unknown content*/
+    lv_display_set_buf_age(disp, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_display_get_buf_age(disp));
+    lv_obj_invalidate(obj);
+    refr_display(disp);
+    TEST_ASSERT_EQUAL_UINT32(480 * 320, render_area_size_sum);
+
+    /*The reported age is used only for one frame*/
+    TEST_ASSERT_EQUAL_UINT32(1, lv_display_get_buf_age(disp));
+
+    /*The history is kept only while the driver reports the age*/
+    lv_display_set_buf_age(disp, 1);
+    lv_obj_set_pos(obj, 200, 100);
+    refr_display(disp);
+    TEST_ASSERT_EQUAL_UINT32(2 * 100 * 100, render_area_size_sum);
+    lv_display_set_buf_age(disp, 1);
+    lv_obj_set_pos(obj, 300, 200);
+    refr_display(disp);
+
+    /*The driver reports that the buffer missed the last 2 frames*/
+    lv_display_set_buf_age(disp, 3);
+    lv_obj_invalidate(obj);
+    refr_display(disp);
+    TEST_ASSERT_EQUAL_UINT32(3, render_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3 * 100 * 100, render_area_size_sum);
+
+    /*Older frames are not kept*/
+    lv_display_set_buf_age(disp, LV_DISPLAY_DAMAGE_HISTORY_CNT + 1);
+    lv_obj_invalidate(obj);
+    refr_display(disp);
+    TEST_ASSERT_EQUAL_UINT32(480 * 320, render_area_size_sum);
+
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf1);
+}
+
+static uint32_t render_while_flushing_cnt;
+
+static void render_while_flushing_cb(lv_event_t * e)
+{
+    lv_display_t * disp = lv_event_get_target(e);
+    if(disp->flushing) render_while_flushing_cnt++;
+}
+
+/*The flush is finished only when LVGL waits for it*/
+static void pending_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(disp);
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+}
+
+static void pending_flush_wait_cb(lv_display_t * disp)
+{
+    LV_UNUSED(disp);
+}
+
+void test_display_buf_age_double_buffer_waits_for_flushing(void)
+{
+    lv_display_t * disp = lv_display_create(480, 320);
+    lv_display_set_flush_cb(disp, pending_flush_cb);
+    lv_display_set_flush_wait_cb(disp, pending_flush_wait_cb);
+    lv_draw_buf_t * buf1 = lv_draw_buf_create(480, 320, LV_COLOR_FORMAT_NATIVE, 0);
+    lv_draw_buf_t * buf2 = lv_draw_buf_create(480, 320, LV_COLOR_FORMAT_NATIVE, 0);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_display_set_draw_buffers(disp, buf1, buf2);
+    lv_display_add_event_cb(disp, render_while_flushing_cb, LV_EVENT_RENDER_START, NULL);
+
+    /*The other buffer is still on the display, so it's not rendered until its flush is finished*/
+    render_while_flushing_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_obj_invalidate(lv_display_get_screen_active(disp));
+        lv_display_refr_timer(lv_display_get_refr_timer(disp));
+        TEST_ASSERT_TRUE(disp->flushing);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, render_while_flushing_cnt);
+
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf1);
+    lv_draw_buf_destroy(buf2);
+}
+
+/*Simulate a display whose flushing is slow, e.g. DMA over SPI.
+ *The flushes are processed one by one in the order they were started and the time is simulated.*/
+#define SLOW_FLUSH_BAND_H       20
+#define SLOW_FLUSH_TIME         12
+#define SLOW_FLUSH_QUEUE_MAX    8
+
+static uint32_t slow_flush_now;
+static uint32_t slow_flush_channel_free;
+static uint32_t slow_flush_done[SLOW_FLUSH_QUEUE_MAX];
+static uint8_t * slow_flush_px_map[SLOW_FLUSH_QUEUE_MAX];
+static uint32_t slow_flush_queue_cnt;
+static uint32_t slow_flush_queue_max;
+static int32_t slow_flush_row_sum;
+
+static void slow_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(disp);
+
+    /*Rendering every 4th band is expensive, e.g. because of an image*/
+    uint32_t band = area->y1 / SLOW_FLUSH_BAND_H;
+    slow_flush_now += band % 4 == 0 ? 40 : 4;
+    slow_flush_row_sum += lv_area_get_height(area);
+
+    TEST_ASSERT_LESS_THAN_UINT32(SLOW_FLUSH_QUEUE_MAX, slow_flush_queue_cnt);
+    uint32_t start = LV_MAX(slow_flush_now, slow_flush_channel_free);
+    slow_flush_channel_free = start + SLOW_FLUSH_TIME;
+    slow_flush_done[slow_flush_queue_cnt] = slow_flush_channel_free;
+    slow_flush_px_map[slow_flush_queue_cnt] = px_map;
+    slow_flush_queue_cnt++;
+    slow_flush_queue_max = LV_MAX(slow_flush_queue_max, slow_flush_queue_cnt);
+}
+
+static void slow_flush_queue_remove(uint32_t idx)
+{
+    slow_flush_queue_cnt--;
+    lv_memmove(&slow_flush_done[idx], &slow_flush_done[idx + 1], (slow_flush_queue_cnt - idx) * sizeof(uint32_t));
+    lv_memmove(&slow_flush_px_map[idx], &slow_flush_px_map[idx + 1], (slow_flush_queue_cnt - idx) * sizeof(uint8_t *));
+}
+
+/*Wait for the oldest flush*/
+static void slow_flush_wait_cb(lv_display_t * disp)
+{
+    if(slow_flush_queue_cnt == 0) return;
+
+    slow_flush_now = LV_MAX(slow_flush_now, slow_flush_done[0]);
+    slow_flush_queue_remove(0);
+    lv_display_flush_ready(disp);
+}
+
+/*Finish the newest flush first*/
+static void slow_flush_wait_reversed_cb(lv_display_t * disp)
+{
+    if(slow_flush_queue_cnt == 0) return;
+
+    uint32_t last = slow_flush_queue_cnt - 1;
+    uint8_t * px_map = slow_flush_px_map[last];
+    slow_flush_now = LV_MAX(slow_flush_now, slow_flush_channel_free);
+    slow_flush_queue_remove(last);
+    lv_display_flush_ready_buf(disp, px_map);
+}
+
+static uint32_t slow_flush_measure_frame(lv_display_t * disp)
+{
+    slow_flush_now = 0;
+    slow_flush_channel_free = 0;
+    slow_flush_queue_max = 0;
+    slow_flush_row_sum = 0;
+
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_display_refr_timer(lv_display_get_refr_timer(disp));
+    TEST_ASSERT_EQUAL_INT32(lv_display_get_vertical_resolution(disp), slow_flush_row_sum);
+
+    /*Let the last flushes finish too*/
+    while(slow_flush_queue_cnt) slow_flush_wait_cb(disp);
+
+    return LV_MAX(slow_flush_now, slow_flush_channel_free);
+}
+
+static lv_display_t * slow_flush_display_create(lv_draw_buf_t * bufs[], uint32_t cnt)
+{
+    lv_display_t * disp = lv_display_create(480, 320);
+    lv_display_set_flush_cb(disp, slow_flush_cb);
+    lv_display_set_flush_wait_cb(disp, slow_flush_wait_cb);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_PARTIAL);
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        bufs[i] = lv_draw_buf_create(480, SLOW_FLUSH_BAND_H, LV_COLOR_FORMAT_NATIVE, 0);
+    }
+
+    lv_obj_t * obj = lv_obj_create(lv_display_get_screen_active(disp));
+    lv_obj_center(obj);
+
+    slow_flush_queue_cnt = 0;
+    return disp;
+}
+
+static void slow_flush_display_delete(lv_display_t * disp, lv_draw_buf_t * bufs[], uint32_t cnt)
+{
+    lv_display_delete(disp);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_draw_buf_destroy(bufs[i]);
+    }
+}
+
+void test_display_buffer_ring_pipelines_flushing(void)
+{
+    lv_draw_buf_t * bufs[4];
+    lv_display_t * disp = slow_flush_display_create(bufs, 4);
+
+    /*Double buffering: rendering a band waits for the previous flush*/
+    lv_display_set_draw_buffers(disp, bufs[0], bufs[1]);
+    uint32_t time_double = slow_flush_measure_frame(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, slow_flush_queue_max);
+
+    /*A ring of 4 buffers: the cheap bands are rendered while the previous ones are flushed*/
+    lv_display_set_draw_buffer_ring(disp, bufs, 4);
+    TEST_ASSERT_EQUAL_PTR(bufs[0], disp->buf_1);
+    TEST_ASSERT_EQUAL_PTR(bufs[1], disp->buf_2);
+    TEST_ASSERT_EQUAL_PTR(bufs[2], disp->buf_3);
+    uint32_t time_ring = slow_flush_measure_frame(disp);
+    TEST_ASSERT_EQUAL_UINT32(4, slow_flush_queue_max);
+
+    TEST_PRINTF("Simulated frame time: double buffered %" LV_PRIu32 ", 4 buffers in a ring %" LV_PRIu32,
+                time_double, time_ring);
+    TEST_ASSERT_LESS_THAN_UINT32(time_double * 9 / 10, time_ring);
+
+    slow_flush_display_delete(disp, bufs, 4);
+}
+
+void test_display_buffer_ring_flush_ready_out_of_order(void)
+{
+    lv_draw_buf_t * bufs[3];
+    lv_display_t * disp = slow_flush_display_create(bufs, 3);
+    lv_display_set_draw_buffer_ring(disp, bufs, 3);
+    lv_display_set_flush_wait_cb(disp, slow_flush_wait_reversed_cb);
+
+    slow_flush_measure_frame(disp);
+    TEST_ASSERT_EQUAL_UINT32(3, slow_flush_queue_max);
+
+    /*All the flushes are finished*/
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, disp->buf_ring[i].flush_id);
+    }
+
+    /*Setting other buffers drops the ring*/
+    lv_display_set_draw_buffers(disp, bufs[0], NULL);
+    TEST_ASSERT_NULL(disp->buf_ring);
+
+    slow_flush_display_delete(disp, bufs, 3);
+}
+
+/*Keep the flushed pixels to check that they are the same as the rendered ones*/
+#define PANEL_HOR_RES   320
+#define PANEL_VER_RES   240
+
+static uint16_t * panel_px;
+static uint32_t panel_flushed_px_cnt;
+static uint32_t panel_flush_cnt;
+static uint32_t panel_flush_last_cnt;
+
+static void panel_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    int32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&panel_px[y * PANEL_HOR_RES + area->x1], px_map, w * sizeof(uint16_t));
+        px_map += stride;
+    }
+
+    panel_flushed_px_cnt += lv_area_get_size(area);
+    panel_flush_cnt++;
+    if(lv_display_flush_is_last(disp)) panel_flush_last_cnt++;
+    lv_display_flush_ready(disp);
+}
+
+static void panel_refr(lv_display_t * disp)
+{
+    panel_flushed_px_cnt = 0;
+    panel_flush_cnt = 0;
+    panel_flush_last_cnt = 0;
+    lv_display_refr_timer(lv_display_get_refr_timer(disp));
+}
+
+static void panel_assert_up_to_date(lv_display_t * disp)
+{
+    lv_draw_buf_t * snapshot = lv_snapshot_take(lv_display_get_screen_active(disp), LV_COLOR_FORMAT_RGB565);
+    TEST_ASSERT_NOT_NULL(snapshot);
+    int32_t y;
+    for(y = 0; y < PANEL_VER_RES; y++) {
+        TEST_ASSERT_EQUAL_MEMORY(snapshot->data + y * snapshot->header.stride, &panel_px[y * PANEL_HOR_RES],
+                                 PANEL_HOR_RES * sizeof(uint16_t));
+    }
+
+    lv_draw_buf_destroy(snapshot);
+}
+
+void test_display_flush_skip_unchanged(void)
+{
+    panel_px = lv_malloc_zeroed(PANEL_HOR_RES * PANEL_VER_RES * sizeof(uint16_t));
+    lv_display_t * disp = lv_display_create(PANEL_HOR_RES, PANEL_VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_flush_cb(disp, panel_flush_cb);
+    lv_draw_buf_t * buf = lv_draw_buf_create(PANEL_HOR_RES, 80, LV_COLOR_FORMAT_RGB565, 0);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_draw_buffers(disp, buf, NULL);
+    lv_display_set_flush_skip_unchanged(disp, true);
+    TEST_ASSERT_TRUE(lv_display_get_flush_skip_unchanged(disp));
+
+    /*Compare only the screen with the flushed pixels, without the system monitors*/
+    lv_obj_add_flag(lv_display_get_layer_sys(disp), LV_OBJ_FLAG_HIDDEN);
+
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_t * label = lv_label_create(scr);
+    lv_obj_set_pos(label, 45, 100);
+    lv_label_set_text(label, "12.5 V");
+    lv_obj_t * bar = lv_bar_create(scr);
+    lv_obj_set_pos(bar, 150, 20);
+    lv_bar_set_value(bar, 30, LV_ANIM_OFF);
+
+    /*All pixels are flushed first, in bands whose height is a multiple of the tile size*/
+    panel_refr(disp);
+    TEST_ASSERT_EQUAL_UINT32(PANEL_HOR_RES * PANEL_VER_RES, panel_flushed_px_cnt);
+    TEST_ASSERT_EQUAL_UINT32(4, panel_flush_cnt);
+    panel_assert_up_to_date(disp);
+
+    /*Setting the same text renders the label again but doesn't flush*/
+    lv_label_set_text(label, "12.5 V");
+    lv_obj_invalidate(bar);
+    panel_refr(disp);
+    TEST_ASSERT_EQUAL_UINT32(0, panel_flush_cnt);
+
+    /*Only the changed tiles are flushed, and a tile of the unchanged last area to report the last flush*/
+    lv_label_set_text(label, "12.6 V");
+    panel_refr(disp);
+    TEST_ASSERT_EQUAL_UINT32(2, panel_flush_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(3 * LV_DISPLAY_FLUSH_TILE_SIZE * LV_DISPLAY_FLUSH_TILE_SIZE, panel_flushed_px_cnt);
+    panel_assert_up_to_date(disp);
+
+    /*The same on the whole screen*/
+    lv_bar_set_value(bar, 60, LV_ANIM_OFF);
+    lv_obj_invalidate(scr);
+    panel_refr(disp);
+    TEST_ASSERT_LESS_THAN_UINT32(PANEL_HOR_RES * PANEL_VER_RES / 4, panel_flushed_px_cnt);
+    panel_assert_up_to_date(disp);
+
+    /*Everything is flushed again if it's disabled*/
+    lv_display_set_flush_skip_unchanged(disp, false);
+    lv_obj_invalidate(scr);
+    panel_refr(disp);
+    TEST_ASSERT_EQUAL_UINT32(PANEL_HOR_RES * PANEL_VER_RES, panel_flushed_px_cnt);
+
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf);
+    lv_free(panel_px);
+}
+
+void test_display_flush_skip_unchanged_reports_last_flush(void)
+{
+    panel_px = lv_malloc_zeroed(PANEL_HOR_RES * PANEL_VER_RES * sizeof(uint16_t));
+    lv_display_t * disp = lv_display_create(PANEL_HOR_RES, PANEL_VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_flush_cb(disp, panel_flush_cb);
+    lv_draw_buf_t * buf = lv_draw_buf_create(PANEL_HOR_RES, 80, LV_COLOR_FORMAT_RGB565, 0);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_draw_buffers(disp, buf, NULL);
+    lv_display_set_flush_skip_unchanged(disp, true);
+    lv_obj_add_flag(lv_display_get_layer_sys(disp), LV_OBJ_FLAG_HIDDEN);
+
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_t * bar = lv_bar_create(scr);
+    lv_obj_set_pos(bar, 150, 20);
+    lv_bar_set_value(bar, 30, LV_ANIM_OFF);
+    panel_refr(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, panel_flush_last_cnt);
+
+    /*Only the top band changes, but the last band still reports the end of the refresh with one tile*/
+    lv_bar_set_value(bar, 60, LV_ANIM_OFF);
+    lv_obj_invalidate(scr);
+    panel_refr(disp);
+    TEST_ASSERT_EQUAL_UINT32(2, panel_flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, panel_flush_last_cnt);
+    panel_assert_up_to_date(disp);
+
+    /*Nothing is flushed if nothing changed*/
+    lv_obj_invalidate(scr);
+    panel_refr(disp);
+    TEST_ASSERT_EQUAL_UINT32(0, panel_flush_cnt);
+
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf);
+    lv_free(panel_px);
+}
+
 #endif
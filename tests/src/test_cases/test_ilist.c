@@ -0,0 +1,114 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../src/misc/lv_ilist.h"
+#include "unity/unity.h"
+
+typedef struct {
+    int32_t value;
+    lv_ilist_link_t link;
+} item_t;
+
+/* Test fixture */
+static lv_ilist_t test_list;
+static item_t items[4];
+
+void setUp(void)
+{
+    lv_ilist_init(&test_list, offsetof(item_t, link));
+    lv_memzero(items, sizeof(items));
+}
+
+void tearDown(void)
+{
+    /* The items are not owned by the list */
+}
+
+void test_ilist_init(void)
+{
+    TEST_ASSERT_NULL(lv_ilist_get_head(&test_list));
+    TEST_ASSERT_NULL(lv_ilist_get_tail(&test_list));
+    TEST_ASSERT_TRUE(lv_ilist_is_empty(&test_list));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_ilist_get_len(&test_list));
+}
+
+void test_ilist_ins_head(void)
+{
+    lv_ilist_ins_head(&test_list, &items[0]);
+    TEST_ASSERT_EQUAL_PTR(&items[0], lv_ilist_get_head(&test_list));
+    TEST_ASSERT_EQUAL_PTR(&items[0], lv_ilist_get_tail(&test_list));
+
+    lv_ilist_ins_head(&test_list, &items[1]);
+    TEST_ASSERT_EQUAL_PTR(&items[1], lv_ilist_get_head(&test_list));
+    TEST_ASSERT_EQUAL_PTR(&items[0], lv_ilist_get_tail(&test_list));
+    TEST_ASSERT_EQUAL_PTR(&items[0], lv_ilist_get_next(&test_list, &items[1]));
+    TEST_ASSERT_EQUAL_PTR(&items[1], lv_ilist_get_prev(&test_list, &items[0]));
+    TEST_ASSERT_NULL(lv_ilist_get_prev(&test_list, &items[1]));
+    TEST_ASSERT_NULL(lv_ilist_get_next(&test_list, &items[0]));
+}
+
+void test_ilist_ins_tail(void)
+{
+    lv_ilist_ins_tail(&test_list, &items[0]);
+    TEST_ASSERT_EQUAL_PTR(&items[0], lv_ilist_get_head(&test_list));
+    TEST_ASSERT_EQUAL_PTR(&items[0], lv_ilist_get_tail(&test_list));
+
+    lv_ilist_ins_tail(&test_list, &items[1]);
+    TEST_ASSERT_EQUAL_PTR(&items[0], lv_ilist_get_head(&test_list));
+    TEST_ASSERT_EQUAL_PTR(&items[1], lv_ilist_get_tail(&test_list));
+    TEST_ASSERT_EQUAL_UINT32(2, lv_ilist_get_len(&test_list));
+}
+
+void test_ilist_remove(void)
+{
+    uint32_t i;
+    for(i = 0; i < 4; i++) lv_ilist_ins_tail(&test_list, &items[i]);
+
+    /* Middle */
+    lv_ilist_remove(&test_list, &items[1]);
+    TEST_ASSERT_EQUAL_PTR(&items[2], lv_ilist_get_next(&test_list, &items[0]));
+    TEST_ASSERT_EQUAL_PTR(&items[0], lv_ilist_get_prev(&test_list, &items[2]));
+
+    /* Head */
+    lv_ilist_remove(&test_list, &items[0]);
+    TEST_ASSERT_EQUAL_PTR(&items[2], lv_ilist_get_head(&test_list));
+    TEST_ASSERT_NULL(lv_ilist_get_prev(&test_list, &items[2]));
+
+    /* Tail */
+    lv_ilist_remove(&test_list, &items[3]);
+    TEST_ASSERT_EQUAL_PTR(&items[2], lv_ilist_get_tail(&test_list));
+    TEST_ASSERT_NULL(lv_ilist_get_next(&test_list, &items[2]));
+
+    /* Last one */
+    lv_ilist_remove(&test_list, &items[2]);
+    TEST_ASSERT_TRUE(lv_ilist_is_empty(&test_list));
+    TEST_ASSERT_NULL(lv_ilist_get_tail(&test_list));
+
+    /* A removed item can be added again */
+    lv_ilist_ins_head(&test_list, &items[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_ilist_get_len(&test_list));
+}
+
+void test_ilist_read(void)
+{
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        items[i].value = (int32_t)i;
+        lv_ilist_ins_tail(&test_list, &items[i]);
+    }
+
+    item_t * item;
+    int32_t expected = 0;
+    LV_ILIST_READ(&test_list, item) {
+        TEST_ASSERT_EQUAL_INT32(expected, item->value);
+        expected++;
+    }
+    TEST_ASSERT_EQUAL_INT32(4, expected);
+
+    LV_ILIST_READ_BACK(&test_list, item) {
+        expected--;
+        TEST_ASSERT_EQUAL_INT32(expected, item->value);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, expected);
+}
+
+#endif
@@ -0,0 +1,170 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * parent;
+static lv_obj_t * cont;
+static lv_obj_t * label;
+static uint32_t draw_cnt;
+
+static void draw_main_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    draw_cnt++;
+}
+
+static lv_obj_t * cached_cont_create(lv_obj_t * par)
+{
+    lv_obj_t * obj = lv_obj_create(par);
+    lv_obj_set_size(obj, 200, 150);
+    lv_obj_set_flex_flow(obj, LV_FLEX_FLOW_COLUMN);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_CACHE_BITMAP);
+
+    lv_obj_t * btn = lv_button_create(obj);
+    lv_obj_t * btn_label = lv_label_create(btn);
+    lv_label_set_text(btn_label, "Button");
+
+    lv_obj_t * slider = lv_slider_create(obj);
+    lv_obj_set_width(slider, 120);
+
+    return obj;
+}
+
+void setUp(void)
+{
+    lv_obj_bitmap_cache_resize(512 * 1024, true);
+
+    parent = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(parent, 300, 400);
+
+    lv_obj_t * spacer = lv_obj_create(parent);
+    lv_obj_set_pos(spacer, 0, 500);
+
+    cont = cached_cont_create(parent);
+    lv_obj_set_pos(cont, 20, 50);
+
+    label = lv_label_create(cont);
+    lv_label_set_text(label, "Cached label");
+    lv_obj_add_event_cb(label, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    draw_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    TEST_ASSERT_EQUAL_UINT32(0, lv_obj_bitmap_cache_get_size());
+    lv_obj_bitmap_cache_resize(0, true);
+}
+
+/*Take a snapshot of the screen and compare it with the one taken without the cached bitmap.
+ *Blending the ARGB8888 bitmap can cause small rounding differences.*/
+static void assert_same_as_without_bitmap(void)
+{
+    lv_draw_buf_t * snapshot = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot);
+
+    lv_obj_remove_flag(cont, LV_OBJ_FLAG_CACHE_BITMAP);
+    lv_draw_buf_t * snapshot_ref = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot_ref);
+    lv_obj_add_flag(cont, LV_OBJ_FLAG_CACHE_BITMAP);
+
+    TEST_ASSERT_EQUAL_UINT32(snapshot_ref->data_size, snapshot->data_size);
+    uint32_t i;
+    for(i = 0; i < snapshot->data_size; i++) {
+        TEST_ASSERT_UINT8_WITHIN(4, snapshot_ref->data[i], snapshot->data[i]);
+    }
+
+    lv_draw_buf_destroy(snapshot);
+    lv_draw_buf_destroy(snapshot_ref);
+}
+
+void test_bitmap_is_drawn_until_invalidated(void)
+{
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, lv_obj_bitmap_cache_get_size());
+
+    /*The children are not drawn again*/
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    assert_same_as_without_bitmap();
+}
+
+void test_bitmap_is_moved_on_scroll(void)
+{
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    /*Scroll only the children as the animations and the input devices do*/
+    lv_obj_scroll_by_raw(parent, 0, -30);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    assert_same_as_without_bitmap();
+}
+
+void test_bitmap_is_dropped_on_change(void)
+{
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+    uint32_t size = lv_obj_bitmap_cache_get_size();
+
+    lv_label_set_text(label, "Changed label");
+    TEST_ASSERT_EQUAL_UINT32(0, lv_obj_bitmap_cache_get_size());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_cnt);
+    TEST_ASSERT_EQUAL_UINT32(size, lv_obj_bitmap_cache_get_size());
+
+    /*The opacity of the parent is rendered into the bitmap too*/
+    lv_obj_set_style_opa(parent, LV_OPA_50, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, draw_cnt);
+
+    assert_same_as_without_bitmap();
+
+    lv_obj_remove_flag(cont, LV_OBJ_FLAG_CACHE_BITMAP);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_obj_bitmap_cache_get_size());
+}
+
+void test_least_recently_used_bitmap_is_freed(void)
+{
+    lv_refr_now(NULL);
+    uint32_t size = lv_obj_bitmap_cache_get_size();
+
+    /*Allow only one bitmap*/
+    lv_obj_bitmap_cache_resize(size + size / 2, false);
+    TEST_ASSERT_EQUAL_UINT32(size, lv_obj_bitmap_cache_get_size());
+
+    lv_obj_t * cont2 = cached_cont_create(lv_screen_active());
+    lv_obj_align(cont2, LV_ALIGN_RIGHT_MID, 0, 0);
+    lv_obj_add_flag(parent, LV_OBJ_FLAG_HIDDEN);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(size, lv_obj_bitmap_cache_get_size());
+
+    /*The bitmap of `cont` was freed*/
+    lv_obj_remove_flag(parent, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(cont2, LV_OBJ_FLAG_HIDDEN);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_cnt);
+    TEST_ASSERT_EQUAL_UINT32(size, lv_obj_bitmap_cache_get_size());
+}
+
+void test_too_large_widget_is_drawn_normally(void)
+{
+    lv_obj_bitmap_cache_resize(1024, true);
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_obj_bitmap_cache_get_size());
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_cnt);
+}
+
+#endif
@@ -0,0 +1,203 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * cont;
+
+static lv_obj_t * create_child(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    lv_obj_t * obj = lv_obj_create(cont);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    return obj;
+}
+
+static lv_obj_t * search(int32_t x, int32_t y)
+{
+    lv_obj_update_layout(lv_screen_active());
+
+    /*The index might be built only on the second search after a change*/
+    lv_point_t p = {x, y};
+    lv_obj_t * found = lv_indev_search_obj(lv_screen_active(), &p);
+    p.x = x;
+    p.y = y;
+    TEST_ASSERT_EQUAL_PTR(found, lv_indev_search_obj(lv_screen_active(), &p));
+    return found;
+}
+
+void setUp(void)
+{
+    cont = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(cont);
+    lv_obj_set_size(cont, 400, 400);
+
+    /*10 x 10 children next to each other*/
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        create_child((i % 10) * 40, (i / 10) * 40, 40, 40);
+    }
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_hit_index_finds_the_children(void)
+{
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        TEST_ASSERT_EQUAL_PTR(lv_obj_get_child(cont, i), search((i % 10) * 40 + 20, (i / 10) * 40 + 20));
+        TEST_ASSERT_EQUAL_PTR(lv_obj_get_child(cont, i), search((i % 10) * 40 + 39, (i / 10) * 40));
+    }
+
+    TEST_ASSERT_EQUAL_PTR(lv_screen_active(), search(500, 100));
+
+#if LV_OBJ_HIT_INDEX_MIN_CHILDREN
+    TEST_ASSERT_NOT_NULL(cont->spec_attr->hit_index);
+    TEST_ASSERT_TRUE(cont->spec_attr->hit_index->valid);
+#endif
+}
+
+void test_hit_index_keeps_the_order_of_the_children(void)
+{
+    lv_obj_t * top = create_child(20, 20, 40, 40);
+    TEST_ASSERT_EQUAL_PTR(top, search(30, 30));
+    TEST_ASSERT_EQUAL_PTR(lv_obj_get_child(cont, 0), search(10, 10));
+
+    lv_obj_move_to_index(top, 0);
+    TEST_ASSERT_EQUAL_PTR(lv_obj_get_child(cont, 1), search(30, 30));
+
+    lv_obj_swap(top, lv_obj_get_child(cont, 100));
+    TEST_ASSERT_EQUAL_PTR(top, search(30, 30));
+}
+
+void test_hit_index_updates_with_the_children(void)
+{
+    lv_obj_t * child = lv_obj_get_child(cont, 11);
+    TEST_ASSERT_EQUAL_PTR(child, search(50, 50));
+
+    /*Moved*/
+    lv_obj_set_pos(child, 500, 0);
+    lv_obj_set_parent(lv_obj_get_child(cont, 0), lv_screen_active());
+    TEST_ASSERT_EQUAL_PTR(cont, search(50, 50));
+
+    /*Hidden*/
+    child = lv_obj_get_child(cont, 20);
+    TEST_ASSERT_EQUAL_PTR(child, search(50, 90));
+    lv_obj_add_flag(child, LV_OBJ_FLAG_HIDDEN);
+    TEST_ASSERT_EQUAL_PTR(cont, search(50, 90));
+    lv_obj_remove_flag(child, LV_OBJ_FLAG_HIDDEN);
+    TEST_ASSERT_EQUAL_PTR(child, search(50, 90));
+
+    /*Larger click area*/
+    child = lv_obj_get_child(cont, 30);
+    lv_obj_set_ext_click_area(child, 10);
+    TEST_ASSERT_EQUAL_PTR(child, search(45, 115));
+
+    /*Deleted*/
+    lv_obj_delete(child);
+    TEST_ASSERT_EQUAL_PTR(lv_obj_get_child(cont, 20), search(45, 115));
+
+    /*Created*/
+    child = create_child(200, 200, 10, 10);
+    TEST_ASSERT_EQUAL_PTR(child, search(205, 205));
+}
+
+void test_hit_index_scroll(void)
+{
+    /*Make it scrollable*/
+    uint32_t i;
+    for(i = 100; i < 200; i++) {
+        create_child((i % 10) * 40, (i / 10) * 40, 40, 40);
+    }
+
+    lv_obj_t * floating = create_child(0, 0, 40, 40);
+    lv_obj_add_flag(floating, LV_OBJ_FLAG_FLOATING);
+    TEST_ASSERT_EQUAL_PTR(lv_obj_get_child(cont, 11), search(50, 50));
+
+    lv_obj_scroll_to_y(cont, 210, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_PTR(lv_obj_get_child(cont, 61), search(50, 50));
+    TEST_ASSERT_EQUAL_PTR(lv_obj_get_child(cont, 135), search(220, 340));
+    TEST_ASSERT_EQUAL_PTR(floating, search(20, 20));
+
+    /*The parent is moved*/
+    lv_obj_set_pos(cont, 100, 0);
+    TEST_ASSERT_EQUAL_PTR(lv_obj_get_child(cont, 61), search(150, 50));
+    TEST_ASSERT_EQUAL_PTR(floating, search(120, 20));
+    TEST_ASSERT_EQUAL_PTR(lv_screen_active(), search(50, 50));
+}
+
+void test_hit_index_transformed_child(void)
+{
+    lv_obj_t * child = lv_obj_get_child(cont, 99);
+    TEST_ASSERT_EQUAL_PTR(lv_obj_get_child(cont, 88), search(350, 350));
+
+    /*Scaled from its center to cover the neighbors*/
+    lv_obj_set_style_transform_pivot_x(child, 20, 0);
+    lv_obj_set_style_transform_pivot_y(child, 20, 0);
+    lv_obj_set_style_transform_scale(child, 512, 0);
+    TEST_ASSERT_EQUAL_PTR(child, search(350, 350));
+}
+
+void test_hit_index_matches_the_top_child(void)
+{
+    lv_obj_clean(cont);
+
+    /*Overlapping children of various sizes*/
+    uint32_t seed = 1;
+    uint32_t i;
+    for(i = 0; i < 300; i++) {
+        seed = seed * 1103515245 + 12345;
+        int32_t x = (seed >> 8) % 380;
+        int32_t y = (seed >> 16) % 380;
+        int32_t w = 1 + (int32_t)((seed >> 4) % (i % 10 == 0 ? 200 : 30));
+        int32_t h = 1 + (int32_t)((seed >> 12) % (i % 10 == 0 ? 200 : 30));
+        create_child(x, y, w, h);
+    }
+    lv_obj_update_layout(cont);
+
+    for(i = 0; i < 1000; i++) {
+        seed = seed * 1103515245 + 12345;
+        lv_point_t p = {(int32_t)((seed >> 8) % 400), (int32_t)((seed >> 16) % 400)};
+
+        /*The last child with the point on it*/
+        lv_obj_t * expected = cont;
+        int32_t j;
+        for(j = (int32_t)lv_obj_get_child_count(cont) - 1; j >= 0; j--) {
+            lv_obj_t * child = lv_obj_get_child(cont, j);
+            if(lv_area_is_point_on(&child->coords, &p, 0)) {
+                expected = child;
+                break;
+            }
+        }
+
+        TEST_ASSERT_EQUAL_PTR(expected, search(p.x, p.y));
+    }
+}
+
+void test_hit_index_is_freed(void)
+{
+    search(10, 10);
+
+    size_t mem = lv_test_get_free_mem();
+    lv_obj_t * cont2 = cont;
+    setUp();
+    search(10, 10);
+    lv_obj_delete(cont);
+    cont = cont2;
+
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem, 32);
+
+    /*Freed when the children are deleted*/
+    lv_obj_clean(cont);
+    TEST_ASSERT_EQUAL_PTR(cont, search(10, 10));
+#if LV_OBJ_HIT_INDEX_MIN_CHILDREN
+    TEST_ASSERT_NULL(cont->spec_attr->hit_index);
+#endif
+}
+
+#endif
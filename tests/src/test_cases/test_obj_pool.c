@@ -0,0 +1,160 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_slab_alloc_free(void)
+{
+    size_t mem = lv_test_get_free_mem();
+
+    lv_slab_t slab;
+    lv_slab_init(&slab, 20, 256);
+    TEST_ASSERT_EQUAL(24, slab.item_size);
+    TEST_ASSERT_GREATER_THAN(1, slab.item_cnt);
+
+    uint32_t * items[64];
+    uint32_t i;
+    for(i = 0; i < 64; i++) {
+        items[i] = lv_slab_alloc(&slab);
+        TEST_ASSERT_NOT_NULL(items[i]);
+        lv_memset(items[i], (int)i, 24);
+    }
+
+    TEST_ASSERT_EQUAL(64, slab.used_cnt);
+    TEST_ASSERT_EQUAL((64 + slab.item_cnt - 1) / slab.item_cnt, slab.chunk_cnt);
+    TEST_ASSERT_EQUAL(slab.chunk_cnt * slab.chunk_ll.n_size, lv_slab_get_size(&slab));
+
+    /*The items don't overlap*/
+    for(i = 0; i < 64; i++) {
+        TEST_ASSERT_EACH_EQUAL_UINT8(i, items[i], 24);
+    }
+
+    /*A freed item is reused*/
+    lv_slab_free(items[10]);
+    TEST_ASSERT_EQUAL_PTR(items[10], lv_slab_alloc(&slab));
+
+    /*The chunks are freed when they become empty*/
+    for(i = 0; i < 64; i++) {
+        lv_slab_free(items[i]);
+    }
+    TEST_ASSERT_EQUAL(0, slab.used_cnt);
+    TEST_ASSERT_EQUAL(0, slab.chunk_cnt);
+
+    lv_slab_deinit(&slab);
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem, 0);
+}
+
+void test_slab_deinit(void)
+{
+    size_t mem = lv_test_get_free_mem();
+
+    lv_slab_t slab;
+    lv_slab_init(&slab, 100, 0);
+    TEST_ASSERT_EQUAL(1, slab.item_cnt);
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        TEST_ASSERT_NOT_NULL(lv_slab_alloc(&slab));
+    }
+    TEST_ASSERT_EQUAL(10, slab.chunk_cnt);
+
+    lv_slab_deinit(&slab);
+    TEST_ASSERT_EQUAL(0, slab.chunk_cnt);
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem, 0);
+}
+
+void test_obj_pool_realloc(void)
+{
+    size_t mem = lv_test_get_free_mem();
+
+    uint8_t * p = lv_obj_pool_alloc(10);
+    TEST_ASSERT_NOT_NULL(p);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, p, 10);
+    lv_memset(p, 0x55, 10);
+
+#if LV_OBJ_POOL_CHUNK_SIZE
+    /*The same size class*/
+    TEST_ASSERT_EQUAL_PTR(p, lv_obj_pool_realloc(p, 10, LV_OBJ_POOL_CLASS_SIZE));
+#endif
+
+    /*Move to a larger class and to the heap*/
+    p = lv_obj_pool_realloc(p, 10, 100);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0x55, p, 10);
+    p = lv_obj_pool_realloc(p, 100, 2000);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0x55, p, 10);
+    p = lv_obj_pool_realloc(p, 2000, 20);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0x55, p, 10);
+
+    lv_obj_pool_free(p, 20);
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem, 0);
+}
+
+typedef struct {
+    lv_obj_t obj;
+    uint8_t data[1000];
+} large_obj_t;
+
+static const lv_obj_class_t large_obj_class = {
+    .base_class = &lv_obj_class,
+    .instance_size = sizeof(large_obj_t),
+    .name = "large_obj",
+};
+
+void test_obj_pool_large_widget(void)
+{
+    size_t mem = lv_test_get_free_mem();
+
+    /*Too large to be pooled. It's freed to the heap after the destructors reset its class.*/
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_t * obj = lv_obj_class_create_obj(&large_obj_class, lv_screen_active());
+        lv_obj_class_init_obj(obj);
+        lv_obj_delete(obj);
+    }
+
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem, 32);
+}
+
+void test_obj_pool_monitor(void)
+{
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_obj_allocate_spec_attr(parent);    /*It's kept after deleting the children*/
+    size_t mem = lv_test_get_free_mem();
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    size_t pool_used = mon.obj_pool_used_size;
+
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        lv_obj_t * label = lv_label_create(parent);
+        lv_obj_set_style_text_color(label, lv_color_hex(0xff0000), 0);
+    }
+
+    lv_mem_monitor(&mon);
+#if LV_OBJ_POOL_CHUNK_SIZE
+    TEST_ASSERT_GREATER_THAN(pool_used + 200 * sizeof(lv_label_t), mon.obj_pool_used_size);
+    TEST_ASSERT_GREATER_OR_EQUAL(mon.obj_pool_used_size, mon.obj_pool_size);
+#else
+    TEST_ASSERT_EQUAL(0, mon.obj_pool_size);
+    TEST_ASSERT_EQUAL(0, mon.obj_pool_used_size);
+#endif
+
+    lv_obj_clean(parent);
+
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL(pool_used, mon.obj_pool_used_size);
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem, 32);
+}
+
+#endif
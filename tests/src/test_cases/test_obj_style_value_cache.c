@@ -0,0 +1,231 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * obj;
+static lv_style_t style;
+static lv_style_t style_pr;
+
+void setUp(void)
+{
+    lv_style_init(&style);
+    lv_style_set_bg_color(&style, lv_color_hex(0x112233));
+    lv_style_set_radius(&style, 7);
+
+    lv_style_init(&style_pr);
+    lv_style_set_bg_color(&style_pr, lv_color_hex(0x445566));
+
+    obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    lv_obj_add_style(obj, &style, 0);
+    lv_obj_add_style(obj, &style_pr, LV_STATE_PRESSED);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_style_reset(&style);
+    lv_style_reset(&style_pr);
+}
+
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+static void assert_bg_color(uint32_t hex)
+{
+    TEST_ASSERT_EQUAL_HEX32(hex, lv_color_to_u32(lv_obj_get_style_bg_color(obj, LV_PART_MAIN)) & 0xffffff);
+}
+#endif
+
+void test_style_value_cache_hit(void)
+{
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    uint32_t hit_cnt;
+    uint32_t miss_cnt;
+
+    lv_obj_style_value_cache_reset_stats();
+    TEST_ASSERT_EQUAL_INT32(7, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    lv_obj_style_value_cache_get_stats(&hit_cnt, &miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, miss_cnt);
+
+    /*The default values are cached too*/
+    TEST_ASSERT_EQUAL_INT32(7, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_style_border_width(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_style_border_width(obj, LV_PART_MAIN));
+    lv_obj_style_value_cache_get_stats(&hit_cnt, &miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, miss_cnt);
+
+    /*Inherited properties are not cached*/
+    lv_obj_style_value_cache_reset_stats();
+    lv_obj_get_style_text_color(obj, LV_PART_MAIN);
+    lv_obj_get_style_text_color(obj, LV_PART_MAIN);
+    lv_obj_style_value_cache_get_stats(&hit_cnt, &miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, miss_cnt);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_style_value_cache_local_style_change(void)
+{
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    TEST_ASSERT_EQUAL_INT32(7, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    lv_obj_set_style_radius(obj, 12, 0);
+    TEST_ASSERT_EQUAL_INT32(12, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_RADIUS, 0);
+    TEST_ASSERT_EQUAL_INT32(7, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    /*Also if the style refresh is disabled*/
+    lv_obj_enable_style_refresh(false);
+    lv_obj_set_style_radius(obj, 3, 0);
+    lv_obj_enable_style_refresh(true);
+    TEST_ASSERT_EQUAL_INT32(3, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    lv_obj_remove_style(obj, &style, 0);
+    assert_bg_color(0xffffff);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_style_value_cache_shared_style_change(void)
+{
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    TEST_ASSERT_EQUAL_INT32(7, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    lv_style_set_radius(&style, 9);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL_INT32(9, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    /*Also if the style refresh is disabled*/
+    lv_obj_enable_style_refresh(false);
+    lv_style_set_radius(&style, 5);
+    lv_obj_report_style_change(&style);
+    lv_obj_enable_style_refresh(true);
+    TEST_ASSERT_EQUAL_INT32(5, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    lv_obj_style_set_disabled(obj, &style, 0, true);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_style_value_cache_state_change(void)
+{
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    uint32_t hit_cnt;
+
+    assert_bg_color(0x112233);
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    assert_bg_color(0x445566);
+    lv_obj_remove_state(obj, LV_STATE_PRESSED);
+    assert_bg_color(0x112233);
+
+    /*The same state and values again*/
+    lv_obj_style_value_cache_reset_stats();
+    assert_bg_color(0x112233);
+    lv_obj_style_value_cache_get_stats(&hit_cnt, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, hit_cnt);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_style_value_cache_transition(void)
+{
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    static const lv_style_prop_t props[] = {LV_STYLE_BG_COLOR, 0};
+    lv_style_transition_dsc_t tr;
+    lv_style_transition_dsc_init(&tr, props, lv_anim_path_linear, 100, 0, NULL);
+    lv_style_set_transition(&style_pr, &tr);
+    lv_style_set_transition(&style, &tr);
+    lv_obj_report_style_change(NULL);
+
+    /*Transitions are started only on rendered widgets*/
+    lv_refr_now(NULL);
+
+    assert_bg_color(0x112233);
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    assert_bg_color(0x112233);
+
+    /*The intermediate value is neither the start nor the end*/
+    lv_test_wait(50);
+    uint32_t c = lv_color_to_u32(lv_obj_get_style_bg_color(obj, LV_PART_MAIN)) & 0xffffff;
+    TEST_ASSERT_NOT_EQUAL_UINT32(0x112233, c);
+    TEST_ASSERT_NOT_EQUAL_UINT32(0x445566, c);
+
+    lv_test_wait(100);
+    assert_bg_color(0x445566);
+
+    /*Interrupt a transition by changing the state back*/
+    lv_obj_remove_state(obj, LV_STATE_PRESSED);
+    lv_test_wait(30);
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    lv_test_wait(200);
+    assert_bg_color(0x445566);
+    lv_obj_remove_state(obj, LV_STATE_PRESSED);
+    lv_test_wait(200);
+    assert_bg_color(0x112233);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_style_value_cache_deleted_widget(void)
+{
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    TEST_ASSERT_EQUAL_INT32(7, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    lv_obj_delete(obj);
+
+    /*A new widget might be allocated at the same address but it starts without cached values*/
+    obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_style_value_cache_full(void)
+{
+#if LV_OBJ_STYLE_VALUE_CACHE_SIZE
+    /*More values than a cache can store: the cache is cleared and refilled*/
+    static const lv_part_t parts[] = {LV_PART_MAIN, LV_PART_SCROLLBAR, LV_PART_INDICATOR, LV_PART_KNOB, LV_PART_SELECTED};
+    uint32_t i;
+    lv_style_prop_t prop;
+    for(i = 0; i < sizeof(parts) / sizeof(parts[0]); i++) {
+        for(prop = 1; prop < LV_STYLE_NUM_BUILT_IN_PROPS; prop++) {
+            lv_style_value_t v1 = lv_obj_get_style_prop(obj, parts[i], prop);
+            lv_style_value_t v2 = lv_obj_get_style_prop(obj, parts[i], prop);
+            TEST_ASSERT_EQUAL_INT32(v1.num, v2.num);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT32(7, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    /*More caches than the memory budget allows: the other widgets resolve the values without a cache*/
+    uint32_t cnt = LV_OBJ_STYLE_VALUE_CACHE_SIZE / 64;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_t * o = lv_obj_create(lv_screen_active());
+        lv_obj_remove_style_all(o);
+        lv_obj_add_style(o, &style, 0);
+        lv_obj_set_style_radius(o, i % 100, 0);
+        TEST_ASSERT_EQUAL_INT32(i % 100, lv_obj_get_style_radius(o, LV_PART_MAIN));
+    }
+
+    for(i = 0; i < cnt; i++) {
+        lv_obj_t * o = lv_obj_get_child(lv_screen_active(), i + 1);
+        lv_obj_set_style_radius(o, (i + 1) % 100, 0);
+        TEST_ASSERT_EQUAL_INT32((i + 1) % 100, lv_obj_get_style_radius(o, LV_PART_MAIN));
+    }
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
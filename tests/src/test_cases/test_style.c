@@ -226,4 +226,70 @@ void test_style_has_prop(void)
     lv_style_reset(&style);
 }
 
+void test_style_large_sorted(void)
+{
+    lv_style_t style;
+    lv_style_init(&style);
+
+    /*Set the properties in a scrambled order to make the style larger than the sorted limit
+     *and the width of the SIMD search*/
+    const uint32_t prop_cnt = LV_STYLE_SORTED_PROP_CNT_MIN * 5;
+    uint32_t i;
+    for(i = 0; i < prop_cnt; i++) {
+        lv_style_prop_t prop = (lv_style_prop_t)(((i * 7) % prop_cnt) + 1);
+        lv_style_value_t v = { .num = prop * 10 };
+        lv_style_set_prop(&style, prop, v);
+
+        /*All the properties set so far are found in every size*/
+        uint32_t j;
+        for(j = 0; j <= i; j++) {
+            lv_style_prop_t prop_j = (lv_style_prop_t)(((j * 7) % prop_cnt) + 1);
+            lv_style_value_t v_j;
+            TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, prop_j, &v_j));
+            TEST_ASSERT_EQUAL_INT32(prop_j * 10, v_j.num);
+        }
+    }
+    TEST_ASSERT_EQUAL(prop_cnt, style.prop_cnt);
+
+    lv_style_value_t v;
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&style, (lv_style_prop_t)(prop_cnt + 1), &v));
+
+    /*Overwrite a value without adding a new property*/
+    v.num = 1234;
+    lv_style_set_prop(&style, 6, v);
+    TEST_ASSERT_EQUAL(prop_cnt, style.prop_cnt);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, 6, &v));
+    TEST_ASSERT_EQUAL_INT32(1234, v.num);
+
+    /*Remove every 2nd property to go below the limit and check the rest*/
+    for(i = 1; i <= prop_cnt; i += 2) {
+        TEST_ASSERT_TRUE(lv_style_remove_prop(&style, (lv_style_prop_t)i));
+    }
+    TEST_ASSERT_FALSE(lv_style_remove_prop(&style, 1));
+    TEST_ASSERT_EQUAL(prop_cnt / 2, style.prop_cnt);
+
+    for(i = 1; i <= prop_cnt; i++) {
+        lv_style_res_t res = lv_style_get_prop(&style, (lv_style_prop_t)i, &v);
+        if(i % 2) {
+            TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, res);
+        }
+        else {
+            TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, res);
+            TEST_ASSERT_EQUAL_INT32(i == 6 ? 1234 : (int32_t)i * 10, v.num);
+        }
+    }
+
+    /*The copy of a large style is also searchable*/
+    lv_style_t style_copy;
+    lv_style_init(&style_copy);
+    lv_style_copy(&style_copy, &style);
+    for(i = 2; i <= prop_cnt; i += 2) {
+        TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style_copy, (lv_style_prop_t)i, &v));
+        TEST_ASSERT_EQUAL_INT32(i == 6 ? 1234 : (int32_t)i * 10, v.num);
+    }
+
+    lv_style_reset(&style);
+    lv_style_reset(&style_copy);
+}
+
 #endif
@@ -0,0 +1,182 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/*The property tables are generated from this file by `scripts/style_table_gen.py`*/
+static const lv_style_const_prop_t card_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x11, 0x22, 0x33)),
+    LV_STYLE_CONST_RADIUS(8),
+    LV_STYLE_CONST_PAD_TOP(5),
+    LV_STYLE_CONST_PROPS_END
+};
+
+/*Included by a macro, else the test runner would include it too*/
+#define STYLE_TABLES_H "test_style_table_style_tables.h"
+#include STYLE_TABLES_H
+
+static LV_STYLE_CONST_TABLE_INIT(style_card, card_props_table);
+
+/*Similar to the styles of the themes*/
+typedef struct {
+    struct {
+        lv_style_t btn;
+        lv_style_t empty;
+    } styles;
+} my_theme_t;
+
+static my_theme_t theme_data;
+static my_theme_t * theme = &theme_data;
+
+static void style_init_reset(lv_style_t * style, const lv_style_prop_table_t * prop_table)
+{
+    lv_style_init_table(style, prop_table);
+}
+
+static void style_init(bool shadow)
+{
+    style_init_reset(&theme->styles.btn, &btn_prop_table);
+    lv_style_set_bg_color(&theme->styles.btn, lv_color_hex(0x445566));
+    lv_style_set_pad_all(&theme->styles.btn, 10);
+    if(shadow) {
+        lv_style_set_shadow_width(&theme->styles.btn, 20);
+    }
+
+    style_init_reset(&theme->styles.empty, &empty_prop_table);
+}
+
+void setUp(void)
+{
+    style_init(false);
+}
+
+void tearDown(void)
+{
+    lv_style_reset(&theme->styles.btn);
+    lv_style_reset(&theme->styles.empty);
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_style_table_get_set(void)
+{
+    lv_style_t * style = &theme->styles.btn;
+    lv_style_value_t v;
+
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(style, LV_STYLE_BG_COLOR, &v));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x445566), v.color);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(style, LV_STYLE_PAD_BOTTOM, &v));
+    TEST_ASSERT_EQUAL_INT32(10, v.num);
+
+    /*In the table but not set*/
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(style, LV_STYLE_SHADOW_WIDTH, &v));
+    /*Not in the table*/
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(style, LV_STYLE_BORDER_WIDTH, &v));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(style, LV_STYLE_NUM_BUILT_IN_PROPS + 1, &v));
+
+    lv_style_set_shadow_width(style, 30);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(style, LV_STYLE_SHADOW_WIDTH, &v));
+    TEST_ASSERT_EQUAL_INT32(30, v.num);
+
+    TEST_ASSERT_TRUE(lv_style_remove_prop(style, LV_STYLE_SHADOW_WIDTH));
+    TEST_ASSERT_FALSE(lv_style_remove_prop(style, LV_STYLE_SHADOW_WIDTH));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(style, LV_STYLE_SHADOW_WIDTH, &v));
+
+    TEST_ASSERT_FALSE(lv_style_is_empty(style));
+    TEST_ASSERT_TRUE(lv_style_is_empty(&theme->styles.empty));
+    TEST_ASSERT_FALSE(lv_style_is_const(style));
+}
+
+void test_style_table_set_prop_not_in_table(void)
+{
+    lv_style_t * style = &theme->styles.btn;
+    lv_style_value_t v;
+
+    /*The style is converted to a normal style keeping its properties*/
+    lv_style_set_border_width(style, 3);
+    TEST_ASSERT_EQUAL_UINT32(6, style->prop_cnt);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(style, LV_STYLE_BORDER_WIDTH, &v));
+    TEST_ASSERT_EQUAL_INT32(3, v.num);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(style, LV_STYLE_BG_COLOR, &v));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x445566), v.color);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(style, LV_STYLE_PAD_RIGHT, &v));
+    TEST_ASSERT_EQUAL_INT32(10, v.num);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(style, LV_STYLE_SHADOW_WIDTH, &v));
+
+    /*The properties of the table can be still set*/
+    lv_style_set_shadow_width(style, 30);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(style, LV_STYLE_SHADOW_WIDTH, &v));
+    TEST_ASSERT_EQUAL_INT32(30, v.num);
+}
+
+void test_style_table_reinit(void)
+{
+    lv_style_reset(&theme->styles.btn);
+    lv_style_reset(&theme->styles.empty);
+    style_init(true);
+
+    lv_style_value_t v;
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&theme->styles.btn, LV_STYLE_SHADOW_WIDTH, &v));
+    TEST_ASSERT_EQUAL_INT32(20, v.num);
+}
+
+void test_style_table_copy(void)
+{
+    lv_style_t style;
+    lv_style_init(&style);
+    lv_style_copy(&style, &theme->styles.btn);
+
+    lv_style_value_t v;
+    TEST_ASSERT_FALSE(lv_style_is_const(&style));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_PAD_LEFT, &v));
+    TEST_ASSERT_EQUAL_INT32(10, v.num);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&style, LV_STYLE_SHADOW_WIDTH, &v));
+
+    lv_style_copy(&style, &style_card);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_RADIUS, &v));
+    TEST_ASSERT_EQUAL_INT32(8, v.num);
+
+    lv_style_reset(&style);
+}
+
+void test_style_table_const(void)
+{
+    lv_style_value_t v;
+
+    TEST_ASSERT_TRUE(lv_style_is_const(&style_card));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style_card, LV_STYLE_BG_COLOR, &v));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x112233), v.color);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style_card, LV_STYLE_PAD_TOP, &v));
+    TEST_ASSERT_EQUAL_INT32(5, v.num);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&style_card, LV_STYLE_PAD_BOTTOM, &v));
+
+    /*Constant styles can't be changed*/
+    lv_style_set_radius((lv_style_t *)&style_card, 20);
+    TEST_ASSERT_FALSE(lv_style_remove_prop((lv_style_t *)&style_card, LV_STYLE_RADIUS));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style_card, LV_STYLE_RADIUS, &v));
+    TEST_ASSERT_EQUAL_INT32(8, v.num);
+}
+
+void test_style_table_on_widget(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    lv_obj_add_style(obj, &style_card, 0);
+    lv_obj_add_style(obj, &theme->styles.btn, LV_STATE_PRESSED);
+
+    TEST_ASSERT_EQUAL_INT32(8, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL_INT32(5, lv_obj_get_style_pad_top(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x112233), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_INT32(10, lv_obj_get_style_pad_top(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x445566), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL_INT32(8, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    /*Changing a style with a property table is reported like with any other style*/
+    lv_style_set_pad_all(&theme->styles.btn, 2);
+    lv_obj_report_style_change(&theme->styles.btn);
+    TEST_ASSERT_EQUAL_INT32(2, lv_obj_get_style_pad_top(obj, LV_PART_MAIN));
+}
+
+#endif
@@ -0,0 +1,53 @@
+/*
+ **********************************************************************
+ *                            DO NOT EDIT
+ * This file is automatically generated by "style_table_gen.py"
+ * from "test_style_table.c"
+ **********************************************************************
+ */
+
+#ifndef TEST_STYLE_TABLE_STYLE_TABLES_H
+#define TEST_STYLE_TABLE_STYLE_TABLES_H
+
+static const lv_style_prop_t btn_props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP,
+    LV_STYLE_PAD_BOTTOM, LV_STYLE_SHADOW_WIDTH,
+};
+
+static const lv_style_prop_table_t btn_prop_table = {
+    .props = btn_props,
+    .const_props = NULL,
+    .prop_cnt = 6,
+    .prop_index = {
+        [LV_STYLE_BG_COLOR] = 1,
+        [LV_STYLE_PAD_LEFT] = 2,
+        [LV_STYLE_PAD_RIGHT] = 3,
+        [LV_STYLE_PAD_TOP] = 4,
+        [LV_STYLE_PAD_BOTTOM] = 5,
+        [LV_STYLE_SHADOW_WIDTH] = 6,
+    },
+};
+
+static const lv_style_prop_table_t empty_prop_table = {
+    .props = NULL,
+    .const_props = NULL,
+    .prop_cnt = 0,
+    .prop_index = {0},
+};
+
+static const lv_style_prop_t card_props_props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_RADIUS, LV_STYLE_PAD_TOP,
+};
+
+static const lv_style_prop_table_t card_props_table = {
+    .props = card_props_props,
+    .const_props = card_props,
+    .prop_cnt = 3,
+    .prop_index = {
+        [LV_STYLE_BG_COLOR] = 1,
+        [LV_STYLE_RADIUS] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+    },
+};
+
+#endif /*TEST_STYLE_TABLE_STYLE_TABLES_H*/
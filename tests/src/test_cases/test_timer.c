@@ -0,0 +1,276 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define TIMER_MAX   300
+
+static lv_timer_t * timers[TIMER_MAX];
+static uint32_t run_cnt[TIMER_MAX];
+static uint32_t run_order[TIMER_MAX];
+static uint32_t run_order_cnt;
+
+static void count_cb(lv_timer_t * timer)
+{
+    uint32_t i = (uint32_t)(lv_uintptr_t)lv_timer_get_user_data(timer);
+    run_cnt[i]++;
+    if(run_order_cnt < TIMER_MAX) {
+        run_order[run_order_cnt] = i;
+        run_order_cnt++;
+    }
+}
+
+static lv_timer_t * create_timer(uint32_t i, lv_timer_cb_t cb, uint32_t period)
+{
+    timers[i] = lv_timer_create(cb, period, (void *)(lv_uintptr_t)i);
+    return timers[i];
+}
+
+static void wait(uint32_t ms)
+{
+    while(ms) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+        ms--;
+    }
+}
+
+static bool timer_exists(lv_timer_t * timer)
+{
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        if(t == timer) return true;
+        t = lv_timer_get_next(t);
+    }
+    return false;
+}
+
+void setUp(void)
+{
+    lv_memzero(timers, sizeof(timers));
+    lv_memzero(run_cnt, sizeof(run_cnt));
+    run_order_cnt = 0;
+}
+
+void tearDown(void)
+{
+    uint32_t i;
+    for(i = 0; i < TIMER_MAX; i++) {
+        if(timers[i] && timer_exists(timers[i])) lv_timer_delete(timers[i]);
+    }
+}
+
+void test_timer_runs_periodically(void)
+{
+    create_timer(0, count_cb, 10);
+    create_timer(1, count_cb, 35);
+
+    wait(100);
+    TEST_ASSERT_EQUAL_UINT32(10, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[1]);
+
+    lv_timer_set_period(timers[1], 5);
+    wait(100);
+    TEST_ASSERT_EQUAL_UINT32(20, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(22, run_cnt[1]);
+}
+
+void test_timer_ready_timers_run_last_created_first(void)
+{
+    create_timer(0, count_cb, 10);
+    wait(5);
+    create_timer(1, count_cb, 20);
+    create_timer(2, count_cb, 10);
+
+    /*All are ready. The first one would have been ready the earliest.*/
+    lv_tick_inc(100);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, run_order_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, run_order[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_order[1]);
+    TEST_ASSERT_EQUAL_UINT32(0, run_order[2]);
+}
+
+void test_timer_ready_and_reset(void)
+{
+    create_timer(0, count_cb, 100);
+    create_timer(1, count_cb, 100);
+
+    wait(50);
+    lv_timer_ready(timers[0]);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_get_time_until_next());
+    wait(1);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[1]);
+
+    lv_timer_reset(timers[1]);
+    wait(60);
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[1]);
+    wait(40);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[1]);
+}
+
+void test_timer_repeat_count(void)
+{
+    create_timer(0, count_cb, 10);
+    create_timer(1, count_cb, 10);
+    lv_timer_set_repeat_count(timers[0], 3);
+    lv_timer_set_repeat_count(timers[1], 2);
+    lv_timer_set_auto_delete(timers[1], false);
+
+    wait(100);
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[1]);
+    TEST_ASSERT_FALSE(timer_exists(timers[0]));
+    TEST_ASSERT_TRUE(timer_exists(timers[1]));
+    timers[0] = NULL;
+    TEST_ASSERT_TRUE(lv_timer_get_paused(timers[1]));
+
+    /*Reuse it*/
+    lv_timer_set_repeat_count(timers[1], 1);
+    lv_timer_resume(timers[1]);
+    wait(100);
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt[1]);
+
+    /*No repeats left: deleted without waiting for the period*/
+    create_timer(2, count_cb, 1000);
+    lv_timer_set_repeat_count(timers[2], 0);
+    wait(1);
+    TEST_ASSERT_FALSE(timer_exists(timers[2]));
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[2]);
+    timers[2] = NULL;
+}
+
+void test_timer_pause_and_resume(void)
+{
+    create_timer(0, count_cb, 10);
+    create_timer(1, count_cb, 30);
+
+    lv_timer_pause(timers[0]);
+    wait(100);
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt[1]);
+
+    /*The period has elapsed while paused*/
+    lv_timer_resume(timers[0]);
+    wait(1);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+
+    /*Paused and resumed before it was due*/
+    lv_timer_pause(timers[0]);
+    wait(5);
+    lv_timer_resume(timers[0]);
+    wait(5);
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[0]);
+}
+
+void test_timer_time_until_next(void)
+{
+    /*Make only the test's timers count*/
+    lv_timer_t * paused[32];
+    uint32_t paused_cnt = 0;
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        if(!lv_timer_get_paused(t)) {
+            TEST_ASSERT_LESS_THAN_UINT32(32, paused_cnt);
+            lv_timer_pause(t);
+            paused[paused_cnt] = t;
+            paused_cnt++;
+        }
+        t = lv_timer_get_next(t);
+    }
+
+    create_timer(0, count_cb, 30);
+    create_timer(1, count_cb, 50);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(30, lv_timer_get_time_until_next());
+
+    wait(10);
+    TEST_ASSERT_EQUAL_UINT32(20, lv_timer_get_time_until_next());
+
+    wait(20);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(20, lv_timer_get_time_until_next());
+
+    lv_timer_pause(timers[0]);
+    lv_timer_pause(timers[1]);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_get_time_until_next());
+
+    uint32_t i;
+    for(i = 0; i < paused_cnt; i++) {
+        lv_timer_resume(paused[i]);
+    }
+}
+
+static void delete_cb(lv_timer_t * timer)
+{
+    count_cb(timer);
+    lv_timer_delete(timers[1]);
+    lv_timer_delete(timer);
+    timers[1] = NULL;
+    timers[2] = NULL;
+}
+
+static void create_cb(lv_timer_t * timer)
+{
+    count_cb(timer);
+    lv_timer_t * new_timer = create_timer(3, count_cb, 0);
+    lv_timer_set_repeat_count(new_timer, 1);
+}
+
+void test_timer_delete_and_create_in_callback(void)
+{
+    create_timer(0, count_cb, 10);
+    create_timer(1, count_cb, 10);
+    create_timer(2, delete_cb, 10);
+
+    /*The last created runs first and deletes the other ready timer and itself*/
+    wait(10);
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[2]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+    TEST_ASSERT_NULL(timers[1]);
+    TEST_ASSERT_NULL(timers[2]);
+
+    /*The new timer runs in the same call*/
+    create_timer(2, create_cb, 10);
+    wait(10);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[3]);
+    TEST_ASSERT_FALSE(timer_exists(timers[3]));
+    timers[3] = NULL;
+}
+
+void test_timer_many_timers(void)
+{
+    uint32_t seed = 1;
+    uint32_t i;
+    for(i = 0; i < TIMER_MAX; i++) {
+        seed = seed * 1103515245 + 12345;
+        create_timer(i, count_cb, 1 + (seed >> 16) % 200);
+    }
+
+    /*Change some of them on the way*/
+    wait(500);
+    for(i = 0; i < TIMER_MAX; i += 3) {
+        lv_timer_reset(timers[i]);
+        lv_timer_set_period(timers[i], 13);
+        run_cnt[i] = 0;
+    }
+    for(i = 1; i < TIMER_MAX; i += 3) {
+        lv_timer_delete(timers[i]);
+        timers[i] = NULL;
+    }
+
+    wait(1000);
+    for(i = 0; i < TIMER_MAX; i++) {
+        if(timers[i] == NULL) continue;
+
+        uint32_t expected = 1000 / timers[i]->period;
+        if(i % 3 != 0) expected = 1500 / timers[i]->period;
+        TEST_ASSERT_EQUAL_UINT32(expected, run_cnt[i]);
+    }
+}
+
+#endif
@@ -155,6 +155,8 @@ void test_obj_property_flag(void)
         { LV_OBJ_FLAG_WIDGET_2,                  LV_PROPERTY_OBJ_FLAG_WIDGET_2 },
         { LV_OBJ_FLAG_USER_1,                    LV_PROPERTY_OBJ_FLAG_USER_1 },
         { LV_OBJ_FLAG_USER_2,                    LV_PROPERTY_OBJ_FLAG_USER_2 },
+        { LV_OBJ_FLAG_DISPLAY_LIST,              LV_PROPERTY_OBJ_FLAG_DISPLAY_LIST },
+        { LV_OBJ_FLAG_CACHE_BITMAP,              LV_PROPERTY_OBJ_FLAG_CACHE_BITMAP },
     };
 
     lv_obj_t * obj = lv_obj_create(lv_screen_active());
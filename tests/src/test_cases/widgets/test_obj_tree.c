@@ -319,5 +319,274 @@ void test_obj_get_by_name(void)
     TEST_ASSERT_EQUAL(label5, found_obj);
 }
 
+/** Children array **/
+
+void test_obj_children_capacity(void)
+{
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_obj_t * children[100];
+
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        children[i] = lv_obj_create(parent);
+    }
+
+    TEST_ASSERT_EQUAL(100, lv_obj_get_child_count(parent));
+    TEST_ASSERT_GREATER_OR_EQUAL(100, parent->spec_attr->child_cap);
+    TEST_ASSERT_LESS_THAN(200, parent->spec_attr->child_cap);
+
+    /*Remove from the middle and keep the order*/
+    lv_obj_delete(children[50]);
+    lv_obj_set_parent(children[10], lv_screen_active());
+    TEST_ASSERT_EQUAL(98, lv_obj_get_child_count(parent));
+    TEST_ASSERT_EQUAL_PTR(children[9], lv_obj_get_child(parent, 9));
+    TEST_ASSERT_EQUAL_PTR(children[11], lv_obj_get_child(parent, 10));
+    TEST_ASSERT_EQUAL_PTR(children[51], lv_obj_get_child(parent, 49));
+    TEST_ASSERT_EQUAL_PTR(children[99], lv_obj_get_child(parent, -1));
+
+    /*Shrinks only when mostly unused*/
+    uint32_t cap = parent->spec_attr->child_cap;
+    for(i = 0; i < 40; i++) {
+        lv_obj_delete(lv_obj_get_child(parent, -1));
+    }
+    TEST_ASSERT_EQUAL(cap, parent->spec_attr->child_cap);
+
+    while(lv_obj_get_child_count(parent) > 10) {
+        lv_obj_delete(lv_obj_get_child(parent, 0));
+    }
+    TEST_ASSERT_LESS_THAN(cap, parent->spec_attr->child_cap);
+    TEST_ASSERT_GREATER_OR_EQUAL(10, parent->spec_attr->child_cap);
+
+    lv_obj_clean(parent);
+    TEST_ASSERT_EQUAL(0, parent->spec_attr->child_cap);
+    TEST_ASSERT_NULL(parent->spec_attr->children);
+}
+
+void test_obj_reserve_children(void)
+{
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_obj_reserve_children(parent, 50);
+    TEST_ASSERT_EQUAL(50, parent->spec_attr->child_cap);
+
+    lv_obj_t * first = lv_obj_create(parent);
+    lv_obj_t ** children = parent->spec_attr->children;
+
+    uint32_t i;
+    for(i = 1; i < 50; i++) {
+        lv_obj_create(parent);
+    }
+
+    /*No reallocation was needed*/
+    TEST_ASSERT_EQUAL_PTR(children, parent->spec_attr->children);
+    TEST_ASSERT_EQUAL_PTR(first, lv_obj_get_child(parent, 0));
+
+    /*Doesn't shrink*/
+    lv_obj_reserve_children(parent, 10);
+    TEST_ASSERT_EQUAL(50, parent->spec_attr->child_cap);
+}
+
+static uint32_t child_created_cnt;
+static uint32_t child_deleted_cnt;
+
+static void child_event_cb(lv_event_t * e)
+{
+    if(lv_event_get_code(e) == LV_EVENT_CHILD_CREATED) child_created_cnt++;
+    else if(lv_event_get_code(e) == LV_EVENT_CHILD_DELETED) child_deleted_cnt++;
+}
+
+void test_obj_move_children(void)
+{
+    lv_obj_t * parent1 = lv_obj_create(lv_screen_active());
+    lv_obj_t * parent2 = lv_obj_create(lv_screen_active());
+    lv_obj_t * old_child = lv_obj_create(parent2);
+
+    lv_obj_t * children[20];
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        children[i] = lv_obj_create(parent1);
+    }
+
+    lv_obj_add_event_cb(parent1, child_event_cb, LV_EVENT_ALL, NULL);
+    lv_obj_add_event_cb(parent2, child_event_cb, LV_EVENT_ALL, NULL);
+    child_created_cnt = 0;
+    child_deleted_cnt = 0;
+
+    lv_obj_move_children(parent1, parent2);
+
+    TEST_ASSERT_EQUAL(0, lv_obj_get_child_count(parent1));
+    TEST_ASSERT_EQUAL(21, lv_obj_get_child_count(parent2));
+    TEST_ASSERT_EQUAL_PTR(old_child, lv_obj_get_child(parent2, 0));
+    for(i = 0; i < 20; i++) {
+        TEST_ASSERT_EQUAL_PTR(children[i], lv_obj_get_child(parent2, i + 1));
+        TEST_ASSERT_EQUAL_PTR(parent2, lv_obj_get_parent(children[i]));
+    }
+
+    /*Notified once*/
+    TEST_ASSERT_EQUAL(1, child_created_cnt);
+    TEST_ASSERT_EQUAL(1, child_deleted_cnt);
+
+    /*Can't move to a descendant*/
+    lv_obj_move_children(parent2, children[0]);
+    TEST_ASSERT_EQUAL(21, lv_obj_get_child_count(parent2));
+    lv_obj_move_children(parent2, parent2);
+    TEST_ASSERT_EQUAL(21, lv_obj_get_child_count(parent2));
+
+    /*Nothing to move*/
+    lv_obj_move_children(parent1, parent2);
+    TEST_ASSERT_EQUAL(21, lv_obj_get_child_count(parent2));
+}
+
+/** Deleting the children in bulk **/
+
+static lv_obj_t * delete_parent;
+static int32_t delete_child_cnt[4];
+static uint32_t delete_cb_cnt;
+
+static void delete_cb(lv_event_t * e)
+{
+    if(lv_event_get_code(e) != LV_EVENT_DELETE) return;
+
+    LV_ASSERT(delete_cb_cnt < 4);
+    delete_child_cnt[delete_cb_cnt] = (int32_t)lv_obj_get_child_count(delete_parent);
+    delete_cb_cnt++;
+}
+
+static void anim_exec_cb(void * var, int32_t v)
+{
+    LV_UNUSED(var);
+    LV_UNUSED(v);
+}
+
+static void start_anim(lv_obj_t * obj)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, obj);
+    lv_anim_set_exec_cb(&a, anim_exec_cb);
+    lv_anim_set_duration(&a, 1000);
+    lv_anim_start(&a);
+}
+
+void test_obj_clean_delete_cb_sees_the_remaining_children(void)
+{
+    delete_parent = lv_obj_create(lv_screen_active());
+    delete_cb_cnt = 0;
+
+    lv_obj_t * children[10];
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        children[i] = lv_obj_create(delete_parent);
+        lv_obj_create(children[i]);
+    }
+
+    /*As if the children were deleted one by one from the first*/
+    lv_obj_add_event_cb(children[3], delete_cb, LV_EVENT_DELETE, NULL);
+    lv_obj_add_event_cb(lv_obj_get_child(children[5], 0), delete_cb, LV_EVENT_DELETE, NULL);
+    lv_obj_add_event_cb(children[7], delete_cb, LV_EVENT_ALL, NULL);
+
+    lv_obj_clean(delete_parent);
+
+    TEST_ASSERT_EQUAL(3, delete_cb_cnt);
+    TEST_ASSERT_EQUAL(7, delete_child_cnt[0]);
+    TEST_ASSERT_EQUAL(5, delete_child_cnt[1]);
+    TEST_ASSERT_EQUAL(3, delete_child_cnt[2]);
+    TEST_ASSERT_EQUAL(0, lv_obj_get_child_count(delete_parent));
+}
+
+void test_obj_clean_removes_anims_and_async_deletes(void)
+{
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_obj_allocate_spec_attr(parent);
+    lv_obj_t * other = lv_obj_create(lv_screen_active());
+    start_anim(other);
+    lv_obj_delete_async(other);
+
+    /*The timer heaps grow for the async deletes but shrink only when at most a quarter of them is used,
+     *so measure the memory when they are already at the size they have after the async deletes*/
+    lv_timer_t * timers[10];
+    uint32_t i;
+    for(i = 0; i < 10; i++) timers[i] = lv_timer_create_basic();
+    for(i = 0; i < 10; i++) lv_timer_delete(timers[i]);
+
+    size_t mem = lv_test_get_free_mem();
+    uint16_t anim_cnt = lv_anim_count_running();
+
+    for(i = 0; i < 100; i++) {
+        lv_obj_t * child = lv_obj_create(parent);
+        lv_obj_t * grandchild = lv_label_create(child);
+        start_anim(child);
+        start_anim(grandchild);
+        if(i % 10 == 0) lv_obj_delete_async(grandchild);
+    }
+
+    lv_obj_clean(parent);
+
+    TEST_ASSERT_EQUAL(anim_cnt, lv_anim_count_running());
+    TEST_ASSERT_NOT_NULL(lv_anim_get(other, NULL));
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem, 32);
+
+    /*Only the async delete of `other` is left*/
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(1, lv_obj_get_child_count(lv_screen_active()));
+    TEST_ASSERT_EQUAL(anim_cnt - 1, lv_anim_count_running());
+}
+
+static void clean_parent_cb(lv_event_t * e)
+{
+    lv_obj_clean(lv_obj_get_parent(lv_event_get_target_obj(e)));
+}
+
+void test_obj_clean_from_delete_cb(void)
+{
+    size_t mem = lv_test_get_free_mem();
+
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_label_create(parent);
+    lv_obj_t * child = lv_obj_create(parent);
+    lv_label_create(parent);
+    lv_obj_add_event_cb(child, clean_parent_cb, LV_EVENT_DELETE, NULL);
+
+    /*The siblings are deleted in bulk around the child being deleted*/
+    lv_obj_delete(child);
+    TEST_ASSERT_EQUAL(0, lv_obj_get_child_count(parent));
+
+    lv_obj_delete(parent);
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem, 32);
+}
+
+void test_obj_delete_screen_with_many_children(void)
+{
+    lv_obj_t * scr = lv_obj_create(NULL);
+    lv_obj_t * cont = lv_obj_create(scr);
+    lv_group_t * g = lv_group_create();
+
+    uint32_t i;
+    for(i = 0; i < 1000; i++) {
+        lv_obj_t * btn = lv_button_create(i % 2 ? scr : cont);
+        lv_label_create(btn);
+        if(i % 100 == 0) lv_group_add_obj(g, btn);
+    }
+
+    lv_obj_delete(scr);
+    TEST_ASSERT_EQUAL(0, lv_group_get_obj_count(g));
+    lv_group_delete(g);
+}
+
+void test_obj_clean_deletes_siblings_from_destructors(void)
+{
+    size_t mem = lv_test_get_free_mem();
+
+    /*The dropdowns delete their lists, which are their siblings, in their destructors*/
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_t * dd = lv_dropdown_create(lv_screen_active());
+        lv_dropdown_open(dd);
+    }
+    TEST_ASSERT_EQUAL(20, lv_obj_get_child_count(lv_screen_active()));
+
+    lv_obj_clean(lv_screen_active());
+    TEST_ASSERT_EQUAL(0, lv_obj_get_child_count(lv_screen_active()));
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem, 32);
+}
 
 #endif
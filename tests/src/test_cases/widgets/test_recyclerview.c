@@ -0,0 +1,243 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * rv;
+static uint32_t row_cnt;
+static uint32_t bind_cnt;
+
+static uint32_t get_count_cb(lv_obj_t * obj)
+{
+    LV_UNUSED(obj);
+    return row_cnt;
+}
+
+static void bind_row_cb(lv_obj_t * obj, lv_obj_t * row, uint32_t index)
+{
+    LV_UNUSED(obj);
+    lv_label_set_text_fmt(row, "%" LV_PRIu32, index);
+    bind_cnt++;
+}
+
+static void create_rv(uint32_t cnt)
+{
+    row_cnt = cnt;
+    rv = lv_recyclerview_create(lv_screen_active());
+    lv_obj_set_size(rv, 200, 300);
+    lv_obj_set_style_pad_all(rv, 0, 0);
+    lv_obj_set_style_pad_row(rv, 0, 0);
+    lv_obj_set_style_border_width(rv, 0, 0);
+    lv_recyclerview_set_row_height(rv, 30);
+    lv_recyclerview_set_bind_row_cb(rv, bind_row_cb);
+    lv_recyclerview_set_get_count_cb(rv, get_count_cb);
+    lv_obj_update_layout(rv);
+}
+
+static void assert_row(uint32_t index)
+{
+    lv_obj_t * row = lv_recyclerview_get_row(rv, index);
+    TEST_ASSERT_NOT_NULL(row);
+    TEST_ASSERT_EQUAL(index, lv_recyclerview_get_row_index(rv, row));
+
+    char buf[16];
+    lv_snprintf(buf, sizeof(buf), "%" LV_PRIu32, index);
+    TEST_ASSERT_EQUAL_STRING(buf, lv_label_get_text(row));
+
+    /*It's at its place in the scrolled content*/
+    TEST_ASSERT_EQUAL(rv->coords.y1 + (int32_t)index * 30 - lv_obj_get_scroll_y(rv), row->coords.y1);
+}
+
+void setUp(void)
+{
+    bind_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_recyclerview_creates_only_the_visible_rows(void)
+{
+    create_rv(100000);
+
+    /*10 visible rows, 1 for the partially visible ones and 2 x 2 overscan*/
+    TEST_ASSERT_EQUAL(100000, lv_recyclerview_get_row_count(rv));
+    TEST_ASSERT_EQUAL(16, lv_recyclerview_get_row_obj_count(rv));
+    TEST_ASSERT_EQUAL(16, lv_obj_get_child_count(rv));
+
+    uint32_t i;
+    for(i = 0; i < 16; i++) {
+        assert_row(i);
+    }
+    TEST_ASSERT_NULL(lv_recyclerview_get_row(rv, 16));
+
+    /*The content has the height of all rows*/
+    TEST_ASSERT_EQUAL(100000 * 30 - 300, lv_obj_get_scroll_bottom(rv));
+}
+
+void test_recyclerview_uses_the_same_memory_for_any_row_count(void)
+{
+    create_rv(100);
+    lv_obj_delete(rv);
+
+    size_t mem = lv_test_get_free_mem();
+    create_rv(100);
+    size_t mem_100 = lv_test_get_free_mem();
+    lv_obj_delete(rv);
+
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem, 32);
+
+    create_rv(100000);
+    size_t mem_100k = lv_test_get_free_mem();
+    lv_obj_delete(rv);
+
+    TEST_ASSERT_EQUAL(mem_100, mem_100k);
+}
+
+void test_recyclerview_rebinds_only_the_scrolled_in_rows(void)
+{
+    create_rv(100000);
+    bind_cnt = 0;
+
+    /*Scroll by 3 rows*/
+    lv_obj_scroll_to_y(rv, 90, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL(1, bind_cnt);
+
+    /*The overscan rows are reused first*/
+    lv_obj_scroll_to_y(rv, 300, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL(8, bind_cnt);
+
+    uint32_t i;
+    for(i = 8; i < 24; i++) {
+        assert_row(i);
+    }
+    TEST_ASSERT_NULL(lv_recyclerview_get_row(rv, 7));
+    TEST_ASSERT_NULL(lv_recyclerview_get_row(rv, 24));
+}
+
+void test_recyclerview_scroll_to_row(void)
+{
+    create_rv(100000);
+
+    lv_recyclerview_scroll_to_row(rv, 50000, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL(50000 * 30, lv_obj_get_scroll_y(rv));
+    assert_row(50000);
+    assert_row(50009);
+
+    /*The last rows can't be scrolled to the top*/
+    lv_recyclerview_scroll_to_row(rv, 100000, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL(100000 * 30 - 300, lv_obj_get_scroll_y(rv));
+    TEST_ASSERT_EQUAL(0, lv_obj_get_scroll_bottom(rv));
+    assert_row(99999);
+    assert_row(99984);
+    TEST_ASSERT_NULL(lv_recyclerview_get_row(rv, 99983));
+}
+
+void test_recyclerview_refresh(void)
+{
+    create_rv(100000);
+    lv_recyclerview_scroll_to_row(rv, 99990, LV_ANIM_OFF);
+
+    /*Less rows than the row objects and the rows got out of the view*/
+    row_cnt = 5;
+    lv_recyclerview_refresh(rv);
+    TEST_ASSERT_EQUAL(5, lv_recyclerview_get_row_obj_count(rv));
+    TEST_ASSERT_EQUAL(0, lv_obj_get_scroll_y(rv));
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        assert_row(i);
+    }
+
+    row_cnt = 0;
+    lv_recyclerview_refresh(rv);
+    TEST_ASSERT_EQUAL(0, lv_recyclerview_get_row_obj_count(rv));
+    TEST_ASSERT_EQUAL(0, lv_obj_get_child_count(rv));
+
+    row_cnt = 1000;
+    lv_recyclerview_refresh(rv);
+    TEST_ASSERT_EQUAL(16, lv_recyclerview_get_row_obj_count(rv));
+    assert_row(0);
+}
+
+void test_recyclerview_size_and_row_height(void)
+{
+    create_rv(100000);
+
+    lv_obj_set_height(rv, 600);
+    lv_obj_update_layout(rv);
+    TEST_ASSERT_EQUAL(26, lv_recyclerview_get_row_obj_count(rv));
+
+    lv_recyclerview_set_row_height(rv, 60);
+    lv_obj_update_layout(rv);
+    TEST_ASSERT_EQUAL(60, lv_recyclerview_get_row_height(rv));
+    TEST_ASSERT_EQUAL(16, lv_recyclerview_get_row_obj_count(rv));
+    TEST_ASSERT_EQUAL(60, lv_obj_get_height(lv_recyclerview_get_row(rv, 0)));
+    TEST_ASSERT_EQUAL(100000 * 60 - 600, lv_obj_get_scroll_bottom(rv));
+
+    lv_recyclerview_set_overscan(rv, 0);
+    TEST_ASSERT_EQUAL(0, lv_recyclerview_get_overscan(rv));
+    TEST_ASSERT_EQUAL(12, lv_recyclerview_get_row_obj_count(rv));
+}
+
+void test_recyclerview_row_gap(void)
+{
+    create_rv(100);
+
+    lv_obj_set_style_pad_row(rv, 10, 0);
+    TEST_ASSERT_EQUAL(100 * 40 - 10 - 300, lv_obj_get_scroll_bottom(rv));
+
+    lv_recyclerview_scroll_to_row(rv, 50, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL(50 * 40, lv_obj_get_scroll_y(rv));
+    TEST_ASSERT_EQUAL(rv->coords.y1, lv_recyclerview_get_row(rv, 50)->coords.y1);
+}
+
+void test_recyclerview_negative_row_gap(void)
+{
+    create_rv(100);
+
+    /*The rows can't overlap, so a negative gap is the same as 0*/
+    lv_obj_set_style_pad_row(rv, -30, 0);
+    TEST_ASSERT_EQUAL(100 * 30 - 300, lv_obj_get_scroll_bottom(rv));
+    TEST_ASSERT_EQUAL(16, lv_recyclerview_get_row_obj_count(rv));
+
+    lv_obj_set_style_pad_row(rv, -10, 0);
+    TEST_ASSERT_EQUAL(100 * 30 - 300, lv_obj_get_scroll_bottom(rv));
+
+    lv_recyclerview_scroll_to_row(rv, 50, LV_ANIM_OFF);
+    assert_row(50);
+    TEST_ASSERT_EQUAL(rv->coords.y1, lv_recyclerview_get_row(rv, 50)->coords.y1);
+}
+
+static lv_obj_t * create_row_cb(lv_obj_t * obj)
+{
+    lv_obj_t * btn = lv_button_create(obj);
+    lv_label_create(btn);
+    return btn;
+}
+
+static void bind_button_cb(lv_obj_t * obj, lv_obj_t * row, uint32_t index)
+{
+    LV_UNUSED(obj);
+    lv_label_set_text_fmt(lv_obj_get_child(row, 0), "%" LV_PRIu32, index);
+}
+
+void test_recyclerview_custom_rows(void)
+{
+    row_cnt = 1000;
+    rv = lv_recyclerview_create(lv_screen_active());
+    lv_obj_set_size(rv, 200, 300);
+    lv_recyclerview_set_create_row_cb(rv, create_row_cb);
+    lv_recyclerview_set_bind_row_cb(rv, bind_button_cb);
+    lv_recyclerview_set_get_count_cb(rv, get_count_cb);
+    TEST_ASSERT_EQUAL(lv_recyclerview_get_row_obj_count(rv), lv_obj_get_child_count(rv));
+
+    lv_obj_t * row = lv_recyclerview_get_row(rv, 3);
+    TEST_ASSERT_TRUE(lv_obj_check_type(row, &lv_button_class));
+    TEST_ASSERT_EQUAL_STRING("3", lv_label_get_text(lv_obj_get_child(row, 0)));
+}
+
+#endif
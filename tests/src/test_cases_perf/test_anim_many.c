@@ -0,0 +1,99 @@
+/* Performance test for running many animations of small widgets at the same time */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define ROUND_CNT       100
+
+static lv_obj_t * scr;
+
+static void opa_exec_cb(void * var, int32_t v)
+{
+    lv_obj_set_style_opa(var, v, 0);
+}
+
+static void color_exec_cb(void * var, int32_t v)
+{
+    lv_obj_set_style_bg_color(var, lv_color_make(v, 0, 255 - v), 0);
+}
+
+static void create_anims(uint32_t cnt)
+{
+    /*Small widgets next to each other, blinking and changing colors like LEDs on a dashboard*/
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_t * obj = lv_obj_create(scr);
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+        lv_obj_set_pos(obj, (int32_t)(i % 100) * 8, (int32_t)(i / 100) * 8 % 480);
+        lv_obj_set_size(obj, 8, 8);
+
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, obj);
+        lv_anim_set_values(&a, 0, 255);
+        lv_anim_set_duration(&a, 1000 + i % 500);
+        lv_anim_set_reverse_duration(&a, 1000);
+        lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+        if(i % 2) {
+            lv_anim_set_exec_cb(&a, opa_exec_cb);
+            lv_anim_set_path_cb(&a, lv_anim_path_ease_in_out);
+        }
+        else {
+            lv_anim_set_exec_cb(&a, color_exec_cb);
+        }
+        lv_anim_start(&a);
+    }
+
+    lv_refr_now(NULL);
+}
+
+static void run_anims(uint32_t cnt)
+{
+    /*Run only the animations. The invalidated areas are dropped instead of being redrawn.*/
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_tick_inc(LV_DEF_REFR_PERIOD);
+        lv_anim_refr_now();
+        lv_inv_area(lv_display_get_default(), NULL);
+    }
+}
+
+void setUp(void)
+{
+    scr = lv_obj_create(NULL);
+    lv_screen_load(scr);
+}
+
+void tearDown(void)
+{
+    lv_anim_delete_all();
+    lv_screen_load(lv_obj_create(NULL));
+    lv_obj_delete(scr);
+}
+
+void test_anim_many_10(void)
+{
+    create_anims(10);
+    TEST_ASSERT_MAX_TIME(run_anims, 5, ROUND_CNT);
+}
+
+void test_anim_many_100(void)
+{
+    create_anims(100);
+    TEST_ASSERT_MAX_TIME(run_anims, 15, ROUND_CNT);
+}
+
+void test_anim_many_1000(void)
+{
+    create_anims(1000);
+    TEST_ASSERT_MAX_TIME(run_anims, 100, ROUND_CNT);
+}
+
+void test_anim_many_5000(void)
+{
+    create_anims(5000);
+    TEST_ASSERT_MAX_TIME(run_anims, 600, ROUND_CNT);
+}
+
+#endif
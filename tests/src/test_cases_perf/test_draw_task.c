@@ -0,0 +1,75 @@
+/* Performance test for creating, dispatching and freeing many draw tasks */
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+#define WIDGET_CNT      5000
+#define REFR_CNT        10
+
+static uint32_t task_cnt;
+
+static void draw_task_added_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    task_cnt++;
+}
+
+static void refr_screen(void)
+{
+    uint32_t i;
+    for(i = 0; i < REFR_CNT; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+}
+
+void setUp(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_pad_all(scr, 0, 0);
+    lv_obj_set_scrollbar_mode(scr, LV_SCROLLBAR_MODE_OFF);
+
+    /*Small, overlapping widgets with background and border to have many draw tasks*/
+    uint32_t i;
+    for(i = 0; i < WIDGET_CNT; i++) {
+        lv_obj_t * obj = lv_obj_create(scr);
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_style_bg_opa(obj, LV_OPA_50, 0);
+        lv_obj_set_style_bg_color(obj, lv_palette_main(i % LV_PALETTE_LAST), 0);
+        lv_obj_set_style_border_width(obj, 1, 0);
+        lv_obj_set_size(obj, 16, 16);
+        lv_obj_set_pos(obj, (i * 7) % 784, (i * 13) % 464);
+    }
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_draw_task_throughput(void)
+{
+    /*Count the draw tasks of one refresh*/
+    lv_obj_t * scr = lv_screen_active();
+    uint32_t i;
+    for(i = 0; i < WIDGET_CNT; i++) {
+        lv_obj_t * obj = lv_obj_get_child(scr, i);
+        lv_obj_add_event_cb(obj, draw_task_added_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    }
+
+    task_cnt = 0;
+    lv_obj_invalidate(scr);
+    lv_refr_now(NULL);
+    uint32_t task_per_refr = task_cnt;
+    TEST_ASSERT_GREATER_OR_EQUAL(WIDGET_CNT, task_per_refr);
+
+    for(i = 0; i < WIDGET_CNT; i++) {
+        lv_obj_t * obj = lv_obj_get_child(scr, i);
+        lv_obj_remove_event_cb(obj, draw_task_added_cb);
+        lv_obj_remove_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    }
+
+    TEST_ASSERT_MAX_TIME(refr_screen, 2000);
+}
+
+#endif
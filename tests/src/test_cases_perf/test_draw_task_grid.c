@@ -0,0 +1,88 @@
+/* Performance test for finding the independent and dependent draw tasks of a layer */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define CANVAS_W    800
+#define CANVAS_H    480
+
+static lv_obj_t * canvas;
+static lv_draw_buf_t * draw_buf;
+static lv_layer_t layer;
+
+void setUp(void)
+{
+    draw_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, draw_buf);
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(canvas);
+    lv_draw_buf_destroy(draw_buf);
+}
+
+/*Add small, partially overlapping rectangles all over the canvas*/
+static void add_tasks(uint32_t cnt)
+{
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_fill_dsc_t fill_dsc;
+    lv_draw_fill_dsc_init(&fill_dsc);
+    fill_dsc.opa = LV_OPA_50;
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_area_t a;
+        a.x1 = (int32_t)((i * 37) % (CANVAS_W - 10));
+        a.y1 = (int32_t)((i * 101) % (CANVAS_H - 10));
+        a.x2 = a.x1 + 9;
+        a.y2 = a.y1 + 9;
+        fill_dsc.color = lv_palette_main(i % LV_PALETTE_LAST);
+        lv_draw_fill(&layer, &fill_dsc, &a);
+    }
+}
+
+/*Find all the independent draw tasks and count the dependents of each draw task*/
+static void check_dependencies(void)
+{
+    uint8_t unit_id = layer.draw_task_head->preferred_draw_unit_id;
+    lv_draw_task_t * t = NULL;
+    while((t = lv_draw_get_next_available_task(&layer, t, unit_id)) != NULL);
+
+    t = layer.draw_task_head;
+    while(t) {
+        lv_draw_get_dependent_count(t);
+        t = t->next;
+    }
+}
+
+static void test_dependencies(uint32_t task_cnt, uint32_t max_time_ms)
+{
+    add_tasks(task_cnt);
+    TEST_ASSERT_EQUAL_UINT32(task_cnt, layer.draw_task_cnt);
+
+    TEST_ASSERT_MAX_TIME(check_dependencies, max_time_ms);
+
+    lv_canvas_finish_layer(canvas, &layer);
+    TEST_ASSERT_NULL(layer.draw_task_head);
+    TEST_ASSERT_NULL(layer.draw_task_grid);
+}
+
+void test_draw_task_dependency_1k(void)
+{
+    test_dependencies(1000, 50);
+}
+
+void test_draw_task_dependency_5k(void)
+{
+    test_dependencies(5000, 250);
+}
+
+void test_draw_task_dependency_20k(void)
+{
+    test_dependencies(20000, 1000);
+}
+
+#endif
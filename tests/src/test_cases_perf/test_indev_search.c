@@ -0,0 +1,60 @@
+/* Performance test for finding the widget under the pointer on a screen with many widgets */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define OBJ_COL_CNT     100
+#define OBJ_ROW_CNT     100
+#define MOVE_CNT        1000
+
+static lv_obj_t * scr;
+
+static void create_objs(void)
+{
+    /*Small overlapping widgets covering the whole screen*/
+    int32_t w = lv_obj_get_width(scr);
+    int32_t h = lv_obj_get_height(scr);
+    uint32_t i;
+    for(i = 0; i < OBJ_COL_CNT * OBJ_ROW_CNT; i++) {
+        lv_obj_t * obj = lv_obj_create(scr);
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_pos(obj, (int32_t)(i % OBJ_COL_CNT) * w / OBJ_COL_CNT, (int32_t)(i / OBJ_COL_CNT) * h / OBJ_ROW_CNT);
+        lv_obj_set_size(obj, w / OBJ_COL_CNT + 4, h / OBJ_ROW_CNT + 4);
+    }
+
+    lv_obj_update_layout(scr);
+}
+
+static void move_pointer(uint32_t cnt)
+{
+    lv_indev_t * indev = lv_test_indev_get_indev(LV_INDEV_TYPE_POINTER);
+    int32_t w = lv_obj_get_width(scr);
+    int32_t h = lv_obj_get_height(scr);
+
+    /*Move around on the screen. The hovered widget is searched on each read.*/
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_test_mouse_move_to((int32_t)(i * 7) % w, (int32_t)(i * 13) % h);
+        lv_indev_read(indev);
+    }
+}
+
+void setUp(void)
+{
+    scr = lv_obj_create(NULL);
+    lv_screen_load(scr);
+    create_objs();
+}
+
+void tearDown(void)
+{
+    lv_screen_load(lv_obj_create(NULL));
+    lv_obj_delete(scr);
+}
+
+void test_indev_search_10k(void)
+{
+    TEST_ASSERT_MAX_TIME(move_pointer, 50, MOVE_CNT);
+}
+
+#endif
@@ -0,0 +1,115 @@
+/* Performance test for refreshing many small, scattered invalidated areas */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define LED_CNT         40
+#define REFR_CNT        10
+#define AREA_CNT        5000
+
+static lv_obj_t * leds[LED_CNT];
+static uint32_t redrawn_area_cnt;
+static uint32_t redrawn_px_cnt;
+
+static void render_start_cb(lv_event_t * e)
+{
+    lv_display_t * disp = lv_event_get_target(e);
+    redrawn_area_cnt = disp->inv_p;
+    redrawn_px_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        redrawn_px_cnt += lv_area_get_size(&disp->inv_areas[i]);
+    }
+}
+
+static void blink_leds(void)
+{
+    uint32_t i;
+    for(i = 0; i < REFR_CNT; i++) {
+        uint32_t j;
+        for(j = 0; j < LED_CNT; j++) {
+            lv_led_toggle(leds[j]);
+        }
+        lv_refr_now(NULL);
+    }
+}
+
+static void invalidate_and_join(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    uint32_t i;
+    for(i = 0; i < AREA_CNT; i++) {
+        lv_area_t a;
+        a.x1 = (int32_t)((i * 37) % 790);
+        a.y1 = (int32_t)((i * 101) % 470);
+        a.x2 = a.x1 + 9;
+        a.y2 = a.y1 + 9;
+        lv_inv_area(disp, &a);
+    }
+
+    lv_refr_now(disp);
+}
+
+void setUp(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_obj_set_style_bg_grad_color(scr, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_VER, 0);
+    lv_obj_set_scrollbar_mode(scr, LV_SCROLLBAR_MODE_OFF);
+
+    /*Text all over the screen, which is expensive to redraw*/
+    lv_obj_t * label = lv_label_create(scr);
+    lv_obj_set_width(label, lv_pct(100));
+    lv_label_set_text(label, "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt "
+                      "ut labore et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco "
+                      "laboris nisi ut aliquip ex ea commodo consequat. Duis aute irure dolor in reprehenderit in "
+                      "voluptate velit esse cillum dolore eu fugiat nulla pariatur. Excepteur sint occaecat cupidatat "
+                      "non proident, sunt in culpa qui officia deserunt mollit anim id est laborum. Lorem ipsum dolor "
+                      "sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore "
+                      "magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut "
+                      "aliquip ex ea commodo consequat. Duis aute irure dolor in reprehenderit in voluptate velit "
+                      "esse cillum dolore eu fugiat nulla pariatur. Excepteur sint occaecat cupidatat non proident, "
+                      "sunt in culpa qui officia deserunt mollit anim id est laborum.");
+
+    /*Small LEDs scattered on a large panel*/
+    uint32_t i;
+    for(i = 0; i < LED_CNT; i++) {
+        leds[i] = lv_led_create(scr);
+        lv_obj_set_size(leds[i], 8, 8);
+        lv_obj_set_pos(leds[i], (int32_t)((i * 53) % 760), (int32_t)((i * 89) % 440));
+    }
+
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_inv_area_blinking_leds(void)
+{
+    uint32_t i;
+    for(i = 0; i < LED_CNT; i++) {
+        lv_led_toggle(leds[i]);
+    }
+
+    /*More areas than LV_INV_BUF_SIZE don't invalidate the whole screen*/
+    lv_display_t * disp = lv_display_get_default();
+    lv_display_add_event_cb(disp, render_start_cb, LV_EVENT_RENDER_START, NULL);
+    lv_refr_now(NULL);
+    lv_display_remove_event_cb_with_user_data(disp, render_start_cb, NULL);
+    TEST_ASSERT_GREATER_THAN(1, redrawn_area_cnt);
+    TEST_ASSERT_LESS_THAN(lv_display_get_horizontal_resolution(disp) * lv_display_get_vertical_resolution(disp),
+                          redrawn_px_cnt);
+
+    TEST_ASSERT_MAX_TIME(blink_leds, 100);
+}
+
+void test_inv_area_join(void)
+{
+    TEST_ASSERT_MAX_TIME(invalidate_and_join, 200);
+}
+
+#endif
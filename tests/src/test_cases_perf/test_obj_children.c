@@ -0,0 +1,65 @@
+/* Performance test for creating, moving and deleting many children */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+static lv_obj_t * parent;
+
+static void create_children(uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_create(parent);
+    }
+}
+
+/*Delete from the end to measure the shrinking of the array and not the shifting of the children*/
+static void delete_children(void)
+{
+    int32_t i;
+    for(i = (int32_t)lv_obj_get_child_count(parent) - 1; i >= 0; i--) {
+        lv_obj_delete(lv_obj_get_child(parent, i));
+    }
+}
+
+static void move_children_twice(void)
+{
+    lv_obj_t * parent2 = lv_obj_create(lv_screen_active());
+    lv_obj_move_children(parent, parent2);
+    lv_obj_move_children(parent2, parent);
+    lv_obj_delete(parent2);
+}
+
+static void measure(uint32_t cnt, uint32_t max_time_ms)
+{
+    TEST_ASSERT_MAX_TIME(create_children, max_time_ms, cnt);
+    TEST_ASSERT_MAX_TIME(move_children_twice, max_time_ms);
+    TEST_ASSERT_MAX_TIME(delete_children, max_time_ms);
+}
+
+void setUp(void)
+{
+    parent = lv_obj_create(lv_screen_active());
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(parent);
+}
+
+void test_obj_children_10k(void)
+{
+    measure(10000, 100);
+}
+
+void test_obj_children_50k(void)
+{
+    measure(50000, 500);
+}
+
+void test_obj_children_100k(void)
+{
+    measure(100000, 1000);
+}
+
+#endif
@@ -0,0 +1,50 @@
+/* Performance test for deleting many widgets with lv_obj_clean() and with their screen */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define OBJ_CNT         20000
+
+static lv_obj_t * scr;
+
+static void create_objs(void)
+{
+    /*Lists of buttons with a label on them*/
+    uint32_t i;
+    for(i = 0; i < OBJ_CNT / 200; i++) {
+        lv_obj_t * list = lv_obj_create(scr);
+        uint32_t j;
+        for(j = 0; j < 100; j++) {
+            lv_obj_t * btn = lv_button_create(list);
+            lv_label_create(btn);
+        }
+
+        /*Let the labels refresh their texts as if the lists were rendered*/
+        lv_obj_update_layout(list);
+    }
+}
+
+void setUp(void)
+{
+    scr = lv_obj_create(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(scr);
+}
+
+void test_obj_clean_20k(void)
+{
+    create_objs();
+    TEST_ASSERT_MAX_TIME(lv_obj_clean, 200, scr);
+}
+
+void test_obj_delete_screen_20k(void)
+{
+    create_objs();
+    TEST_ASSERT_MAX_TIME(lv_obj_delete, 200, scr);
+    scr = lv_obj_create(NULL);
+}
+
+#endif
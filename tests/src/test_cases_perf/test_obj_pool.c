@@ -0,0 +1,45 @@
+/* Performance test for creating and deleting many widgets with the widget pools */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define LABEL_CNT       5000
+#define ITER_CNT        5
+
+static lv_obj_t * parent;
+
+static void create_and_delete_labels(void)
+{
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < ITER_CNT; i++) {
+        for(j = 0; j < LABEL_CNT; j++) {
+            lv_obj_t * label = lv_label_create(parent);
+            lv_label_set_text_static(label, "Label");
+            if(j % 4 == 0) lv_obj_set_style_text_color(label, lv_color_hex(0x112233), 0);
+        }
+
+        /*Delete every second label first to fragment the heap as a real UI would*/
+        for(j = LABEL_CNT; j > 0; j -= 2) {
+            lv_obj_delete(lv_obj_get_child(parent, (int32_t)j - 1));
+        }
+        lv_obj_clean(parent);
+    }
+}
+
+void setUp(void)
+{
+    parent = lv_obj_create(lv_screen_active());
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(parent);
+}
+
+void test_obj_pool_labels(void)
+{
+    TEST_ASSERT_MAX_TIME(create_and_delete_labels, 2000);
+}
+
+#endif
@@ -0,0 +1,55 @@
+/* Performance test for scrolling a recycler view with 100k rows */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define ROW_CNT         100000
+#define STEP_CNT        2000
+
+static lv_obj_t * rv;
+
+static uint32_t get_count_cb(lv_obj_t * obj)
+{
+    LV_UNUSED(obj);
+    return ROW_CNT;
+}
+
+static void bind_row_cb(lv_obj_t * obj, lv_obj_t * row, uint32_t index)
+{
+    LV_UNUSED(obj);
+    lv_label_set_text_fmt(row, "Event %" LV_PRIu32, index);
+}
+
+static void scroll_rows(void)
+{
+    /*Scroll by a few pixels as dragging does and jump through the rows*/
+    uint32_t i;
+    for(i = 0; i < STEP_CNT; i++) {
+        lv_obj_scroll_by(rv, 0, -7, LV_ANIM_OFF);
+    }
+
+    for(i = 0; i < STEP_CNT; i++) {
+        lv_recyclerview_scroll_to_row(rv, (i * 7919) % ROW_CNT, LV_ANIM_OFF);
+    }
+}
+
+void setUp(void)
+{
+    rv = lv_recyclerview_create(lv_screen_active());
+    lv_obj_set_size(rv, 300, lv_pct(100));
+    lv_recyclerview_set_bind_row_cb(rv, bind_row_cb);
+    lv_recyclerview_set_get_count_cb(rv, get_count_cb);
+    lv_obj_update_layout(rv);
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(rv);
+}
+
+void test_recyclerview_scroll_100k(void)
+{
+    TEST_ASSERT_MAX_TIME(scroll_rows, 1000);
+}
+
+#endif
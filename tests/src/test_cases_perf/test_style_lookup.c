@@ -0,0 +1,143 @@
+/* Performance test for getting properties from styles */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define ITER_CNT        20000
+#define THEME_ITER_CNT  2000
+#define THEME_STYLE_MAX 256
+
+static lv_style_t style_small;
+static lv_style_t style_large;
+
+/*The styles the default theme adds to the widgets*/
+static const lv_style_t * theme_styles[THEME_STYLE_MAX];
+static uint32_t theme_style_cnt;
+
+/*A typical mix of the properties used by the themes, in the order they are usually set*/
+static const lv_style_prop_t theme_props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_BG_OPA, LV_STYLE_BORDER_COLOR, LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_OPA,
+    LV_STYLE_RADIUS, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM, LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT,
+    LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN, LV_STYLE_TEXT_COLOR, LV_STYLE_TEXT_FONT, LV_STYLE_SHADOW_WIDTH,
+    LV_STYLE_SHADOW_COLOR, LV_STYLE_SHADOW_OPA, LV_STYLE_SHADOW_OFFSET_Y, LV_STYLE_OUTLINE_WIDTH,
+    LV_STYLE_OUTLINE_COLOR, LV_STYLE_OUTLINE_OPA, LV_STYLE_OUTLINE_PAD, LV_STYLE_LINE_WIDTH, LV_STYLE_LINE_COLOR,
+    LV_STYLE_ARC_WIDTH, LV_STYLE_ARC_COLOR, LV_STYLE_ANIM_DURATION, LV_STYLE_TRANSITION, LV_STYLE_CLIP_CORNER,
+    LV_STYLE_MIN_HEIGHT, LV_STYLE_BG_GRAD_COLOR, LV_STYLE_BG_GRAD_DIR,
+};
+
+/*The properties read when drawing a rectangle, some of them are not in the styles*/
+static const lv_style_prop_t draw_props[] = {
+    LV_STYLE_OPA, LV_STYLE_RADIUS, LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR, LV_STYLE_BG_GRAD, LV_STYLE_BG_GRAD_DIR,
+    LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_OPA, LV_STYLE_BORDER_SIDE, LV_STYLE_BORDER_COLOR, LV_STYLE_OUTLINE_WIDTH,
+    LV_STYLE_BG_IMAGE_SRC, LV_STYLE_SHADOW_WIDTH, LV_STYLE_SHADOW_OPA, LV_STYLE_SHADOW_OFFSET_X,
+    LV_STYLE_SHADOW_OFFSET_Y, LV_STYLE_SHADOW_SPREAD, LV_STYLE_SHADOW_COLOR, LV_STYLE_COLOR_FILTER_DSC,
+    LV_STYLE_RECOLOR_OPA,
+};
+
+static uint32_t found_cnt;
+
+static void get_props(const lv_style_t * style)
+{
+    uint32_t i;
+    for(i = 0; i < ITER_CNT; i++) {
+        uint32_t j;
+        for(j = 0; j < sizeof(draw_props) / sizeof(draw_props[0]); j++) {
+            lv_style_value_t v;
+            if(lv_style_get_prop(style, draw_props[j], &v) == LV_STYLE_RES_FOUND) found_cnt++;
+        }
+    }
+}
+
+static void get_theme_props(void)
+{
+    uint32_t i;
+    for(i = 0; i < THEME_ITER_CNT; i++) {
+        uint32_t s;
+        for(s = 0; s < theme_style_cnt; s++) {
+            uint32_t j;
+            for(j = 0; j < sizeof(draw_props) / sizeof(draw_props[0]); j++) {
+                lv_style_value_t v;
+                if(lv_style_get_prop(theme_styles[s], draw_props[j], &v) == LV_STYLE_RES_FOUND) found_cnt++;
+            }
+        }
+    }
+}
+
+static void collect_theme_styles(lv_obj_t * obj)
+{
+    uint32_t i;
+    for(i = 0; i < obj->style_cnt; i++) {
+        const lv_style_t * style = obj->styles[i].style;
+        uint32_t j;
+        for(j = 0; j < theme_style_cnt; j++) {
+            if(theme_styles[j] == style) break;
+        }
+        if(j == theme_style_cnt && theme_style_cnt < THEME_STYLE_MAX) theme_styles[theme_style_cnt++] = style;
+    }
+
+    for(i = 0; i < lv_obj_get_child_count(obj); i++) {
+        collect_theme_styles(lv_obj_get_child(obj, i));
+    }
+}
+
+void setUp(void)
+{
+    lv_style_init(&style_small);
+    lv_style_init(&style_large);
+
+    uint32_t i;
+    for(i = 0; i < sizeof(theme_props) / sizeof(theme_props[0]); i++) {
+        lv_style_value_t v = { .num = (int32_t)i + 1 };
+        if(i < 6) lv_style_set_prop(&style_small, theme_props[i], v);
+        lv_style_set_prop(&style_large, theme_props[i], v);
+    }
+}
+
+void tearDown(void)
+{
+    lv_style_reset(&style_small);
+    lv_style_reset(&style_large);
+}
+
+void test_style_lookup(void)
+{
+    /*All 6 properties of the small style and 12 of the large style are read when drawing*/
+    found_cnt = 0;
+    TEST_ASSERT_MAX_TIME(get_props, 100, &style_small);
+    TEST_ASSERT_EQUAL_UINT32(ITER_CNT * 6, found_cnt);
+
+    found_cnt = 0;
+    TEST_ASSERT_MAX_TIME(get_props, 100, &style_large);
+    TEST_ASSERT_EQUAL_UINT32(ITER_CNT * 12, found_cnt);
+}
+
+void test_style_lookup_theme(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_button_create(scr);
+    lv_slider_create(scr);
+    lv_switch_create(scr);
+    lv_checkbox_create(scr);
+    lv_dropdown_create(scr);
+    lv_bar_create(scr);
+    lv_arc_create(scr);
+    lv_textarea_create(scr);
+    lv_roller_create(scr);
+    lv_table_create(scr);
+    lv_chart_create(scr);
+    lv_list_create(scr);
+    lv_tabview_create(scr);
+    lv_calendar_create(scr);
+    lv_keyboard_create(scr);
+
+    theme_style_cnt = 0;
+    collect_theme_styles(scr);
+
+    found_cnt = 0;
+    TEST_ASSERT_MAX_TIME(get_theme_props, 100);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, found_cnt);
+
+    lv_obj_clean(scr);
+}
+
+#endif
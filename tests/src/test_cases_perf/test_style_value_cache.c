@@ -0,0 +1,81 @@
+/* Performance test for getting the style properties used for drawing */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define ROW_CNT         8
+#define ITER_CNT        200
+
+/*A screen similar to the settings page of the widgets demo*/
+static void create_row(lv_obj_t * parent, uint32_t i)
+{
+    lv_obj_t * cont = lv_obj_create(parent);
+    lv_obj_set_size(cont, lv_pct(100), LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+
+    lv_obj_t * label = lv_label_create(cont);
+    lv_label_set_text_fmt(label, "Setting %" LV_PRIu32, i);
+
+    lv_obj_t * btn = lv_button_create(cont);
+    label = lv_label_create(btn);
+    lv_label_set_text(label, "Apply");
+    if(i % 2) lv_obj_add_state(btn, LV_STATE_CHECKED);
+
+    lv_slider_create(cont);
+    lv_obj_t * sw = lv_switch_create(cont);
+    if(i % 3) lv_obj_add_state(sw, LV_STATE_CHECKED);
+    lv_checkbox_create(cont);
+    lv_dropdown_create(cont);
+    lv_bar_create(cont);
+    lv_textarea_create(cont);
+}
+
+static void init_draw_rect_dsc_core(lv_obj_t * obj)
+{
+    static const lv_part_t parts[] = {LV_PART_MAIN, LV_PART_INDICATOR, LV_PART_KNOB};
+    lv_draw_rect_dsc_t dsc;
+    uint32_t i;
+    for(i = 0; i < sizeof(parts) / sizeof(parts[0]); i++) {
+        lv_draw_rect_dsc_init(&dsc);
+        dsc.base.layer = NULL;
+        lv_obj_init_draw_rect_dsc(obj, parts[i], &dsc);
+    }
+
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        init_draw_rect_dsc_core(lv_obj_get_child(obj, i));
+    }
+}
+
+static void init_draw_rect_dsc(void)
+{
+    uint32_t i;
+    for(i = 0; i < ITER_CNT; i++) {
+        init_draw_rect_dsc_core(lv_screen_active());
+    }
+}
+
+void setUp(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < ROW_CNT; i++) {
+        create_row(scr, i);
+    }
+
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_style_value_cache_init_draw_rect_dsc(void)
+{
+    TEST_ASSERT_MAX_TIME(init_draw_rect_dsc, 300);
+}
+
+#endif
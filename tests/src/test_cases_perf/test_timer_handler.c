@@ -0,0 +1,53 @@
+/* Performance test for calling the timer handler with many timers */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define TIMER_CNT       500
+#define HANDLER_CNT     1000
+
+static lv_timer_t * timers[TIMER_CNT];
+static uint32_t run_cnt;
+
+static void timer_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+    run_cnt++;
+}
+
+static void call_handler(uint32_t cnt)
+{
+    /*Only a few timers are ready in each call*/
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+    }
+}
+
+void setUp(void)
+{
+    uint32_t i;
+    for(i = 0; i < TIMER_CNT; i++) {
+        timers[i] = lv_timer_create(timer_cb, 100 + i, NULL);
+    }
+    run_cnt = 0;
+}
+
+void tearDown(void)
+{
+    uint32_t i;
+    for(i = 0; i < TIMER_CNT; i++) {
+        lv_timer_delete(timers[i]);
+    }
+}
+
+void test_timer_handler_500_timers(void)
+{
+    TEST_ASSERT_MAX_TIME(call_handler, 10, HANDLER_CNT);
+
+    /*Each timer's period is shorter than the simulated time*/
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(TIMER_CNT, run_cnt);
+}
+
+#endif